@@ -24,6 +24,11 @@ use strict;
 # Ideally RSA values should be stored in the configuration file, in a
 # separate section. This will be added in the future.
 
+# The script also generates a perfect hash index mapping (residue,
+# atom) to radius and class, see struct classifier_index in
+# classifier.h. The hash function and key packing below have to match
+# index_hash() and index_key() in classifier.c.
+
 my %types;
 my %atoms;
 my %residues;
@@ -140,6 +145,76 @@ foreach my $p (@pdb) {
         "$subarea{sc}, $subarea{pol}, $subarea{apol}, 0\}";
 }
 
+# FNV-1a over the four bytes of the seed and the eight bytes of the key
+sub index_hash {
+    my ($bytes, $seed) = @_;
+    my $h = 2166136261;
+    for my $i (0..3) {
+        $h ^= ($seed >> (8*$i)) & 0xff;
+        $h = ($h * 16777619) & 0xffffffff;
+    }
+    for my $b (@$bytes) {
+        $h ^= $b;
+        $h = ($h * 16777619) & 0xffffffff;
+    }
+    return $h;
+}
+
+# residue name in bytes 0-2, atom name in bytes 3-6, zero padded
+sub index_key {
+    my ($res, $atom) = @_;
+    die "Residue name $res too long" if (length $res > 3);
+    die "Atom name $atom too long" if (length $atom > 4);
+    my @bytes = (0) x 8;
+    $bytes[$_] = ord(substr($res, $_, 1)) foreach (0..length($res)-1);
+    $bytes[3+$_] = ord(substr($atom, $_, 1)) foreach (0..length($atom)-1);
+    return \@bytes;
+}
+
+# Hash-and-displace, same algorithm as classifier_build_index()
+my @index_keys;
+foreach my $res (sort keys %atoms) {
+    foreach my $atom (sort keys %{$atoms{$res}}) {
+        push @index_keys, [index_key($res, $atom), $types{$atoms{$res}{$atom}}];
+    }
+}
+my $n_keys = scalar @index_keys;
+my $n_buckets = int($n_keys / 4) + 1;
+my $n_slots = $n_keys + int($n_keys / 4) + 1;
+my (@seed, @slot);
+INDEX: while (1) {
+    my @bucket;
+    @seed = (0) x $n_buckets;
+    @slot = (undef) x $n_slots;
+    foreach my $k (@index_keys) {
+        push @{$bucket[index_hash($k->[0], 0) % $n_buckets]}, $k;
+    }
+    my @order = sort {
+        scalar @{$bucket[$b] // []} <=> scalar @{$bucket[$a] // []} or $a <=> $b
+    } (0..$n_buckets-1);
+    foreach my $bi (@order) {
+        next if (! defined $bucket[$bi]);
+        my $placed = 0;
+        SEED: for my $s (1..99999) {
+            my %taken;
+            foreach my $k (@{$bucket[$bi]}) {
+                my $i = index_hash($k->[0], $s) % $n_slots;
+                next SEED if (defined $slot[$i] or exists $taken{$i});
+                $taken{$i} = $k;
+            }
+            $slot[$_] = $taken{$_} foreach (keys %taken);
+            $seed[$bi] = $s;
+            $placed = 1;
+            last;
+        }
+        if (! $placed) {
+            $n_slots += int($n_slots / 2);
+            next INDEX;
+        }
+    }
+    last;
+}
+
 my @res_array = sort keys %residues;
 print "#include \"classifier.h\"\n\n";
 print "/* Autogenerated code from the script config2c.pl */\n\n";
@@ -148,7 +223,7 @@ print "\"$_\", "foreach (@res_array);
 print "};\n";
 
 foreach my $res (@res_array) {
-    my @atom_names = keys %{$atoms{$res}};
+    my @atom_names = sort keys %{$atoms{$res}};
     print "static const char *$prefix\_$res\_atom_name[] = {";
     print "\"$_\", " foreach (@atom_names);
     print "};\n";
@@ -178,9 +253,34 @@ foreach my $res (@res_array) {
 print "};\n\n";
 
 
+print "static unsigned int $prefix\_index_seed[] = {";
+print "$_, " foreach (@seed);
+print "};\n\n";
+
+print "static struct classifier_index_entry $prefix\_index_slot[] = {\n";
+foreach my $k (@slot) {
+    if (defined $k) {
+        my $key = "0x" . join('', map {sprintf "%02x", $_} reverse @{$k->[0]});
+        print "    {${key}ULL, $k->[1]{radius}, $k->[1]{class}},\n";
+    } else {
+        print "    {0, 0, FREESASA_ATOM_UNKNOWN},\n";
+    }
+}
+print "};\n\n";
+
+print "static struct classifier_index $prefix\_index = {\n";
+print "    $n_buckets,\n";
+print "    $n_slots,\n";
+print "    $prefix\_index_seed,\n";
+print "    $prefix\_index_slot,\n";
+print "};\n\n";
+
 print "const freesasa_classifier freesasa_$prefix\_classifier = {\n";
 print "    $n_residues,";
 print "    (char**) $prefix\_residue_name,\n";
 print "    \"$name\",\n";
 print "    (struct classifier_residue **) $prefix\_residue_cfg,\n";
+print "    &$prefix\_index,\n";
+print "    NULL,\n";
+print "    0,\n";
 print "};\n\n";
@@ -0,0 +1,669 @@
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+
+#include "bcif.hh"
+
+/* BinaryCIF is a MessagePack document, where the data of each column
+   is a byte array with a list of encodings that are undone in reverse
+   order, see https://github.com/molstar/BinaryCIF */
+
+/* A value in a MessagePack document. Strings and binary data point
+   into the buffer the document was parsed from. */
+struct MsgpackValue {
+    enum Type { NIL,
+                BOOL,
+                INT,
+                FLOAT,
+                STRING,
+                BINARY,
+                ARRAY,
+                MAP };
+
+    /* The value of a key in a map, or NULL */
+    const MsgpackValue *find(const char *key) const
+    {
+        size_t len = strlen(key);
+
+        if (type != MAP) return nullptr;
+        for (size_t i = 0; i + 1 < items.size(); i += 2) {
+            const MsgpackValue &k = items[i];
+            if (k.type == STRING && k.size == len && memcmp(k.data, key, len) == 0) {
+                return &items[i + 1];
+            }
+        }
+        return nullptr;
+    }
+
+    std::string string() const { return std::string((const char *)data, size); }
+
+    Type type{NIL};
+    int64_t integer{0};
+    double real{0};
+    const unsigned char *data{nullptr}; // STRING and BINARY
+    size_t size{0};
+    std::vector<MsgpackValue> items; // ARRAY, and keys and values of MAP
+};
+
+[[noreturn]] static void
+invalid(const char *what)
+{
+    throw std::runtime_error(what);
+}
+
+class MsgpackParser
+{
+public:
+    MsgpackParser(const unsigned char *data, size_t size)
+        : _p(data), _end(data + size) {}
+
+    void parse(MsgpackValue &value) { parse(value, 0); }
+
+private:
+    // deep enough for BinaryCIF, and keeps bad input from overflowing the stack
+    static const int max_depth = 64;
+
+    const unsigned char *take(size_t n)
+    {
+        const unsigned char *p = _p;
+        if ((size_t)(_end - _p) < n) invalid("unexpected end of input");
+        _p += n;
+        return p;
+    }
+
+    uint64_t big_endian(size_t n)
+    {
+        const unsigned char *p = take(n);
+        uint64_t value = 0;
+        for (size_t i = 0; i < n; ++i) {
+            value = (value << 8) | p[i];
+        }
+        return value;
+    }
+
+    void bytes(MsgpackValue &value, MsgpackValue::Type type, size_t n)
+    {
+        value.type = type;
+        value.size = n;
+        value.data = take(n);
+    }
+
+    /* n items for an array, 2n for a map */
+    void items(MsgpackValue &value, MsgpackValue::Type type, size_t n, int depth)
+    {
+        // every item takes at least one byte
+        if (n > (size_t)(_end - _p)) invalid("unexpected end of input");
+        value.type = type;
+        value.items.resize(n);
+        for (auto &item : value.items) {
+            parse(item, depth + 1);
+        }
+    }
+
+    void parse(MsgpackValue &value, int depth)
+    {
+        unsigned int c;
+        uint64_t u;
+
+        if (depth > max_depth) invalid("too deeply nested");
+
+        c = *take(1);
+        if (c <= 0x7f || c >= 0xe0) {
+            value.type = MsgpackValue::INT;
+            value.integer = (int8_t)c;
+            if (c <= 0x7f) value.integer = c;
+        } else if (c <= 0x8f) {
+            items(value, MsgpackValue::MAP, 2 * (c & 0x0f), depth);
+        } else if (c <= 0x9f) {
+            items(value, MsgpackValue::ARRAY, c & 0x0f, depth);
+        } else if (c <= 0xbf) {
+            bytes(value, MsgpackValue::STRING, c & 0x1f);
+        } else {
+            switch (c) {
+            case 0xc0:
+                value.type = MsgpackValue::NIL;
+                break;
+            case 0xc2:
+            case 0xc3:
+                value.type = MsgpackValue::BOOL;
+                value.integer = c == 0xc3;
+                break;
+            case 0xc4:
+            case 0xc5:
+            case 0xc6:
+                bytes(value, MsgpackValue::BINARY, big_endian(1 << (c - 0xc4)));
+                break;
+            case 0xc7:
+            case 0xc8:
+            case 0xc9:
+                // extension types are not used by BinaryCIF
+                u = big_endian(1 << (c - 0xc7));
+                take(u + 1);
+                value.type = MsgpackValue::NIL;
+                break;
+            case 0xca:
+                u = big_endian(4);
+                {
+                    uint32_t u32 = u;
+                    float f;
+                    memcpy(&f, &u32, sizeof f);
+                    value.real = f;
+                }
+                value.type = MsgpackValue::FLOAT;
+                break;
+            case 0xcb:
+                u = big_endian(8);
+                memcpy(&value.real, &u, sizeof value.real);
+                value.type = MsgpackValue::FLOAT;
+                break;
+            case 0xcc:
+            case 0xcd:
+            case 0xce:
+            case 0xcf:
+                u = big_endian(1 << (c - 0xcc));
+                if (u > INT64_MAX) invalid("integer out of range");
+                value.type = MsgpackValue::INT;
+                value.integer = u;
+                break;
+            case 0xd0:
+                value.type = MsgpackValue::INT;
+                value.integer = (int8_t)big_endian(1);
+                break;
+            case 0xd1:
+                value.type = MsgpackValue::INT;
+                value.integer = (int16_t)big_endian(2);
+                break;
+            case 0xd2:
+                value.type = MsgpackValue::INT;
+                value.integer = (int32_t)big_endian(4);
+                break;
+            case 0xd3:
+                value.type = MsgpackValue::INT;
+                value.integer = (int64_t)big_endian(8);
+                break;
+            case 0xd4:
+            case 0xd5:
+            case 0xd6:
+            case 0xd7:
+            case 0xd8:
+                take(1 + (1 << (c - 0xd4)));
+                value.type = MsgpackValue::NIL;
+                break;
+            case 0xd9:
+            case 0xda:
+            case 0xdb:
+                bytes(value, MsgpackValue::STRING, big_endian(1 << (c - 0xd9)));
+                break;
+            case 0xdc:
+            case 0xdd:
+                items(value, MsgpackValue::ARRAY, big_endian(2 << (c - 0xdc)), depth);
+                break;
+            case 0xde:
+            case 0xdf:
+                items(value, MsgpackValue::MAP, 2 * big_endian(2 << (c - 0xde)), depth);
+                break;
+            default:
+                invalid("invalid MessagePack");
+            }
+        }
+    }
+
+    const unsigned char *_p, *_end;
+};
+
+static const MsgpackValue &
+get(const MsgpackValue &map,
+    const char *key,
+    MsgpackValue::Type type)
+{
+    const MsgpackValue *value = map.find(key);
+
+    if (value == nullptr || value->type != type) {
+        throw std::runtime_error(std::string("missing or invalid '") + key + "'");
+    }
+    return *value;
+}
+
+static double
+get_number(const MsgpackValue &map,
+           const char *key)
+{
+    const MsgpackValue *value = map.find(key);
+
+    if (value != nullptr && value->type == MsgpackValue::INT) return value->integer;
+    if (value != nullptr && value->type == MsgpackValue::FLOAT) return value->real;
+    throw std::runtime_error(std::string("missing or invalid '") + key + "'");
+}
+
+/* An array in the process of being decoded */
+struct DecodedArray {
+    enum State { BYTES,
+                 INT,
+                 FLOAT,
+                 STRING } state;
+    const unsigned char *bytes;
+    size_t n_bytes;
+    std::vector<int32_t> ints;
+    std::vector<double> floats;
+    std::vector<std::string> strings;
+};
+
+static void decode(const MsgpackValue &encodings,
+                   const unsigned char *bytes,
+                   size_t n_bytes,
+                   DecodedArray &array);
+
+/* The data types of ByteArray */
+enum { INT8 = 1,
+       INT16 = 2,
+       INT32 = 3,
+       UINT8 = 4,
+       UINT16 = 5,
+       UINT32 = 6,
+       FLOAT32 = 32,
+       FLOAT64 = 33 };
+
+/* Little endian bytes to numbers */
+static void
+decode_byte_array(const MsgpackValue &encoding,
+                  DecodedArray &array)
+{
+    const int type = get(encoding, "type", MsgpackValue::INT).integer;
+    size_t size, n, i, j;
+    uint64_t u;
+
+    switch (type) {
+    case INT8:
+    case UINT8:
+        size = 1;
+        break;
+    case INT16:
+    case UINT16:
+        size = 2;
+        break;
+    case INT32:
+    case UINT32:
+    case FLOAT32:
+        size = 4;
+        break;
+    case FLOAT64:
+        size = 8;
+        break;
+    default:
+        invalid("unknown ByteArray type");
+    }
+    if (array.n_bytes % size != 0) invalid("ByteArray size mismatch");
+    n = array.n_bytes / size;
+
+    if (type == FLOAT32 || type == FLOAT64) {
+        array.state = DecodedArray::FLOAT;
+        array.floats.resize(n);
+    } else {
+        array.state = DecodedArray::INT;
+        array.ints.resize(n);
+    }
+
+    for (i = 0; i < n; ++i) {
+        const unsigned char *p = array.bytes + i * size;
+        for (u = 0, j = size; j-- > 0;) {
+            u = (u << 8) | p[j];
+        }
+        switch (type) {
+        case INT8:
+            array.ints[i] = (int8_t)u;
+            break;
+        case INT16:
+            array.ints[i] = (int16_t)u;
+            break;
+        case FLOAT32: {
+            uint32_t u32 = u;
+            float f;
+            memcpy(&f, &u32, sizeof f);
+            array.floats[i] = f;
+            break;
+        }
+        case FLOAT64:
+            memcpy(&array.floats[i], &u, sizeof(double));
+            break;
+        default: // int32 and unsigned types
+            array.ints[i] = (int32_t)u;
+        }
+    }
+}
+
+static void
+decode_fixed_point(const MsgpackValue &encoding,
+                   DecodedArray &array)
+{
+    const double factor = get_number(encoding, "factor");
+
+    if (factor == 0) invalid("FixedPoint factor is 0");
+    array.floats.resize(array.ints.size());
+    for (size_t i = 0; i < array.ints.size(); ++i) {
+        array.floats[i] = array.ints[i] / factor;
+    }
+    array.ints.clear();
+    array.state = DecodedArray::FLOAT;
+}
+
+static void
+decode_interval_quantization(const MsgpackValue &encoding,
+                             DecodedArray &array)
+{
+    const double min = get_number(encoding, "min"),
+                 max = get_number(encoding, "max");
+    const int64_t n_steps = get(encoding, "numSteps", MsgpackValue::INT).integer;
+    const double delta = n_steps > 1 ? (max - min) / (n_steps - 1) : 0;
+
+    array.floats.resize(array.ints.size());
+    for (size_t i = 0; i < array.ints.size(); ++i) {
+        array.floats[i] = min + delta * array.ints[i];
+    }
+    array.ints.clear();
+    array.state = DecodedArray::FLOAT;
+}
+
+/* Pairs of values and repeat counts */
+static void
+decode_run_length(const MsgpackValue &encoding,
+                  DecodedArray &array)
+{
+    const int64_t size = get(encoding, "srcSize", MsgpackValue::INT).integer;
+    const std::vector<int32_t> &in = array.ints;
+    std::vector<int32_t> out;
+
+    if (size < 0 || in.size() % 2 != 0) invalid("invalid RunLength data");
+    out.reserve(size);
+    for (size_t i = 0; i < in.size(); i += 2) {
+        if (in[i + 1] < 0 || in[i + 1] > size - (int64_t)out.size()) {
+            invalid("RunLength size mismatch");
+        }
+        out.insert(out.end(), in[i + 1], in[i]);
+    }
+    if ((int64_t)out.size() != size) invalid("RunLength size mismatch");
+    array.ints.swap(out);
+}
+
+static void
+decode_delta(const MsgpackValue &encoding,
+             DecodedArray &array)
+{
+    uint32_t value = get(encoding, "origin", MsgpackValue::INT).integer;
+
+    // unsigned, so that invalid input wraps around instead of overflowing
+    for (auto &i : array.ints) {
+        value += i;
+        i = (int32_t)value;
+    }
+}
+
+/* Values that don't fit in the packed type are stored as sums of
+   elements, where all but the last are at the limits of the type */
+static void
+decode_integer_packing(const MsgpackValue &encoding,
+                       DecodedArray &array)
+{
+    const int64_t byte_count = get(encoding, "byteCount", MsgpackValue::INT).integer,
+                  size = get(encoding, "srcSize", MsgpackValue::INT).integer;
+    const bool is_unsigned = get(encoding, "isUnsigned", MsgpackValue::BOOL).integer;
+    const std::vector<int32_t> &in = array.ints;
+    int32_t upper, lower;
+    int64_t value;
+    std::vector<int32_t> out;
+    size_t i = 0;
+
+    if ((int64_t)in.size() == size) return;
+    if (byte_count != 1 && byte_count != 2) invalid("invalid IntegerPacking byteCount");
+    if (size < 0 || (int64_t)in.size() < size) invalid("IntegerPacking size mismatch");
+
+    upper = is_unsigned ? (byte_count == 1 ? 0xff : 0xffff)
+                        : (byte_count == 1 ? 0x7f : 0x7fff);
+    lower = is_unsigned ? -1 : -upper - 1;
+
+    out.reserve(size);
+    while (i < in.size()) {
+        value = 0;
+        while (in[i] == upper || in[i] == lower) {
+            value += in[i];
+            if (++i == in.size()) invalid("IntegerPacking size mismatch");
+        }
+        value += in[i++];
+        if (value > INT32_MAX || value < INT32_MIN) invalid("IntegerPacking value out of range");
+        out.push_back(value);
+    }
+    if ((int64_t)out.size() != size) invalid("IntegerPacking size mismatch");
+    array.ints.swap(out);
+}
+
+/* The strings are concatenated, the data is an index for each row,
+   -1 for an empty string */
+static void
+decode_string_array(const MsgpackValue &encoding,
+                    DecodedArray &array)
+{
+    const MsgpackValue &string_data = get(encoding, "stringData", MsgpackValue::STRING),
+                       &offsets = get(encoding, "offsets", MsgpackValue::BINARY);
+    DecodedArray index, offset;
+
+    decode(get(encoding, "dataEncoding", MsgpackValue::ARRAY), array.bytes, array.n_bytes, index);
+    decode(get(encoding, "offsetEncoding", MsgpackValue::ARRAY), offsets.data, offsets.size, offset);
+    if (index.state != DecodedArray::INT || offset.state != DecodedArray::INT) {
+        invalid("invalid StringArray");
+    }
+
+    array.strings.clear();
+    for (size_t i = 1; i < offset.ints.size(); ++i) {
+        int32_t start = offset.ints[i - 1], end = offset.ints[i];
+        if (start < 0 || end < start || (size_t)end > string_data.size) {
+            invalid("invalid StringArray offsets");
+        }
+        array.strings.emplace_back((const char *)string_data.data + start, end - start);
+    }
+    for (auto i : index.ints) {
+        if (i < -1 || i >= (int32_t)array.strings.size()) invalid("invalid StringArray index");
+    }
+    array.ints.swap(index.ints);
+    array.state = DecodedArray::STRING;
+}
+
+/* Undoes the encodings of some bytes, last to first */
+static void
+decode(const MsgpackValue &encodings,
+       const unsigned char *bytes,
+       size_t n_bytes,
+       DecodedArray &array)
+{
+    array.state = DecodedArray::BYTES;
+    array.bytes = bytes;
+    array.n_bytes = n_bytes;
+    for (size_t i = encodings.items.size(); i-- > 0;) {
+        const MsgpackValue &encoding = encodings.items[i];
+        const std::string kind = get(encoding, "kind", MsgpackValue::STRING).string();
+        const bool is_bytes = array.state == DecodedArray::BYTES;
+
+        if (kind == "ByteArray" && is_bytes) {
+            decode_byte_array(encoding, array);
+        } else if (kind == "StringArray" && is_bytes) {
+            decode_string_array(encoding, array);
+        } else if (kind == "FixedPoint" && array.state == DecodedArray::INT) {
+            decode_fixed_point(encoding, array);
+        } else if (kind == "IntervalQuantization" && array.state == DecodedArray::INT) {
+            decode_interval_quantization(encoding, array);
+        } else if (kind == "RunLength" && array.state == DecodedArray::INT) {
+            decode_run_length(encoding, array);
+        } else if (kind == "Delta" && array.state == DecodedArray::INT) {
+            decode_delta(encoding, array);
+        } else if (kind == "IntegerPacking" && array.state == DecodedArray::INT) {
+            decode_integer_packing(encoding, array);
+        } else {
+            throw std::runtime_error("unsupported encoding '" + kind + "'");
+        }
+    }
+    if (array.state == DecodedArray::BYTES) invalid("data is not decoded");
+}
+
+static void
+decode_data(const MsgpackValue &encoded_data,
+            DecodedArray &array)
+{
+    const MsgpackValue &data = get(encoded_data, "data", MsgpackValue::BINARY);
+
+    decode(get(encoded_data, "encoding", MsgpackValue::ARRAY), data.data, data.size, array);
+}
+
+static BcifColumn
+decode_column(const MsgpackValue &column,
+              size_t row_count)
+{
+    const MsgpackValue *mask = column.find("mask");
+    DecodedArray array;
+    BcifColumn decoded;
+
+    decode_data(get(column, "data", MsgpackValue::MAP), array);
+    switch (array.state) {
+    case DecodedArray::INT:
+        decoded.type = BcifColumn::INT;
+        break;
+    case DecodedArray::FLOAT:
+        decoded.type = BcifColumn::FLOAT;
+        break;
+    default:
+        decoded.type = BcifColumn::STRING;
+    }
+    decoded.ints.swap(array.ints);
+    decoded.floats.swap(array.floats);
+    decoded.strings.swap(array.strings);
+    if (decoded.ints.size() + decoded.floats.size() != row_count) {
+        invalid("column size doesn't match row count");
+    }
+
+    if (mask != nullptr && mask->type != MsgpackValue::NIL) {
+        DecodedArray mask_array;
+        decode_data(*mask, mask_array);
+        if (mask_array.state != DecodedArray::INT || mask_array.ints.size() != row_count) {
+            invalid("invalid mask");
+        }
+        decoded.mask.assign(mask_array.ints.begin(), mask_array.ints.end());
+    }
+
+    return decoded;
+}
+
+void BcifColumn::text(size_t row,
+                      std::string &out) const
+{
+    char buf[32];
+
+    if (!mask.empty() && mask[row] != 0) {
+        out = mask[row] == 1 ? "." : "?";
+        return;
+    }
+    switch (type) {
+    case INT:
+        snprintf(buf, sizeof buf, "%d", ints[row]);
+        out = buf;
+        break;
+    case FLOAT:
+        snprintf(buf, sizeof buf, "%.15g", floats[row]);
+        out = buf;
+        break;
+    case STRING:
+        if (ints[row] < 0) {
+            out.clear();
+        } else {
+            out = strings[ints[row]];
+        }
+        break;
+    }
+}
+
+double
+BcifColumn::number(size_t row) const
+{
+    if (!mask.empty() && mask[row] != 0) return 0;
+    switch (type) {
+    case INT:
+        return ints[row];
+    case FLOAT:
+        return floats[row];
+    default:
+        return ints[row] < 0 ? 0 : atof(strings[ints[row]].c_str());
+    }
+}
+
+static std::vector<unsigned char>
+read_all(std::FILE *input)
+{
+    std::vector<unsigned char> data;
+    unsigned char buf[1 << 16];
+    size_t n;
+
+    while ((n = fread(buf, 1, sizeof buf, input)) > 0) {
+        data.insert(data.end(), buf, buf + n);
+    }
+    if (ferror(input)) invalid("read error");
+
+    return data;
+}
+
+std::vector<BcifCategory>
+freesasa_bcif_read_category(std::FILE *input,
+                            const std::string &category,
+                            const std::vector<std::string> &columns)
+{
+    const std::vector<unsigned char> data = read_all(input);
+    std::vector<BcifCategory> found;
+    MsgpackValue file;
+
+    MsgpackParser(data.data(), data.size()).parse(file);
+    if (file.type != MsgpackValue::MAP) invalid("not a BinaryCIF file");
+
+    for (const auto &block : get(file, "dataBlocks", MsgpackValue::ARRAY).items) {
+        if (block.type != MsgpackValue::MAP) invalid("invalid data block");
+        for (const auto &cat : get(block, "categories", MsgpackValue::ARRAY).items) {
+            if (cat.type != MsgpackValue::MAP) invalid("invalid category");
+            std::string name = get(cat, "name", MsgpackValue::STRING).string();
+
+            // the leading '_' is optional
+            if (name != category && "_" + name != category) continue;
+
+            const MsgpackValue &cat_columns = get(cat, "columns", MsgpackValue::ARRAY);
+            std::vector<const MsgpackValue *> selected;
+            for (const auto &column_name : columns) {
+                for (const auto &column : cat_columns.items) {
+                    const MsgpackValue *column_name_value = column.find("name");
+                    if (column_name_value != nullptr && column_name_value->type == MsgpackValue::STRING &&
+                        column_name_value->string() == column_name) {
+                        selected.push_back(&column);
+                        break;
+                    }
+                }
+            }
+            if (selected.size() != columns.size()) continue;
+
+            const int64_t row_count = get(cat, "rowCount", MsgpackValue::INT).integer;
+            if (row_count < 0) invalid("invalid rowCount");
+
+            found.emplace_back();
+            BcifCategory &decoded = found.back();
+            decoded.block = get(block, "header", MsgpackValue::STRING).string();
+            decoded.row_count = row_count;
+            for (auto column : selected) {
+                decoded.columns.push_back(decode_column(*column, row_count));
+            }
+        }
+    }
+
+    return found;
+}
+
+bool freesasa_is_bcif(std::FILE *input)
+{
+    int c = getc(input);
+
+    if (c == EOF) return false;
+    ungetc(c, input);
+
+    return (c >= 0x80 && c <= 0x8f) || c == 0xde || c == 0xdf;
+}
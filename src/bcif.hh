@@ -0,0 +1,51 @@
+#ifndef BCIF_HH
+#define BCIF_HH
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+/// A decoded BinaryCIF column. String columns are stored as a table
+/// of the distinct values and the index of the value in each row.
+struct BcifColumn {
+    enum Type { INT,
+                FLOAT,
+                STRING };
+
+    /// Stores the value of a row as it would appear in a text CIF
+    /// file in out, '.' or '?' if the value is missing.
+    void text(size_t row, std::string &out) const;
+
+    /// The value of a row as a number, 0 if it is missing.
+    double number(size_t row) const;
+
+    Type type;
+    std::vector<int32_t> ints; ///< values or indices in strings
+    std::vector<double> floats;
+    std::vector<std::string> strings;
+    std::vector<uint8_t> mask; ///< 0: present, 1: '.', 2: '?', empty if no values are missing
+};
+
+/// The columns of a category in one data block of a BinaryCIF file.
+struct BcifCategory {
+    std::string block; ///< data block header
+    size_t row_count;
+    std::vector<BcifColumn> columns;
+};
+
+/// Reads a BinaryCIF file and decodes the requested columns of a
+/// category ("_atom_site" for example), in each data block where the
+/// category has all of them. The columns are in the requested order.
+/// Other columns are skipped without being decoded. Throws
+/// std::runtime_error if the input is invalid.
+std::vector<BcifCategory>
+freesasa_bcif_read_category(std::FILE *input,
+                            const std::string &category,
+                            const std::vector<std::string> &columns);
+
+/// Checks if input looks like BinaryCIF (starts with a MessagePack
+/// map) without consuming it.
+bool freesasa_is_bcif(std::FILE *input);
+
+#endif /* BCIF_HH */
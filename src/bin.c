@@ -0,0 +1,784 @@
+#if HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include <assert.h>
+#include <errno.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "freesasa_internal.h"
+
+/**
+    Binary result files (see freesasa_result_map()) are stored as a
+    header, followed by a table of structures and then one section
+    per column: the first residue of each chain, the first atom of
+    each residue, chain labels, residue names, residue numbers, atom
+    names, atom classes, main-chain flags, atom radii, atom areas,
+    residue areas, chain areas and finally the strings referred to by
+    the structure table. Each section starts at a multiple of 8
+    bytes.
+
+    All values are little-endian, integers have 32 bits and areas
+    and radii are IEEE floats with 4 or 8 bytes, as given by the
+    header. The layout of a structure record is that of
+    ::freesasa_mapped_structure.
+ */
+#define BIN_MAGIC "FSAREAS"
+#define BIN_VERSION 1
+#define BIN_STRUCTURE_SIZE 96
+#define BIN_N_AREAS 6
+
+struct bin_header {
+    char magic[8];
+    uint32_t version;
+    uint32_t area_size;
+    uint32_t n_structures;
+    uint32_t n_chains;
+    uint32_t n_residues;
+    uint32_t n_atoms;
+    uint32_t string_size;
+    uint32_t reserved;
+};
+
+/* Offsets of the sections of a file */
+struct bin_layout {
+    size_t structure;
+    size_t chain_residues;
+    size_t residue_atoms;
+    size_t chain_label;
+    size_t residue_name;
+    size_t residue_number;
+    size_t atom_name;
+    size_t atom_class;
+    size_t atom_mainchain;
+    size_t atom_radius;
+    size_t atom_area;
+    size_t residue_area;
+    size_t chain_area;
+    size_t strings;
+    size_t end;
+};
+
+struct bin_writer {
+    FILE *output;
+    size_t offset;
+    int area_size;
+    freesasa_node **structure;
+    int n_structures;
+    uint32_t counter; /* running index for the offset columns */
+};
+
+/* A mapped result and the memory it points into */
+struct mapped_result {
+    freesasa_mapped_result map;
+    void *data;
+    size_t size;
+    int mapped;
+};
+
+/* Rounds size up to the next multiple of 8 */
+static size_t
+bin_pad(size_t size)
+{
+    return (size + 7) & ~(size_t)7;
+}
+
+static void
+bin_layout(struct bin_layout *layout,
+           const struct bin_header *header)
+{
+    const size_t area_size = header->area_size,
+                 name_size = FREESASA_MAPPED_NAME_SIZE;
+
+    layout->structure = bin_pad(sizeof(struct bin_header));
+    layout->chain_residues = layout->structure +
+                             bin_pad((size_t)header->n_structures * BIN_STRUCTURE_SIZE);
+    layout->residue_atoms = layout->chain_residues +
+                            bin_pad(((size_t)header->n_chains + 1) * sizeof(uint32_t));
+    layout->chain_label = layout->residue_atoms +
+                          bin_pad(((size_t)header->n_residues + 1) * sizeof(uint32_t));
+    layout->residue_name = layout->chain_label + bin_pad(header->n_chains);
+    layout->residue_number = layout->residue_name + bin_pad((size_t)header->n_residues * name_size);
+    layout->atom_name = layout->residue_number + bin_pad((size_t)header->n_residues * name_size);
+    layout->atom_class = layout->atom_name + bin_pad((size_t)header->n_atoms * name_size);
+    layout->atom_mainchain = layout->atom_class + bin_pad(header->n_atoms);
+    layout->atom_radius = layout->atom_mainchain + bin_pad(header->n_atoms);
+    layout->atom_area = layout->atom_radius + bin_pad((size_t)header->n_atoms * area_size);
+    layout->residue_area = layout->atom_area + bin_pad((size_t)header->n_atoms * area_size);
+    layout->chain_area = layout->residue_area +
+                         bin_pad((size_t)header->n_residues * BIN_N_AREAS * area_size);
+    layout->strings = layout->chain_area +
+                      bin_pad((size_t)header->n_chains * BIN_N_AREAS * area_size);
+    layout->end = layout->strings + header->string_size;
+}
+
+static int
+bin_host_is_little_endian(void)
+{
+    const uint32_t one = 1;
+    return *(const unsigned char *)&one == 1;
+}
+
+static void
+bin_bytes(struct bin_writer *writer,
+          const void *data,
+          size_t n)
+{
+    fwrite(data, 1, n, writer->output);
+    writer->offset += n;
+}
+
+static void
+bin_u32(struct bin_writer *writer,
+        uint32_t value)
+{
+    unsigned char b[4];
+    int i;
+
+    for (i = 0; i < 4; ++i) {
+        b[i] = (value >> (8 * i)) & 0xff;
+    }
+    bin_bytes(writer, b, 4);
+}
+
+static void
+bin_double(struct bin_writer *writer,
+           double value)
+{
+    unsigned char b[8];
+    uint64_t u;
+    int i;
+
+    memcpy(&u, &value, sizeof(u));
+    for (i = 0; i < 8; ++i) {
+        b[i] = (u >> (8 * i)) & 0xff;
+    }
+    bin_bytes(writer, b, 8);
+}
+
+static void
+bin_area(struct bin_writer *writer,
+         double value)
+{
+    float f = (float)value;
+    uint32_t u;
+
+    if (writer->area_size == sizeof(double)) {
+        bin_double(writer, value);
+    } else {
+        memcpy(&u, &f, sizeof(u));
+        bin_u32(writer, u);
+    }
+}
+
+static void
+bin_nodearea(struct bin_writer *writer,
+             const freesasa_nodearea *area)
+{
+    bin_area(writer, area->total);
+    bin_area(writer, area->main_chain);
+    bin_area(writer, area->side_chain);
+    bin_area(writer, area->polar);
+    bin_area(writer, area->apolar);
+    bin_area(writer, area->unknown);
+}
+
+/* Names have been checked to fit by bin_count() */
+static void
+bin_name(struct bin_writer *writer,
+         const char *name)
+{
+    char buf[FREESASA_MAPPED_NAME_SIZE] = {0};
+
+    memcpy(buf, name, strlen(name));
+    bin_bytes(writer, buf, sizeof(buf));
+}
+
+/* Pads with zeros to next section */
+static void
+bin_align(struct bin_writer *writer,
+          size_t section)
+{
+    const char zeros[8] = {0};
+
+    bin_bytes(writer, zeros, bin_pad(writer->offset) - writer->offset);
+    assert(writer->offset == section);
+}
+
+static const char *
+bin_string(const char *str)
+{
+    return str ? str : "";
+}
+
+static int
+bin_check_name(const char *name)
+{
+    if (strlen(name) >= FREESASA_MAPPED_NAME_SIZE) {
+        return fail_msg("name '%s' is too long for binary output, "
+                        "the limit is %d characters",
+                        name, FREESASA_MAPPED_NAME_SIZE - 1);
+    }
+    return FREESASA_SUCCESS;
+}
+
+/* Counts nodes, and checks that there is atom data and that names fit */
+static int
+bin_count(struct bin_header *header,
+          struct bin_writer *writer,
+          freesasa_node *root)
+{
+    freesasa_node *result, *structure, *chain, *residue;
+    const char *name;
+    double radius;
+    freesasa_atom_class the_class;
+    int is_bb, i, first, n_structures = 0;
+
+    for (result = freesasa_node_children(root); result != NULL;
+         result = freesasa_node_next(result)) {
+        for (structure = freesasa_node_children(result); structure != NULL;
+             structure = freesasa_node_next(structure)) {
+            if (writer->structure) writer->structure[n_structures] = structure;
+            ++n_structures;
+            if (writer->structure) continue;
+
+            header->string_size += strlen(bin_string(freesasa_node_name(result))) + 1 +
+                                   strlen(bin_string(freesasa_node_classified_by(result))) + 1;
+
+            if (freesasa_node_structure_n_atoms(structure) > 0 &&
+                (freesasa_node_children(structure) == NULL ||
+                 freesasa_node_structure_atom(structure, 0, &name, &radius, &the_class, &is_bb))) {
+                return fail_msg("binary output needs a result tree with atoms");
+            }
+
+            for (chain = freesasa_node_children(structure); chain != NULL;
+                 chain = freesasa_node_next(chain)) {
+                ++header->n_chains;
+                for (residue = freesasa_node_children(chain); residue != NULL;
+                     residue = freesasa_node_next(residue)) {
+                    ++header->n_residues;
+                    if (bin_check_name(freesasa_node_name(residue)) ||
+                        bin_check_name(freesasa_node_residue_number(residue))) {
+                        return fail_msg("");
+                    }
+                    first = freesasa_node_residue_first_atom(residue);
+                    for (i = 0; i < freesasa_node_residue_n_atoms(residue); ++i) {
+                        freesasa_node_structure_atom(structure, first + i, &name,
+                                                     &radius, &the_class, &is_bb);
+                        if (bin_check_name(name)) return fail_msg("");
+                    }
+                    header->n_atoms += freesasa_node_residue_n_atoms(residue);
+                }
+            }
+        }
+    }
+    header->n_structures = n_structures;
+
+    return FREESASA_SUCCESS;
+}
+
+static void
+bin_structures(struct bin_writer *writer)
+{
+    freesasa_node *structure, *result, *chain, *residue;
+    const freesasa_parameters *parameters;
+    const freesasa_nodearea *area;
+    uint32_t first_chain = 0, first_atom = 0, n_chains, n_atoms, string = 0;
+    int i;
+
+    for (i = 0; i < writer->n_structures; ++i) {
+        structure = writer->structure[i];
+        result = freesasa_node_parent(structure);
+        parameters = freesasa_node_result_parameters(result);
+        area = freesasa_node_area(structure);
+
+        n_chains = n_atoms = 0;
+        for (chain = freesasa_node_children(structure); chain != NULL;
+             chain = freesasa_node_next(chain)) {
+            ++n_chains;
+            for (residue = freesasa_node_children(chain); residue != NULL;
+                 residue = freesasa_node_next(residue)) {
+                n_atoms += freesasa_node_residue_n_atoms(residue);
+            }
+        }
+
+        bin_u32(writer, first_chain);
+        bin_u32(writer, n_chains);
+        bin_u32(writer, first_atom);
+        bin_u32(writer, n_atoms);
+        bin_u32(writer, (uint32_t)freesasa_node_structure_model(structure));
+        bin_u32(writer, string);
+        string += strlen(bin_string(freesasa_node_name(result))) + 1;
+        bin_u32(writer, string);
+        string += strlen(bin_string(freesasa_node_classified_by(result))) + 1;
+        bin_u32(writer, parameters->alg);
+        bin_u32(writer, parameters->alg == FREESASA_SHRAKE_RUPLEY ? parameters->shrake_rupley_n_points : parameters->lee_richards_n_slices);
+        bin_u32(writer, 0);
+        bin_double(writer, parameters->probe_radius);
+        bin_double(writer, area->total);
+        bin_double(writer, area->main_chain);
+        bin_double(writer, area->side_chain);
+        bin_double(writer, area->polar);
+        bin_double(writer, area->apolar);
+        bin_double(writer, area->unknown);
+
+        first_chain += n_chains;
+        first_atom += n_atoms;
+    }
+}
+
+static void
+bin_foreach_chain(struct bin_writer *writer,
+                  void (*write)(struct bin_writer *, freesasa_node *))
+{
+    freesasa_node *chain;
+    int i;
+
+    for (i = 0; i < writer->n_structures; ++i) {
+        for (chain = freesasa_node_children(writer->structure[i]); chain != NULL;
+             chain = freesasa_node_next(chain)) {
+            write(writer, chain);
+        }
+    }
+}
+
+static void
+bin_foreach_residue(struct bin_writer *writer,
+                    void (*write)(struct bin_writer *, freesasa_node *))
+{
+    freesasa_node *chain, *residue;
+    int i;
+
+    for (i = 0; i < writer->n_structures; ++i) {
+        for (chain = freesasa_node_children(writer->structure[i]); chain != NULL;
+             chain = freesasa_node_next(chain)) {
+            for (residue = freesasa_node_children(chain); residue != NULL;
+                 residue = freesasa_node_next(residue)) {
+                write(writer, residue);
+            }
+        }
+    }
+}
+
+/* Atoms are visited in residue order, with their index in the structure */
+static void
+bin_foreach_atom(struct bin_writer *writer,
+                 void (*write)(struct bin_writer *, const freesasa_node *, int))
+{
+    freesasa_node *structure, *chain, *residue;
+    int i, j, first;
+
+    for (i = 0; i < writer->n_structures; ++i) {
+        structure = writer->structure[i];
+        for (chain = freesasa_node_children(structure); chain != NULL;
+             chain = freesasa_node_next(chain)) {
+            for (residue = freesasa_node_children(chain); residue != NULL;
+                 residue = freesasa_node_next(residue)) {
+                first = freesasa_node_residue_first_atom(residue);
+                for (j = 0; j < freesasa_node_residue_n_atoms(residue); ++j) {
+                    write(writer, structure, first + j);
+                }
+            }
+        }
+    }
+}
+
+static void
+bin_chain_residues(struct bin_writer *writer,
+                   freesasa_node *chain)
+{
+    bin_u32(writer, writer->counter);
+    writer->counter += freesasa_node_chain_n_residues(chain);
+}
+
+static void
+bin_chain_label(struct bin_writer *writer,
+                freesasa_node *chain)
+{
+    bin_bytes(writer, freesasa_node_name(chain), 1);
+}
+
+static void
+bin_chain_area(struct bin_writer *writer,
+               freesasa_node *chain)
+{
+    bin_nodearea(writer, freesasa_node_area(chain));
+}
+
+static void
+bin_residue_atoms(struct bin_writer *writer,
+                  freesasa_node *residue)
+{
+    bin_u32(writer, writer->counter);
+    writer->counter += freesasa_node_residue_n_atoms(residue);
+}
+
+static void
+bin_residue_name(struct bin_writer *writer,
+                 freesasa_node *residue)
+{
+    bin_name(writer, freesasa_node_name(residue));
+}
+
+static void
+bin_residue_number(struct bin_writer *writer,
+                   freesasa_node *residue)
+{
+    bin_name(writer, freesasa_node_residue_number(residue));
+}
+
+static void
+bin_residue_area(struct bin_writer *writer,
+                 freesasa_node *residue)
+{
+    bin_nodearea(writer, freesasa_node_area(residue));
+}
+
+static void
+bin_atom_name(struct bin_writer *writer,
+              const freesasa_node *structure,
+              int i)
+{
+    const char *name;
+    double radius;
+    freesasa_atom_class the_class;
+    int is_bb;
+
+    freesasa_node_structure_atom(structure, i, &name, &radius, &the_class, &is_bb);
+    bin_name(writer, name);
+}
+
+static void
+bin_atom_class(struct bin_writer *writer,
+               const freesasa_node *structure,
+               int i)
+{
+    const char *name;
+    double radius;
+    freesasa_atom_class the_class;
+    int is_bb;
+    unsigned char c;
+
+    freesasa_node_structure_atom(structure, i, &name, &radius, &the_class, &is_bb);
+    c = the_class;
+    bin_bytes(writer, &c, 1);
+}
+
+static void
+bin_atom_mainchain(struct bin_writer *writer,
+                   const freesasa_node *structure,
+                   int i)
+{
+    const char *name;
+    double radius;
+    freesasa_atom_class the_class;
+    int is_bb;
+    unsigned char c;
+
+    freesasa_node_structure_atom(structure, i, &name, &radius, &the_class, &is_bb);
+    c = is_bb ? 1 : 0;
+    bin_bytes(writer, &c, 1);
+}
+
+static void
+bin_atom_radius(struct bin_writer *writer,
+                const freesasa_node *structure,
+                int i)
+{
+    const char *name;
+    double radius;
+    freesasa_atom_class the_class;
+    int is_bb;
+
+    freesasa_node_structure_atom(structure, i, &name, &radius, &the_class, &is_bb);
+    bin_area(writer, radius);
+}
+
+static void
+bin_atom_area(struct bin_writer *writer,
+              const freesasa_node *structure,
+              int i)
+{
+    bin_area(writer, freesasa_node_structure_result(structure)->sasa[i]);
+}
+
+static void
+bin_strings(struct bin_writer *writer)
+{
+    freesasa_node *result;
+    const char *str;
+    int i;
+
+    for (i = 0; i < writer->n_structures; ++i) {
+        result = freesasa_node_parent(writer->structure[i]);
+        str = bin_string(freesasa_node_name(result));
+        bin_bytes(writer, str, strlen(str) + 1);
+        str = bin_string(freesasa_node_classified_by(result));
+        bin_bytes(writer, str, strlen(str) + 1);
+    }
+}
+
+int freesasa_write_bin(FILE *output,
+                       freesasa_node *root,
+                       int options)
+{
+    struct bin_header header;
+    struct bin_layout layout;
+    struct bin_writer writer;
+    int ret = FREESASA_FAIL;
+
+    assert(output);
+    assert(freesasa_node_type(root) == FREESASA_NODE_ROOT);
+
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, BIN_MAGIC, sizeof(header.magic));
+    header.version = BIN_VERSION;
+    header.area_size = (options & FREESASA_BIN_FLOAT) ? sizeof(float) : sizeof(double);
+
+    writer.output = output;
+    writer.offset = 0;
+    writer.area_size = header.area_size;
+    writer.structure = NULL;
+    writer.counter = 0;
+
+    if (bin_count(&header, &writer, root)) {
+        return fail_msg("");
+    }
+    writer.n_structures = header.n_structures;
+    if (header.n_structures > 0) {
+        writer.structure = malloc(sizeof(freesasa_node *) * header.n_structures);
+        if (writer.structure == NULL) {
+            return mem_fail();
+        }
+        bin_count(&header, &writer, root);
+    }
+    bin_layout(&layout, &header);
+
+    bin_bytes(&writer, header.magic, sizeof(header.magic));
+    bin_u32(&writer, header.version);
+    bin_u32(&writer, header.area_size);
+    bin_u32(&writer, header.n_structures);
+    bin_u32(&writer, header.n_chains);
+    bin_u32(&writer, header.n_residues);
+    bin_u32(&writer, header.n_atoms);
+    bin_u32(&writer, header.string_size);
+    bin_u32(&writer, header.reserved);
+
+    bin_align(&writer, layout.structure);
+    bin_structures(&writer);
+
+    bin_align(&writer, layout.chain_residues);
+    bin_foreach_chain(&writer, bin_chain_residues);
+    bin_u32(&writer, writer.counter);
+
+    bin_align(&writer, layout.residue_atoms);
+    writer.counter = 0;
+    bin_foreach_residue(&writer, bin_residue_atoms);
+    bin_u32(&writer, writer.counter);
+
+    bin_align(&writer, layout.chain_label);
+    bin_foreach_chain(&writer, bin_chain_label);
+    bin_align(&writer, layout.residue_name);
+    bin_foreach_residue(&writer, bin_residue_name);
+    bin_align(&writer, layout.residue_number);
+    bin_foreach_residue(&writer, bin_residue_number);
+    bin_align(&writer, layout.atom_name);
+    bin_foreach_atom(&writer, bin_atom_name);
+    bin_align(&writer, layout.atom_class);
+    bin_foreach_atom(&writer, bin_atom_class);
+    bin_align(&writer, layout.atom_mainchain);
+    bin_foreach_atom(&writer, bin_atom_mainchain);
+    bin_align(&writer, layout.atom_radius);
+    bin_foreach_atom(&writer, bin_atom_radius);
+    bin_align(&writer, layout.atom_area);
+    bin_foreach_atom(&writer, bin_atom_area);
+    bin_align(&writer, layout.residue_area);
+    bin_foreach_residue(&writer, bin_residue_area);
+    bin_align(&writer, layout.chain_area);
+    bin_foreach_chain(&writer, bin_chain_area);
+    bin_align(&writer, layout.strings);
+    bin_strings(&writer);
+    assert(writer.offset == layout.end);
+
+    fflush(output);
+    if (ferror(output)) {
+        fail_msg(strerror(errno));
+        goto cleanup;
+    }
+
+    ret = FREESASA_SUCCESS;
+
+cleanup:
+    free(writer.structure);
+    return ret;
+}
+
+/* Checks that an offset column is increasing and ends with last */
+static int
+bin_check_offsets(const uint32_t *offset,
+                  uint32_t n,
+                  uint32_t last)
+{
+    uint32_t i;
+
+    if (offset[0] != 0 || offset[n] != last) return FREESASA_FAIL;
+    for (i = 0; i < n; ++i) {
+        if (offset[i] > offset[i + 1]) return FREESASA_FAIL;
+    }
+    return FREESASA_SUCCESS;
+}
+
+static int
+bin_check_names(const char (*name)[FREESASA_MAPPED_NAME_SIZE],
+                uint32_t n)
+{
+    uint32_t i;
+
+    for (i = 0; i < n; ++i) {
+        if (name[i][FREESASA_MAPPED_NAME_SIZE - 1] != '\0') return FREESASA_FAIL;
+    }
+    return FREESASA_SUCCESS;
+}
+
+/* Sets up the columns of the map, checks that all indices are within bounds */
+static int
+bin_map(freesasa_mapped_result *map,
+        const char *data,
+        size_t size)
+{
+    struct bin_header header;
+    struct bin_layout layout;
+    const freesasa_mapped_structure *s;
+    uint32_t i;
+
+    if (size < sizeof(header)) {
+        return fail_msg("binary result file is truncated");
+    }
+    memcpy(&header, data, sizeof(header));
+
+    if (memcmp(header.magic, BIN_MAGIC, sizeof(header.magic)) != 0) {
+        return fail_msg("not a binary result file");
+    }
+    if (!bin_host_is_little_endian() ||
+        sizeof(unsigned int) != sizeof(uint32_t) ||
+        sizeof(freesasa_mapped_structure) != BIN_STRUCTURE_SIZE) {
+        return fail_msg("binary result files can not be mapped on this platform");
+    }
+    if (header.version != BIN_VERSION) {
+        return fail_msg("binary result file has version %d, expected %d",
+                        header.version, BIN_VERSION);
+    }
+    if ((header.area_size != sizeof(float) && header.area_size != sizeof(double)) ||
+        header.n_structures > size || header.n_chains > size ||
+        header.n_residues > size || header.n_atoms > size) {
+        return fail_msg("binary result file is corrupt");
+    }
+    bin_layout(&layout, &header);
+    if (layout.end > size) {
+        return fail_msg("binary result file is truncated");
+    }
+
+    map->n_structures = header.n_structures;
+    map->n_chains = header.n_chains;
+    map->n_residues = header.n_residues;
+    map->n_atoms = header.n_atoms;
+    map->area_size = header.area_size;
+    map->structure = (const freesasa_mapped_structure *)(data + layout.structure);
+    map->chain_residues = (const unsigned int *)(data + layout.chain_residues);
+    map->residue_atoms = (const unsigned int *)(data + layout.residue_atoms);
+    map->chain_label = data + layout.chain_label;
+    map->residue_name = (const char(*)[FREESASA_MAPPED_NAME_SIZE])(data + layout.residue_name);
+    map->residue_number = (const char(*)[FREESASA_MAPPED_NAME_SIZE])(data + layout.residue_number);
+    map->atom_name = (const char(*)[FREESASA_MAPPED_NAME_SIZE])(data + layout.atom_name);
+    map->atom_class = (const unsigned char *)(data + layout.atom_class);
+    map->atom_mainchain = (const unsigned char *)(data + layout.atom_mainchain);
+    map->atom_radius = data + layout.atom_radius;
+    map->atom_area = data + layout.atom_area;
+    map->residue_area = data + layout.residue_area;
+    map->chain_area = data + layout.chain_area;
+    map->strings = data + layout.strings;
+
+    if (bin_check_offsets(map->chain_residues, header.n_chains, header.n_residues) ||
+        bin_check_offsets(map->residue_atoms, header.n_residues, header.n_atoms) ||
+        bin_check_names(map->residue_name, header.n_residues) ||
+        bin_check_names(map->residue_number, header.n_residues) ||
+        bin_check_names(map->atom_name, header.n_atoms) ||
+        (header.string_size > 0 && map->strings[header.string_size - 1] != '\0')) {
+        return fail_msg("binary result file is corrupt");
+    }
+    for (i = 0; i < header.n_structures; ++i) {
+        s = &map->structure[i];
+        if (s->first_chain > header.n_chains || s->n_chains > header.n_chains - s->first_chain ||
+            s->first_atom > header.n_atoms || s->n_atoms > header.n_atoms - s->first_atom ||
+            s->name >= header.string_size || s->classified_by >= header.string_size) {
+            return fail_msg("binary result file is corrupt");
+        }
+    }
+
+    return FREESASA_SUCCESS;
+}
+
+freesasa_mapped_result *
+freesasa_result_map(const char *filename)
+{
+    struct mapped_result *result = NULL;
+    FILE *input;
+
+    assert(filename);
+
+    input = fopen(filename, "rb");
+    if (input == NULL) {
+        fail_msg("could not open file '%s': %s", filename, strerror(errno));
+        return NULL;
+    }
+
+    result = malloc(sizeof(struct mapped_result));
+    if (result == NULL) {
+        mem_fail();
+        goto cleanup;
+    }
+
+    result->mapped = freesasa_file_map(input, &result->data, &result->size);
+    if (result->mapped == FREESASA_FAIL) {
+        free(result);
+        result = NULL;
+        fail_msg("");
+        goto cleanup;
+    }
+
+    if (bin_map(&result->map, result->data, result->size)) {
+        fail_msg("could not read binary results from '%s'", filename);
+        freesasa_mapped_result_free(&result->map);
+        result = NULL;
+    }
+
+cleanup:
+    fclose(input);
+    return result ? &result->map : NULL;
+}
+
+double
+freesasa_mapped_result_value(const freesasa_mapped_result *map,
+                             const void *column,
+                             int i)
+{
+    assert(map);
+    assert(column);
+
+    if (map->area_size == sizeof(float)) {
+        return ((const float *)column)[i];
+    }
+    return ((const double *)column)[i];
+}
+
+void freesasa_mapped_result_free(freesasa_mapped_result *map)
+{
+    struct mapped_result *result = (struct mapped_result *)map;
+
+    if (result != NULL) {
+        freesasa_file_unmap(result->data, result->size, result->mapped);
+        free(result);
+    }
+}
@@ -1,188 +1,510 @@
 #include <algorithm>
 #include <cassert>
 #include <cmath>
-#include <fstream>
+#include <deque>
 #include <iostream>
+#include <map>
 #include <memory>
-#include <set>
+#include <stdexcept>
 #include <string>
+#include <unordered_map>
 
 #include <gemmi/cif.hpp>
-#include <gemmi/mmcif.hpp>
 
 #define GEMMI_WRITE_IMPLEMENTATION
 #include <gemmi/to_cif.hpp>
 #undef GEMMI_WRITE_IMPLEMENTATION
 
+#include "bcif.hh"
 #include "cif.hh"
 #include "freesasa.h"
 
+/* Documents are only kept when they are needed for CIF output, and
+   released by freesasa_export_tree_to_cif() */
 static std::vector<gemmi::cif::Document> docs;
 
-struct ModelDiscriminator {
-    ModelDiscriminator(const std::string &model_name,
-                       const int model_col = 11)
-        : _model_name(model_name), _model_col(model_col)
+static const auto atom_site_columns = std::vector<std::string>({
+    "group_PDB",
+    "auth_asym_id",
+    "auth_seq_id",
+    "pdbx_PDB_ins_code",
+    "auth_comp_id",
+    "auth_atom_id",
+    "label_alt_id",
+    "type_symbol",
+    "Cartn_x",
+    "Cartn_y",
+    "Cartn_z",
+    "pdbx_PDB_model_num",
+});
+
+/* The _atom_site rows of a parsed document */
+class DocumentSites
+{
+public:
+    explicit DocumentSites(gemmi::cif::Document &doc) : _doc(doc) {}
+
+    template <typename F>
+    void for_each(F f)
     {
+        for (auto &block : _doc.blocks) {
+            for (auto site : block.find("_atom_site.", atom_site_columns)) {
+                f(site);
+            }
+        }
     }
 
-    bool operator()(const gemmi::cif::Table::Row &site) const
+    std::string name() const
     {
-        return _model_name != site[_model_col];
+        return _doc.blocks.empty() ? std::string{} : _doc.blocks[0].name;
     }
 
 private:
-    const std::string _model_name;
-    int _model_col;
+    gemmi::cif::Document &_doc;
 };
 
-struct ModelSetDiscriminator {
-    ModelSetDiscriminator(const std::set<int> models,
-                          const int model_col = 11)
-        : _models(models), _model_col(model_col)
+/* Reads the _atom_site rows of a CIF file as it goes, without building
+   a document, so memory use doesn't grow with the size of the file.
+   Values are kept as in the file, including quotes, like in gemmi
+   documents. Only the columns in atom_site_columns are stored. A block
+   with a single atom can have _atom_site items instead of a loop, these
+   are collected and returned as one row at the end of the block. */
+class AtomSiteReader
+{
+public:
+    explicit AtomSiteReader(std::FILE *input)
+        : _input(input), _row(atom_site_columns.size()),
+          _pair_row(atom_site_columns.size()),
+          _has_pair(atom_site_columns.size(), false)
     {
     }
 
-    bool operator()(const gemmi::cif::Table::Row &site) const
+    template <typename F>
+    void for_each(F f)
     {
-        return _models.count(std::stoi(site[_model_col])) == 0;
+        while (next_row()) {
+            f(*this);
+        }
     }
 
+    const std::string &operator[](int n) const { return _row[n]; }
+
+    const std::string &name() const { return _name; }
+
 private:
-    const std::set<int> _models;
-    int _model_col;
-};
+    enum State { NONE,
+                 PAIR_VALUE,
+                 LOOP_TAGS,
+                 LOOP_VALUES };
+
+    /* Reads the next complete row of an _atom_site loop, or the row
+       made up of the _atom_site items of a block, returns false at end
+       of file */
+    bool next_row()
+    {
+        std::string token;
+
+        while (next_token(token)) {
+            switch (_state) {
+            case PAIR_VALUE:
+                if (_pair_column >= 0) {
+                    _pair_row[_pair_column] = token;
+                    _has_pair[_pair_column] = true;
+                }
+                _state = NONE;
+                break;
+            case LOOP_TAGS:
+                if (token[0] == '_') {
+                    add_tag(token);
+                    break;
+                }
+                start_values();
+                // fall through
+            case LOOP_VALUES:
+                if (!is_keyword(token)) {
+                    if (add_value(token)) return true;
+                    break;
+                }
+                _state = NONE;
+                // fall through
+            case NONE:
+                if (token.compare(0, 5, "data_") == 0) {
+                    if (_name.empty()) _name = token.substr(5);
+                    if (pair_row()) return true;
+                } else if (token == "loop_") {
+                    _state = LOOP_TAGS;
+                    _column.clear();
+                    _is_atom_site = true;
+                } else if (token[0] == '_') {
+                    _state = PAIR_VALUE;
+                    _pair_column = column(token);
+                }
+                break;
+            }
+        }
+        return pair_row();
+    }
 
-struct ChainDiscriminator {
-    ChainDiscriminator(const std::string &model_name, const std::string &chain_name,
-                       const int model_col = 11, const int chain_col = 1)
-        : _model_name(model_name), _chain_name(chain_name),
-          _model_col(model_col), _chain_col(chain_col)
+    /* Called at the end of a block, returns true if the block had
+       all the columns as _atom_site items, which are then the row */
+    bool pair_row()
     {
+        bool complete = std::find(_has_pair.begin(), _has_pair.end(), false) == _has_pair.end();
+
+        if (complete) _row.swap(_pair_row);
+        std::fill(_has_pair.begin(), _has_pair.end(), false);
+
+        return complete;
     }
 
-    bool operator()(const gemmi::cif::Table::Row &site) const
+    /* Index in atom_site_columns, or -1 if the tag isn't one of them */
+    static int column(const std::string &tag)
     {
-        return _model_name != site[_model_col] || _chain_name != site[_chain_col];
+        const std::string prefix{"_atom_site."};
+
+        if (tag.compare(0, prefix.size(), prefix) != 0) return -1;
+
+        auto found = std::find(atom_site_columns.begin(), atom_site_columns.end(),
+                               tag.substr(prefix.size()));
+        if (found == atom_site_columns.end()) return -1;
+
+        return found - atom_site_columns.begin();
     }
 
-private:
-    const std::string _model_name, _chain_name;
-    int _model_col, _chain_col;
-};
+    static bool is_keyword(const std::string &token)
+    {
+        return token[0] == '_' || token == "loop_" ||
+               token.compare(0, 5, "data_") == 0 ||
+               token.compare(0, 5, "save_") == 0;
+    }
 
-static std::unique_ptr<std::set<int>>
-get_models(const gemmi::cif::Document &doc)
-{
-    auto models = std::make_unique<std::set<int>>();
-    for (auto block : doc.blocks) {
-        for (auto site : block.find("_atom_site.", {"pdbx_PDB_model_num"})) {
-            models->insert(gemmi::cif::as_int(site[0]));
+    void add_tag(const std::string &tag)
+    {
+        if (tag.compare(0, 11, "_atom_site.") != 0) _is_atom_site = false;
+        _column.push_back(column(tag));
+    }
+
+    /* Rows are only read from loops that have all the columns */
+    void start_values()
+    {
+        _state = LOOP_VALUES;
+        _n_values = 0;
+        for (size_t i = 0; _is_atom_site && i < atom_site_columns.size(); ++i) {
+            _is_atom_site = std::find(_column.begin(), _column.end(), (int)i) != _column.end();
         }
     }
-    return models;
-}
 
-static std::unique_ptr<std::set<std::string>>
-get_chains(const gemmi::cif::Document &doc)
-{
-    auto chains = std::make_unique<std::set<std::string>>();
-    for (auto block : doc.blocks) {
-        for (auto site : block.find("_atom_site.", {"auth_asym_id"})) {
-            chains->insert(site[0]);
+    /* Returns true if the value completes a row */
+    bool add_value(const std::string &value)
+    {
+        int column = _column[_n_values];
+
+        if (_is_atom_site && column >= 0) _row[column] = value;
+        if (++_n_values < _column.size()) return false;
+        _n_values = 0;
+
+        return _is_atom_site;
+    }
+
+    bool next_line()
+    {
+        char buf[1024];
+        size_t len;
+
+        _line.clear();
+        _pos = 0;
+        while (fgets(buf, sizeof buf, _input) != NULL) {
+            _line += buf;
+            len = _line.size();
+            if (_line[len - 1] == '\n') break;
         }
+        return !_line.empty();
     }
-    return chains;
-}
 
-static std::unique_ptr<std::set<std::string>>
-get_chains(const gemmi::Model &model)
+    bool next_token(std::string &token)
+    {
+        const char *whitespace = " \t\r\n";
+        size_t start, end;
+
+        for (;;) {
+            if (_pos >= _line.size() && !next_line()) return false;
+
+            // text field, the whole field is one value
+            if (_pos == 0 && _line[0] == ';') {
+                token = _line;
+                while (next_line() && _line[0] != ';') {
+                    token += _line;
+                }
+                if (_line.empty()) return true;
+                token += ";";
+                _pos = 1;
+                return true;
+            }
+
+            start = _line.find_first_not_of(whitespace, _pos);
+            if (start == std::string::npos || _line[start] == '#') {
+                _pos = _line.size();
+                continue;
+            }
+
+            if (_line[start] == '\'' || _line[start] == '"') {
+                // the quote has to be followed by whitespace to end the value
+                end = start + 1;
+                while ((end = _line.find(_line[start], end)) != std::string::npos &&
+                       end + 1 < _line.size() && !isspace((unsigned char)_line[end + 1])) {
+                    ++end;
+                }
+                end = end == std::string::npos ? _line.size() : end + 1;
+            } else {
+                end = _line.find_first_of(whitespace, start);
+                if (end == std::string::npos) end = _line.size();
+            }
+
+            token.assign(_line, start, end - start);
+            _pos = end;
+            return true;
+        }
+    }
+
+    std::FILE *_input;
+    std::string _line, _name;
+    size_t _pos{0};
+    State _state{NONE};
+    std::vector<int> _column; // index in atom_site_columns for each tag, or -1
+    bool _is_atom_site{false};
+    size_t _n_values{0};
+    std::vector<std::string> _row;
+    int _pair_column{-1};                 // column of the pending item value
+    std::vector<std::string> _pair_row;   // _atom_site items of the block
+    std::vector<bool> _has_pair;
+};
+
+/* The _atom_site rows of a BinaryCIF file. The columns are decoded
+   up front, and a row is converted to text as it is visited, except
+   for the coordinates which are used as they are. */
+class BcifSites
 {
-    auto chains = std::make_unique<std::set<std::string>>();
+public:
+    explicit BcifSites(std::FILE *input)
+        : _blocks(freesasa_bcif_read_category(input, "_atom_site", atom_site_columns)),
+          _row(atom_site_columns.size())
+    {
+    }
 
-    for (auto &chain : model.chains) {
-        chains->insert(chain.name);
+    template <typename F>
+    void for_each(F f)
+    {
+        for (const auto &block : _blocks) {
+            _block = &block;
+            for (_index = 0; _index < block.row_count; ++_index) {
+                for (size_t i = 0; i < _row.size(); ++i) {
+                    if (i < 8 || i > 10) block.columns[i].text(_index, _row[i]);
+                }
+                f(*this);
+            }
+        }
     }
 
-    return chains;
+    const std::string &operator[](int n) const { return _row[n]; }
+
+    /// x, y and z for n = 0, 1, 2
+    double coordinate(int n) const { return _block->columns[8 + n].number(_index); }
+
+    std::string name() const
+    {
+        return _blocks.empty() ? std::string{} : _blocks[0].block;
+    }
+
+private:
+    std::vector<BcifCategory> _blocks;
+    const BcifCategory *_block{nullptr};
+    size_t _index{0};
+    std::vector<std::string> _row;
+};
+
+/* The coordinates of a row, x, y and z for n = 0, 1, 2 */
+template <typename Row>
+static double
+site_coordinate(const Row &site, int n)
+{
+    return atof(site[8 + n].c_str());
 }
 
-static const auto atom_site_columns = std::vector<std::string>({
-    "group_PDB",
-    "auth_asym_id",
-    "auth_seq_id",
-    "pdbx_PDB_ins_code",
-    "auth_comp_id",
-    "auth_atom_id",
-    "label_alt_id",
-    "type_symbol",
-    "Cartn_x",
-    "Cartn_y",
-    "Cartn_z",
-    "pdbx_PDB_model_num",
-});
+static double
+site_coordinate(const BcifSites &site, int n)
+{
+    return site.coordinate(n);
+}
 
-static freesasa_cif_atom
-freesasa_atom_from_site(const gemmi::cif::Table::Row &site)
+/* Adds an _atom_site row to a structure, unless it is excluded by the
+   structure options. prevAltId is the alt conformation of the
+   previous row added to the structure. */
+template <typename Row>
+static void
+add_site(freesasa_structure *structure,
+         char &prevAltId,
+         const Row &site,
+         const freesasa_classifier *classifier,
+         int structure_options)
 {
+    if (site[0] != "ATOM" && !(structure_options & FREESASA_INCLUDE_HETATM)) {
+        return;
+    }
 
-    std::unique_ptr<std::string> auth_atom_id;
-    // remove quotation marks if necessary
-    if (site[5][0] == '"') {
-        auth_atom_id = std::make_unique<std::string>(site[5].substr(1, site[5].size() - 2));
+    if (!(structure_options & FREESASA_INCLUDE_HYDROGEN) && site[7] == "H") {
+        return;
+    }
+
+    // Pick the first alternative conformation for an atom
+    auto currentAltId = site[6][0];
+    if ((currentAltId != '.' && prevAltId == '.') || currentAltId == '.') {
+        prevAltId = currentAltId;
+    } else if (currentAltId != '.' && currentAltId != prevAltId) {
+        return;
     }
 
-    return {
+    // remove quotation marks if necessary
+    const std::string auth_atom_id = site[5][0] == '"' ? site[5].substr(1, site[5].size() - 2) : site[5];
+
+    freesasa_cif_atom atom{
         .group_PDB = site[0].c_str(),
         .auth_asym_id = site[1][0],
         .auth_seq_id = site[2].c_str(),
         .pdbx_PDB_ins_code = site[3].c_str(),
         .auth_comp_id = site[4].c_str(),
-        .auth_atom_id = auth_atom_id ? std::move(*auth_atom_id).c_str() : site[5].c_str(),
+        .auth_atom_id = auth_atom_id.c_str(),
         .label_alt_id = site[6].c_str(),
         .type_symbol = site[7].c_str(),
-        .Cartn_x = atof(site[8].c_str()),
-        .Cartn_y = atof(site[9].c_str()),
-        .Cartn_z = atof(site[10].c_str())};
+        .Cartn_x = site_coordinate(site, 0),
+        .Cartn_y = site_coordinate(site, 1),
+        .Cartn_z = site_coordinate(site, 2)};
+
+    freesasa_structure_add_cif_atom(structure, &atom, classifier, structure_options);
 }
 
-template <typename T>
+/* Reads the first model (the one with the lowest number), or all
+   models as one structure if FREESASA_JOIN_MODELS is set */
+template <typename Sites>
 static freesasa_structure *
-structure_from_pred(const gemmi::cif::Document &doc,
-                    const T &discriminator,
-                    const freesasa_classifier *classifier,
-                    int structure_options)
+structure_from_sites(Sites &sites,
+                     const freesasa_classifier *classifier,
+                     int structure_options)
 {
     freesasa_structure *structure = freesasa_structure_new();
-    std::string auth_atom_id;
+    const bool join_models = structure_options & FREESASA_JOIN_MODELS;
+    std::string model_name; // of the previous row
+    int first_model = 0;
+    bool found_model = false, skip = false;
     char prevAltId = '.';
 
-    for (auto block : doc.blocks) {
-        for (auto site : block.find("_atom_site.", atom_site_columns)) {
-            if (site[0] != "ATOM" && !(structure_options & FREESASA_INCLUDE_HETATM)) {
-                continue;
+    sites.for_each([&](const auto &site) {
+        if (!join_models && site[11] != model_name) {
+            model_name = site[11];
+            int model = std::stoi(model_name);
+
+            /* the model number can only decrease the first time a
+               model is seen, so the atoms read so far can be dropped */
+            if (!found_model || model < first_model) {
+                if (found_model) {
+                    freesasa_structure_free(structure);
+                    structure = freesasa_structure_new();
+                    prevAltId = '.';
+                }
+                first_model = model;
+                found_model = true;
             }
+            skip = model != first_model;
+        }
+        if (skip) return;
 
-            if (discriminator(site)) continue;
+        add_site(structure, prevAltId, site, classifier, structure_options);
+    });
+    freesasa_structure_release_memo(structure);
 
-            freesasa_cif_atom atom = freesasa_atom_from_site(site);
+    return structure;
+}
 
-            if (!(structure_options & FREESASA_INCLUDE_HYDROGEN) && std::string(atom.type_symbol) == "H") {
-                continue;
+/* A structure being built by structure_array_from_sites() */
+struct StructureBuilder {
+    freesasa_structure *structure;
+    char prevAltId;
+};
+
+/* The structures of one model, by chain label (a single structure
+   with empty label if chains are not separated) */
+using ModelBuilder = std::map<std::string, StructureBuilder>;
+
+template <typename Sites>
+static std::vector<freesasa_structure *>
+structure_array_from_sites(Sites &sites,
+                           int *n,
+                           const freesasa_classifier *classifier,
+                           int options)
+{
+    const bool separate_chains = options & FREESASA_SEPARATE_CHAINS;
+    const std::string no_chain;
+
+    std::vector<freesasa_structure *> ss;
+    std::deque<ModelBuilder> models; // in the order they appear
+    std::map<std::string, size_t> model_index;
+    ModelBuilder *model = nullptr;
+    StructureBuilder *builder = nullptr;
+    const std::string *model_name = nullptr, *chain_name = nullptr;
+
+    /* Distribute the rows between models and chains in one pass. The
+       rows of a chain are normally consecutive, so the model and
+       builder of the previous row can usually be reused. */
+    sites.for_each([&](const auto &site) {
+        const std::string &site_model = site[11];
+        const std::string &site_chain = separate_chains ? site[1] : no_chain;
+
+        if (model == nullptr || *model_name != site_model) {
+            auto found = model_index.find(site_model);
+            if (found == model_index.end()) {
+                /* only keep first model if option not provided */
+                if (!models.empty() && !(options & FREESASA_SEPARATE_MODELS)) {
+                    model = nullptr;
+                    return;
+                }
+                found = model_index.emplace(site_model, models.size()).first;
+                models.emplace_back();
             }
+            model = &models[found->second];
+            model_name = &found->first;
+            builder = nullptr;
+        }
 
-            // Pick the first alternative conformation for an atom
-            auto currentAltId = site[6][0];
-            if ((currentAltId != '.' && prevAltId == '.') || currentAltId == '.') {
-                prevAltId = currentAltId;
-            } else if (currentAltId != '.' && currentAltId != prevAltId) {
-                continue;
+        if (builder == nullptr || *chain_name != site_chain) {
+            auto chain = model->find(site_chain);
+            if (chain == model->end()) {
+                chain = model->emplace(site_chain, StructureBuilder{freesasa_structure_new(), '.'}).first;
             }
+            builder = &chain->second;
+            chain_name = &chain->first;
+        }
 
-            freesasa_structure_add_cif_atom(structure, &atom, classifier, structure_options);
+        add_site(builder->structure, builder->prevAltId, site, classifier, options);
+    });
+
+    for (size_t i = 0; i < models.size(); ++i) {
+        for (auto &chain : models[i]) {
+            freesasa_structure *structure = chain.second.structure;
+            freesasa_structure_release_memo(structure);
+            if (separate_chains && freesasa_structure_n(structure) == 0) {
+                freesasa_structure_free(structure);
+                continue;
+            }
+            freesasa_structure_set_model(structure, i + 1);
+            ss.push_back(structure);
         }
     }
-    return structure;
+
+    if (separate_chains && ss.empty())
+        freesasa_fail("In %s(): No chains in any model in protein: %s.",
+                      __func__, sites.name().c_str());
+
+    *n = ss.size();
+    return ss;
 }
 
 static gemmi::cif::Document &
@@ -190,188 +512,177 @@ generate_gemmi_doc(std::FILE *input)
 {
     docs.emplace_back(gemmi::cif::read_cstream(input, 8192, "cif-input"));
     auto &doc = docs.back();
+    const std::string &name = doc.blocks[0].name;
 
-    gemmi::Structure gemmi_struct = gemmi::make_structure_from_block(doc.blocks[0]);
-
-    if (gemmi_struct.name.find(".cif") != std::string::npos) {
-        doc.source = gemmi_struct.name;
+    if (name.find(".cif") != std::string::npos) {
+        doc.source = name;
     } else {
-        doc.source = gemmi_struct.name + ".cif";
+        doc.source = name + ".cif";
     }
     transform(doc.source.begin(), doc.source.end(), doc.source.begin(), tolower);
 
     return doc;
 }
 
-freesasa_structure *
-freesasa_structure_from_cif(std::FILE *input,
-                            const freesasa_classifier *classifier,
-                            int structure_options)
+/* The input, or a decompressed copy of it if it is gzip compressed */
+class UnzippedInput
 {
-    auto &doc = generate_gemmi_doc(input);
-
-    const auto models = get_models(doc);
+public:
+    explicit UnzippedInput(std::FILE *input) : _file(input), _unzipped(nullptr)
+    {
+        if (freesasa_is_gzip(input)) {
+            _file = _unzipped = freesasa_gunzip(input);
+        }
+    }
 
-    std::unique_ptr<const ModelSetDiscriminator> discriminator;
-    if (structure_options & FREESASA_JOIN_MODELS) {
-        discriminator = std::make_unique<const ModelSetDiscriminator>(std::move(*models));
-    } else {
-        auto firstModel = models->begin();
-        auto singleModel = std::set<int>{*firstModel};
-        discriminator = std::make_unique<const ModelSetDiscriminator>(singleModel);
+    ~UnzippedInput()
+    {
+        if (_unzipped) fclose(_unzipped);
     }
-    return structure_from_pred(doc, *discriminator, classifier, structure_options);
-}
 
-static freesasa_structure *
-structure_from_model(const gemmi::cif::Document &doc,
-                     const std::string &model_name,
-                     const freesasa_classifier *classifier,
-                     int structure_options)
-{
-    const ModelDiscriminator discriminator(model_name);
-    return structure_from_pred(doc, discriminator, classifier, structure_options);
-    freesasa_structure *structure = freesasa_structure_new();
-}
+    UnzippedInput(const UnzippedInput &) = delete;
+    UnzippedInput &operator=(const UnzippedInput &) = delete;
 
-static freesasa_structure *
-structure_from_chain(const gemmi::cif::Document doc,
-                     const std::string &model_name,
-                     const std::string &chain_name,
-                     const freesasa_classifier *classifier,
-                     int structure_options)
+    /// NULL if decompression failed
+    std::FILE *file() const { return _file; }
+
+private:
+    std::FILE *_file, *_unzipped;
+};
+
+freesasa_structure *
+freesasa_structure_from_cif(std::FILE *input,
+                            const freesasa_classifier *classifier,
+                            int structure_options,
+                            bool keep_document)
 {
-    const ChainDiscriminator discriminator(model_name, chain_name);
-    return structure_from_pred(doc, discriminator, classifier, structure_options);
+    UnzippedInput unzipped(input);
+
+    if (unzipped.file() == NULL) {
+        freesasa_fail("in %s(): can't read CIF input", __func__);
+        return NULL;
+    }
+    if (keep_document) {
+        DocumentSites sites(generate_gemmi_doc(unzipped.file()));
+        return structure_from_sites(sites, classifier, structure_options);
+    }
+    AtomSiteReader sites(unzipped.file());
+    return structure_from_sites(sites, classifier, structure_options);
 }
 
 std::vector<freesasa_structure *>
 freesasa_cif_structure_array(std::FILE *input,
                              int *n,
                              const freesasa_classifier *classifier,
-                             int options)
+                             int options,
+                             bool keep_document)
 {
-    int n_models = 0, n_chains = 0;
-
-    std::vector<freesasa_structure *> ss;
-
-    auto &doc = generate_gemmi_doc(input);
+    UnzippedInput unzipped(input);
 
-    gemmi::Structure gemmi_struct = gemmi::make_structure_from_block(doc.blocks[0]);
-
-    const auto models = gemmi_struct.models;
-
-    n_models = models.size();
-
-    /* only keep first model if option not provided */
-    if (!(options & FREESASA_SEPARATE_MODELS)) n_models = 1;
-
-    /* for each model read chains if requested */
-    if (options & FREESASA_SEPARATE_CHAINS) {
-        for (int i = 0; i < n_models; ++i) {
-            auto chain_names = get_chains(models[i]);
-            int n_new_chains = chain_names->size();
-            n_chains += n_new_chains;
-
-            if (n_new_chains == 0) {
-                freesasa_warn("in %s(): no chains found (in model %s)",
-                              __func__, models[i].name.c_str());
-                continue;
-            }
-
-            ss.reserve(n_new_chains);
-            for (auto &chain_name : *chain_names) {
-                freesasa_structure *structure = structure_from_chain(doc, models[i].name, chain_name, classifier, options);
-                if (freesasa_structure_n(structure) == 0) {
-                    --n_chains;
-                    free(structure);
-                    continue;
-                }
+    if (unzipped.file() == NULL) {
+        freesasa_fail("in %s(): can't read CIF input", __func__);
+        *n = 0;
+        return {};
+    }
+    if (keep_document) {
+        DocumentSites sites(generate_gemmi_doc(unzipped.file()));
+        return structure_array_from_sites(sites, n, classifier, options);
+    }
+    AtomSiteReader sites(unzipped.file());
+    return structure_array_from_sites(sites, n, classifier, options);
+}
 
-                ss.push_back(std::move(structure));
+freesasa_structure *
+freesasa_structure_from_bcif(std::FILE *input,
+                             const freesasa_classifier *classifier,
+                             int structure_options)
+{
+    UnzippedInput unzipped(input);
 
-                freesasa_structure_set_model(ss.back(), i + 1);
-            }
-        }
-        if (n_chains == 0)
-            freesasa_fail("In %s(): No chains in any model in protein: %s.",
-                          __func__, gemmi_struct.name.c_str());
-        *n = n_chains;
-    } else {
-        ss.reserve(n_models);
-        for (int i = 0; i < n_models; ++i) {
-            ss.emplace_back(
-                structure_from_model(doc, models[i].name, classifier, options));
-            freesasa_structure_set_model(ss.back(), i + 1);
-        }
-        *n = n_models;
+    if (unzipped.file() == NULL) {
+        freesasa_fail("in %s(): can't read BinaryCIF input", __func__);
+        return NULL;
+    }
+    try {
+        BcifSites sites(unzipped.file());
+        return structure_from_sites(sites, classifier, structure_options);
+    } catch (const std::exception &e) {
+        freesasa_fail("in %s(): invalid BinaryCIF input: %s", __func__, e.what());
+        return NULL;
     }
-    return ss;
 }
 
-struct freesasa_MCRA {
-    freesasa_MCRA(const int model,
-                  const std::string &chain,
-                  const std::string &res_num,
-                  const std::string &residue,
-                  const std::string &atom)
-        : _model(model), _chain(chain), _res_num(res_num), _residue(residue), _atom(atom)
-    {
+std::vector<freesasa_structure *>
+freesasa_bcif_structure_array(std::FILE *input,
+                              int *n,
+                              const freesasa_classifier *classifier,
+                              int options)
+{
+    UnzippedInput unzipped(input);
+
+    *n = 0;
+    if (unzipped.file() == NULL) {
+        freesasa_fail("in %s(): can't read BinaryCIF input", __func__);
+        return {};
+    }
+    try {
+        BcifSites sites(unzipped.file());
+        return structure_array_from_sites(sites, n, classifier, options);
+    } catch (const std::exception &e) {
+        freesasa_fail("in %s(): invalid BinaryCIF input: %s", __func__, e.what());
+        return {};
     }
+}
 
-    int find_row(gemmi::cif::Table &table, int start_idx = 0) const
+/* Maps (model, chain, residue number, residue name, atom name) to
+   the first row in _atom_site with those values, so that each atom in
+   the result tree is located in constant time. */
+class AtomSiteIndex
+{
+public:
+    explicit AtomSiteIndex(gemmi::cif::Table &table)
     {
-        int idx = start_idx, total_rows = table.length();
-
-        assert(idx < total_rows);
-
-        while (idx < total_rows) {
-            if (this->is_row(table[idx])) {
-                return idx;
-            }
-            ++idx;
-        }
-
-        freesasa_warn(
-            "In %s(), unable to find row in _atom_site for atom (%d, %s, %s, %s, %s). "
-            "Looping through entire table to double check...",
-            __func__, this->_model, this->_chain.c_str(),
-            this->_res_num.c_str(), this->_residue.c_str(),
-            this->_atom.c_str());
+        int idx = 0;
 
-        idx = 0;
+        _rows.reserve(table.length());
         for (const auto site : table) {
-            if (this->is_row(site)) {
-                return idx;
-            }
+            const std::string &atom = site[5];
+            make_key(std::stoi(site[11]), site[1], site[2], site[4],
+                     atom[0] != '"' ? atom : atom.substr(1, atom.size() - 2));
+            // keep the first row, that is the alt conformation used
+            _rows.emplace(_key, idx);
             ++idx;
         }
-        return FREESASA_FAIL;
+    }
+
+    int find_row(const int model,
+                 const std::string &chain,
+                 const std::string &res_num,
+                 const std::string &residue,
+                 const std::string &atom) const
+    {
+        make_key(model, chain, res_num, residue, atom);
+        auto row = _rows.find(_key);
+        return row != _rows.end() ? row->second : FREESASA_FAIL;
     }
 
 private:
-    bool is_row(const gemmi::cif::Table::Row &row) const
+    // the fields are C strings, so '\0' can separate them
+    void make_key(const int model,
+                  const std::string &chain,
+                  const std::string &res_num,
+                  const std::string &residue,
+                  const std::string &atom) const
     {
-        int model = std::stoul(row[11]);
-        const std::string &chain = row[1];
-        const std::string &residue = row[4];
-        const std::string &res_num = row[2];
-        const std::string atom = row[5][0] != '"' ? row[5] : row[5].substr(1, row[5].size() - 2);
-
-        if (_model == model) {
-            if (_chain == chain) {
-                if (_res_num == res_num && _residue == residue) {
-                    if (_atom == atom) {
-                        return true;
-                    }
-                }
-            }
+        _key = std::to_string(model);
+        for (auto field : {&chain, &res_num, &residue, &atom}) {
+            _key += '\0';
+            _key += *field;
         }
-        return false;
     }
 
-    const int _model;
-    const std::string &_chain, &_residue, &_res_num, &_atom;
+    std::unordered_map<std::string, int> _rows;
+    mutable std::string _key;
 };
 
 static std::string
@@ -407,6 +718,17 @@ find_doc_idx(std::string filename)
     return FREESASA_WARN;
 }
 
+// Same as std::to_string(value), i.e. "%f", without the overhead of printf
+static std::string
+fixed_string(const double value)
+{
+    char buf[FREESASA_FIXED_BUFSIZE];
+    int len = freesasa_format_fixed(buf, sizeof buf, value, 0, 6);
+
+    if (len >= (int)sizeof buf) return std::to_string(value);
+    return std::string(buf, len);
+}
+
 static void
 append_freesasa_params_to_block(gemmi::cif::Block &block, freesasa_node *result)
 {
@@ -425,7 +747,7 @@ append_freesasa_params_to_block(gemmi::cif::Block &block, freesasa_node *result)
     std::vector<std::string> params_data{
         version,
         std::string{freesasa_alg_name(params->alg)},
-        std::to_string(params->probe_radius)};
+        fixed_string(params->probe_radius)};
 
     switch (params->alg) {
     case FREESASA_SHRAKE_RUPLEY:
@@ -455,7 +777,7 @@ correct_inf_nan_values(const double value)
 {
     if (std::isnan(value)) return ".";
     if (std::isinf(value)) return "?";
-    return std::to_string(value);
+    return fixed_string(value);
 }
 
 static void
@@ -546,20 +868,20 @@ append_freesasa_result_summary_to_block(gemmi::cif::Block &block, freesasa_node
     template_data[2] = std::to_string(freesasa_node_structure_n_atoms(structure));
 
     template_data[3] = "Total";
-    template_data[4] = std::to_string(area->total);
+    template_data[4] = fixed_string(area->total);
     result_data.push_back(template_data);
 
     template_data[3] = "Apolar";
-    template_data[4] = std::to_string(area->apolar);
+    template_data[4] = fixed_string(area->apolar);
     result_data.push_back(template_data);
 
     template_data[3] = "Polar";
-    template_data[4] = std::to_string(area->polar);
+    template_data[4] = fixed_string(area->polar);
     result_data.push_back(template_data);
 
     if (area->unknown > 0) {
         template_data[3] = "Unknown";
-        template_data[4] = std::to_string(area->unknown);
+        template_data[4] = fixed_string(area->unknown);
         result_data.push_back(template_data);
     }
 
@@ -571,7 +893,7 @@ append_freesasa_result_summary_to_block(gemmi::cif::Block &block, freesasa_node
         }
 
         template_data[3] = gemmi::cif::quote(std::string{"CHAIN "} + std::string{freesasa_node_name(chain)});
-        template_data[4] = std::to_string(area->total);
+        template_data[4] = fixed_string(area->total);
         result_data.push_back(template_data);
 
         chain = freesasa_node_next(chain);
@@ -593,7 +915,9 @@ append_freesasa_result_summary_to_block(gemmi::cif::Block &block, freesasa_node
 }
 
 static void
-populate_freesasa_result_vectors(gemmi::cif::Table &table, freesasa_node *result,
+populate_freesasa_result_vectors(gemmi::cif::Table &table,
+                                 const AtomSiteIndex &index,
+                                 freesasa_node *result,
                                  std::vector<std::string> &sasa_vals,
                                  std::vector<std::string> &sasa_radii)
 {
@@ -601,37 +925,42 @@ populate_freesasa_result_vectors(gemmi::cif::Table &table, freesasa_node *result
 
     assert(table.ok());
 
-    freesasa_node *structure, *chain, *residue, *atom;
-    int rowNum{0}, model{0};
+    freesasa_node *structure, *chain, *residue;
+    const freesasa_result *result_values;
+    const char *aName;
+    double radius;
+    freesasa_atom_class the_class;
+    int rowNum{0}, model{0}, first{0}, is_bb{0};
 
     structure = freesasa_node_children(result);
     while (structure) {
-        rowNum = 0;
         model = freesasa_node_structure_model(structure);
+        result_values = freesasa_node_structure_result(structure);
         chain = freesasa_node_children(structure);
         while (chain) {
+            auto cName = std::string(1, freesasa_node_name(chain)[0]);
             residue = freesasa_node_children(chain);
             while (residue) {
                 append_freesasa_rsa_residue_to_block(table.bloc, residue);
-                atom = freesasa_node_children(residue);
-                while (atom) {
-                    auto cName = std::string(1, freesasa_node_atom_chain(atom));
-                    auto rNum = freesasa_node_atom_residue_number(atom);
-                    auto rName = freesasa_node_atom_residue_name(atom);
-                    auto aName = freesasa_node_name(atom);
-                    auto area = freesasa_node_area(atom);
-                    auto radius = freesasa_node_atom_radius(atom);
-
-                    rowNum = freesasa_MCRA{model, cName, rNum, rName, aName}.find_row(table, rowNum);
-                    if (rowNum == FREESASA_FAIL)
+                auto rNum = freesasa_node_residue_number(residue);
+                auto rName = freesasa_node_name(residue);
+                first = freesasa_node_residue_first_atom(residue);
+                // atoms are read from the structure node, without creating atom nodes
+                for (int i = first; i < first + freesasa_node_residue_n_atoms(residue); ++i) {
+                    if (freesasa_node_structure_atom(structure, i, &aName, &radius,
+                                                     &the_class, &is_bb)) {
+                        break;
+                    }
+
+                    rowNum = index.find_row(model, cName, rNum, rName, aName);
+                    if (rowNum == FREESASA_FAIL) {
                         freesasa_fail(
                             "In %s(), unable to find freesasa_node atom (%d, %s, %s, %s, %s) in cif %s",
                             __func__, model, cName.c_str(), rNum, rName, aName, table.bloc.name.c_str());
-
-                    sasa_vals[rowNum] = std::to_string(area->total);
-                    sasa_radii[rowNum] = std::to_string(radius);
-
-                    atom = freesasa_node_next(atom);
+                    } else {
+                        sasa_vals[rowNum] = fixed_string(result_values->sasa[i]);
+                        sasa_radii[rowNum] = fixed_string(radius);
+                    }
                 }
                 residue = freesasa_node_next(residue);
             }
@@ -684,6 +1013,7 @@ write_result(std::ostream &out, freesasa_node *root)
     int prev_doc_idx = -1, doc_idx = 0;
     bool write = false;
     std::vector<std::string> sasa_vals, sasa_radii;
+    std::unique_ptr<AtomSiteIndex> index;
 
     while (result) {
         doc_idx = find_doc_idx(freesasa_node_name(result));
@@ -706,9 +1036,10 @@ write_result(std::ostream &out, freesasa_node *root)
         if (prev_doc_idx != doc_idx) {
             sasa_vals = std::vector<std::string>{table.length(), "?"};
             sasa_radii = std::vector<std::string>{table.length(), "?"};
+            index = std::make_unique<AtomSiteIndex>(table);
         }
 
-        populate_freesasa_result_vectors(table, result, sasa_vals, sasa_radii);
+        populate_freesasa_result_vectors(table, *index, result, sasa_vals, sasa_radii);
 
         prev_doc_idx = doc_idx;
         result = freesasa_node_next(result);
@@ -729,24 +1060,39 @@ write_result(std::ostream &out, freesasa_node *root)
     return FREESASA_SUCCESS;
 }
 
-int freesasa_export_tree_to_cif(const char *filename,
+/* Stream buffer that writes to a FILE, so that CIF output can be
+   written to the same stream as the other formats */
+class FileBuf : public std::streambuf
+{
+public:
+    explicit FileBuf(std::FILE *file) : _file(file) {}
+
+protected:
+    int_type overflow(int_type c) override
+    {
+        if (traits_type::eq_int_type(c, traits_type::eof())) return traits_type::not_eof(c);
+        return fputc(c, _file) == EOF ? traits_type::eof() : c;
+    }
+
+    std::streamsize xsputn(const char *s, std::streamsize n) override
+    {
+        return fwrite(s, 1, n, _file);
+    }
+
+private:
+    std::FILE *_file;
+};
+
+int freesasa_export_tree_to_cif(std::FILE *output,
                                 freesasa_node *root)
 {
+    assert(output);
     assert(root);
     assert(freesasa_node_type(root) == FREESASA_NODE_ROOT);
     int ret;
 
-    std::streambuf *buf;
-    std::ofstream fout;
-
-    if (filename != NULL) {
-        fout.open(filename);
-        buf = fout.rdbuf();
-    } else {
-        buf = std::cout.rdbuf();
-    }
-
-    std::ostream out(buf);
+    FileBuf buf(output);
+    std::ostream out(&buf);
 
     try {
         ret = write_result(out, root);
@@ -754,10 +1100,13 @@ int freesasa_export_tree_to_cif(const char *filename,
         ret = FREESASA_FAIL;
     }
 
-    if (filename != NULL) {
-        fout.close();
+    if (!out || fflush(output) != 0) {
+        ret = FREESASA_FAIL;
     }
 
+    // the documents are only needed for output
+    std::vector<gemmi::cif::Document>().swap(docs);
+
     if (ret == FREESASA_FAIL) {
         freesasa_fail("Unable to output CIF file");
     }
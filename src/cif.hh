@@ -11,19 +11,39 @@
 #include "freesasa.h"
 #include "freesasa_internal.h"
 
+/// If keep_document is true, the CIF document is kept in memory for
+/// freesasa_export_tree_to_cif(), otherwise only the atoms are read.
+/// Gzip compressed input is decompressed.
 freesasa_structure *
 freesasa_structure_from_cif(std::FILE *input,
                             const freesasa_classifier *classifier,
-                            int structure_options);
+                            int structure_options,
+                            bool keep_document);
 
+/// See freesasa_structure_from_cif() for keep_document
 std::vector<freesasa_structure *>
 freesasa_cif_structure_array(std::FILE *input,
                              int *n,
                              const freesasa_classifier *classifier,
-                             int options);
+                             int options,
+                             bool keep_document);
 
-/// If filename is NULL output will be written to stdout
-int freesasa_export_tree_to_cif(const char *filename,
+/// Reads the atoms of a BinaryCIF file, the options are the same as
+/// for freesasa_structure_from_cif(). Gzip compressed input is
+/// decompressed.
+freesasa_structure *
+freesasa_structure_from_bcif(std::FILE *input,
+                             const freesasa_classifier *classifier,
+                             int structure_options);
+
+/// BinaryCIF version of freesasa_cif_structure_array()
+std::vector<freesasa_structure *>
+freesasa_bcif_structure_array(std::FILE *input,
+                              int *n,
+                              const freesasa_classifier *classifier,
+                              int options);
+
+int freesasa_export_tree_to_cif(std::FILE *output,
                                 freesasa_node *root);
 
 #endif /* CIF_HH */
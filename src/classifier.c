@@ -3,11 +3,15 @@
 #endif
 
 #include <assert.h>
+#include <ctype.h>
 #include <stdlib.h>
 #if HAVE_STRINGS_H
 #include <strings.h>
 #endif
 #include <errno.h>
+#if USE_THREADS
+#include <pthread.h>
+#endif
 
 #include "classifier.h"
 #include "freesasa_internal.h"
@@ -17,6 +21,52 @@
 
 #define MAX_LINE_LEN 256
 
+/* Number of seeds to try for each bucket when building an index */
+#define INDEX_MAX_SEED 100000
+
+/**
+    Compiled classifiers (see freesasa_classifier_write_compiled())
+    are stored as a header followed by the index seeds, the index
+    slots, a table of residues sorted by name, and the name of the
+    classifier. Each section starts at a multiple of 8 bytes, so that
+    the file can be used directly after mmap(). The format is in
+    native byte order and sizes, the header has fields to detect
+    files compiled on other platforms.
+ */
+#define COMPILED_MAGIC "FSCLASS"
+#define COMPILED_VERSION 1
+#define COMPILED_BYTE_ORDER 0x01020304
+
+struct compiled_header {
+    char magic[8];
+    uint32_t version;
+    uint32_t byte_order;
+    uint32_t seed_size;
+    uint32_t entry_size;
+    uint32_t n_buckets;
+    uint32_t n_slots;
+    uint32_t n_residues;
+    uint32_t name_length; /* including terminating '\0' */
+};
+
+/* A residue in a compiled classifier, with reference areas */
+struct compiled_residue {
+    char name[8];
+    uint32_t has_reference;
+    uint32_t padding;
+    double total, main_chain, side_chain, polar, apolar, unknown;
+};
+
+/* A classifier loaded from a compiled file */
+struct classifier_compiled {
+    void *data;   /* file contents */
+    size_t size;  /* size of data */
+    int mapped;   /* 1 if data was mapped, 0 if read into memory */
+    int n_residues;
+    const struct compiled_residue *residue;
+    freesasa_nodearea *reference;
+};
+
 /**
     In this file the concept class refers to polar/apolar and type to
     aliphatic/aromatic/etc. See the example configurations in share/.
@@ -26,7 +76,14 @@ static const struct classifier_types empty_types = {0, NULL, NULL, NULL};
 
 static const struct classifier_residue empty_residue = {0, NULL, NULL, NULL, NULL, {NULL, 0, 0, 0, 0, 0}};
 
-static const struct freesasa_classifier empty_config = {0, NULL, NULL, NULL};
+static const struct freesasa_classifier empty_config = {0, NULL, NULL, NULL, NULL, NULL, 0};
+
+/* Source of classifier ids. A classifier can be freed and a new one
+   allocated at the same address, the ids tell them apart. */
+static unsigned long last_classifier_id = 0;
+#if USE_THREADS
+static pthread_mutex_t classifier_id_mutex = PTHREAD_MUTEX_INITIALIZER;
+#endif
 
 struct classifier_types *
 freesasa_classifier_types_new(void)
@@ -95,14 +152,42 @@ void freesasa_classifier_residue_free(struct classifier_residue *res)
     }
 }
 
+static void
+classifier_index_free(struct classifier_index *index)
+{
+    if (index != NULL) {
+        free(index->seed);
+        free(index->slot);
+        free(index);
+    }
+}
+
+static void
+classifier_compiled_free(struct classifier_compiled *compiled)
+{
+    if (compiled != NULL) {
+        freesasa_file_unmap(compiled->data, compiled->size, compiled->mapped);
+        free(compiled->reference);
+        free(compiled);
+    }
+}
+
 freesasa_classifier *
 freesasa_classifier_new()
 {
     struct freesasa_classifier *cfg = malloc(sizeof(struct freesasa_classifier));
-    if (cfg == NULL)
+    if (cfg == NULL) {
         mem_fail();
-    else
-        *cfg = empty_config;
+        return NULL;
+    }
+    *cfg = empty_config;
+#if USE_THREADS
+    pthread_mutex_lock(&classifier_id_mutex);
+#endif
+    cfg->id = ++last_classifier_id;
+#if USE_THREADS
+    pthread_mutex_unlock(&classifier_id_mutex);
+#endif
     return cfg;
 }
 
@@ -116,10 +201,32 @@ void freesasa_classifier_free(freesasa_classifier *c)
         free(c->residue);
         free(c->residue_name);
         free(c->name);
+        if (c->compiled) {
+            /* seeds and slots point into the compiled data */
+            free(c->index);
+            classifier_compiled_free(c->compiled);
+        } else {
+            classifier_index_free(c->index);
+        }
         free(c);
     }
 }
 
+/* Skips leading whitespace in str and returns the length of the
+   first word, i.e. what sscanf(*str, "%s", ...) would read */
+static int
+first_word(const char **str)
+{
+    int n;
+
+    while (isspace((unsigned char)**str))
+        ++*str;
+    for (n = 0; (*str)[n] != '\0' && !isspace((unsigned char)(*str)[n]); ++n)
+        ;
+
+    return n;
+}
+
 /* check if array of strings has a string that matches key,
    ignores trailing and leading whitespace */
 static int
@@ -127,30 +234,20 @@ find_string(char **array,
             const char *key,
             int array_size)
 {
-    int n, i, found = 0;
-    char *key_trimmed;
+    int n, i;
 
     if (array == NULL || array_size == 0) return -1;
 
-    n = strlen(key);
-    key_trimmed = malloc(n + 1);
-
-    if (key_trimmed == NULL) return mem_fail();
-
     /* remove trailing and leading whitespace */
-    sscanf(key, "%s", key_trimmed);
+    n = first_word(&key);
 
     for (i = 0; i < array_size; ++i) {
         assert(array[i]);
-        if (strcmp(array[i], key_trimmed) == 0) {
-            found = 1;
-            break;
+        if (strncmp(array[i], key, n) == 0 && array[i][n] == '\0') {
+            return i;
         }
     }
 
-    free(key_trimmed);
-
-    if (found) return i;
     return FREESASA_FAIL;
 }
 
@@ -561,6 +658,12 @@ int freesasa_classifier_add_residue(struct freesasa_classifier *c,
 
     if (res >= 0) return res;
 
+    if (c->compiled) return fail_msg("compiled classifiers can't be modified");
+
+    /* the index doesn't know about the new residue */
+    classifier_index_free(c->index);
+    c->index = NULL;
+
     res = c->n_residues + 1;
 
     if ((c->residue_name = realloc(rn, sizeof(char *) * res)) == NULL) {
@@ -699,6 +802,224 @@ read_name(struct freesasa_classifier *classifier,
     return FREESASA_SUCCESS;
 }
 
+/* Hash function for the classifier index, FNV-1a over the bytes of
+   the seed and the key. Has to match the one in config2c.pl. */
+static uint32_t
+index_hash(uint64_t key,
+           uint32_t seed)
+{
+    uint32_t h = 2166136261u;
+    int i;
+
+    for (i = 0; i < 4; ++i) {
+        h ^= (seed >> (8 * i)) & 0xff;
+        h *= 16777619u;
+    }
+    for (i = 0; i < 8; ++i) {
+        h ^= (key >> (8 * i)) & 0xff;
+        h *= 16777619u;
+    }
+    return h;
+}
+
+/* Packs name, stripped of whitespace, into the bytes of key starting
+   at byte offset. Returns FREESASA_FAIL if it is longer than
+   max_len. */
+static int
+index_pack_name(uint64_t *key,
+                const char *name,
+                int offset,
+                int max_len)
+{
+    int i, n = first_word(&name);
+
+    if (n > max_len) return FREESASA_FAIL;
+    for (i = 0; i < n; ++i) {
+        *key |= (uint64_t)(unsigned char)name[i] << (8 * (offset + i));
+    }
+    return FREESASA_SUCCESS;
+}
+
+/* The index key of an atom, 0 if the names are too long to be packed */
+static uint64_t
+index_key(const char *res_name,
+          const char *atom_name)
+{
+    uint64_t key = 0;
+
+    if (index_pack_name(&key, res_name, 0, PDB_ATOM_RES_NAME_STRL) ||
+        index_pack_name(&key, atom_name, PDB_ATOM_RES_NAME_STRL, PDB_ATOM_NAME_STRL)) {
+        return 0;
+    }
+    return key;
+}
+
+static const struct classifier_index_entry *
+index_find(const struct classifier_index *index,
+           uint64_t key)
+{
+    const struct classifier_index_entry *entry;
+    uint32_t bucket = index_hash(key, 0) % index->n_buckets;
+
+    entry = &index->slot[index_hash(key, index->seed[bucket]) % index->n_slots];
+    if (key != 0 && entry->key == key) return entry;
+    return NULL;
+}
+
+/* Tries to find a seed that places all entries in the bucket in
+   free slots. Returns FREESASA_FAIL if none found. */
+static int
+index_place_bucket(struct classifier_index *index,
+                   const struct classifier_index_entry *entry,
+                   const int *member,
+                   int n_members,
+                   int bucket,
+                   int *placed)
+{
+    uint32_t seed;
+    int i, j, s;
+
+    for (seed = 1; seed < INDEX_MAX_SEED; ++seed) {
+        for (i = 0; i < n_members; ++i) {
+            s = index_hash(entry[member[i]].key, seed) % index->n_slots;
+            if (index->slot[s].key != 0) break;
+            index->slot[s] = entry[member[i]];
+            placed[i] = s;
+        }
+        if (i == n_members) {
+            index->seed[bucket] = seed;
+            return FREESASA_SUCCESS;
+        }
+        for (j = 0; j < i; ++j) {
+            index->slot[placed[j]].key = 0;
+        }
+    }
+    return FREESASA_FAIL;
+}
+
+/* Fill the index with the n entries. The buckets with most entries
+   are placed first, they are the hardest to place. Returns
+   FREESASA_WARN if no seeds were found for the current size. */
+static int
+index_fill(struct classifier_index *index,
+           const struct classifier_index_entry *entry,
+           int n)
+{
+    int *first = calloc(index->n_buckets + 1, sizeof(int));
+    int *member = malloc(sizeof(int) * n);
+    int *placed = malloc(sizeof(int) * n);
+    int *count = calloc(index->n_buckets, sizeof(int));
+    int i, b, size, max_size = 0, ret = FREESASA_SUCCESS;
+
+    if (!first || !member || !placed || !count) {
+        ret = mem_fail();
+        goto cleanup;
+    }
+
+    for (i = 0; i < n; ++i) {
+        ++first[index_hash(entry[i].key, 0) % index->n_buckets + 1];
+    }
+    for (b = 0; b < index->n_buckets; ++b) {
+        if (first[b + 1] > max_size) max_size = first[b + 1];
+        first[b + 1] += first[b];
+    }
+    for (i = 0; i < n; ++i) {
+        b = index_hash(entry[i].key, 0) % index->n_buckets;
+        member[first[b] + count[b]++] = i;
+    }
+
+    for (size = max_size; size > 0; --size) {
+        for (b = 0; b < index->n_buckets; ++b) {
+            if (count[b] != size) continue;
+            if (index_place_bucket(index, entry, member + first[b], size, b, placed)) {
+                ret = FREESASA_WARN;
+                goto cleanup;
+            }
+        }
+    }
+
+cleanup:
+    free(first);
+    free(member);
+    free(placed);
+    free(count);
+    return ret;
+}
+
+/**
+    Builds the index of a classifier. If any atom or residue names are
+    too long to be packed as keys, no index is built and lookups will
+    use linear search.
+ */
+static int
+classifier_build_index(struct freesasa_classifier *c)
+{
+    struct classifier_index_entry *entry = NULL;
+    struct classifier_index *index = NULL;
+    const struct classifier_residue *res;
+    int i, j, n = 0, ret;
+
+    classifier_index_free(c->index);
+    c->index = NULL;
+
+    for (i = 0; i < c->n_residues; ++i) {
+        n += c->residue[i]->n_atoms;
+    }
+    if (n == 0) return FREESASA_SUCCESS;
+
+    entry = malloc(sizeof(struct classifier_index_entry) * n);
+    if (entry == NULL) return mem_fail();
+
+    for (i = 0, n = 0; i < c->n_residues; ++i) {
+        res = c->residue[i];
+        for (j = 0; j < res->n_atoms; ++j, ++n) {
+            entry[n].key = index_key(res->name, res->atom_name[j]);
+            entry[n].radius = res->atom_radius[j];
+            entry[n].the_class = res->atom_class[j];
+            if (entry[n].key == 0) {
+                free(entry);
+                return FREESASA_SUCCESS;
+            }
+        }
+    }
+
+    index = malloc(sizeof(struct classifier_index));
+    if (index == NULL) {
+        free(entry);
+        return mem_fail();
+    }
+    index->n_buckets = n / 4 + 1;
+    index->n_slots = n + n / 4 + 1;
+    index->seed = NULL;
+    index->slot = NULL;
+
+    /* if no perfect hash is found, try again with more slots */
+    for (;;) {
+        index->seed = calloc(index->n_buckets, sizeof(unsigned int));
+        index->slot = calloc(index->n_slots, sizeof(struct classifier_index_entry));
+        if (index->seed == NULL || index->slot == NULL) {
+            ret = mem_fail();
+            break;
+        }
+        ret = index_fill(index, entry, n);
+        if (ret != FREESASA_WARN) break;
+        free(index->seed);
+        free(index->slot);
+        index->n_slots += index->n_slots / 2;
+    }
+
+    free(entry);
+
+    if (ret == FREESASA_FAIL) {
+        classifier_index_free(index);
+        return FREESASA_FAIL;
+    }
+
+    c->index = index;
+
+    return FREESASA_SUCCESS;
+}
+
 static struct freesasa_classifier *
 read_config(FILE *input)
 {
@@ -720,6 +1041,8 @@ read_config(FILE *input)
         goto cleanup;
     if (read_atoms(classifier, types, input, atoms_section))
         goto cleanup;
+    if (classifier_build_index(classifier))
+        goto cleanup;
 
     freesasa_classifier_types_free(types);
 
@@ -777,21 +1100,62 @@ find_atom(const struct freesasa_classifier *c,
     return FREESASA_SUCCESS;
 }
 
+int freesasa_classifier_lookup(const freesasa_classifier *classifier,
+                               const char *res_name,
+                               const char *atom_name,
+                               double *radius,
+                               freesasa_atom_class *the_class)
+{
+    const struct classifier_index_entry *entry = NULL;
+    uint64_t key = 0, any_key = 0;
+    int res, atom;
+
+    assert(classifier);
+    assert(res_name);
+    assert(atom_name);
+
+    *radius = -1.0;
+    *the_class = FREESASA_ATOM_UNKNOWN;
+
+    /* All names in an index fit in a key, so names that are too long
+       can't be found. A residue name that is too long can still fall
+       back to ANY. */
+    if (classifier->index != NULL) {
+        if (index_pack_name(&key, atom_name, PDB_ATOM_RES_NAME_STRL, PDB_ATOM_NAME_STRL))
+            return FREESASA_WARN;
+        any_key = key;
+        index_pack_name(&any_key, "ANY", 0, PDB_ATOM_RES_NAME_STRL);
+        if (index_pack_name(&key, res_name, 0, PDB_ATOM_RES_NAME_STRL) == FREESASA_SUCCESS) {
+            entry = index_find(classifier->index, key);
+        }
+        if (entry == NULL) {
+            entry = index_find(classifier->index, any_key);
+        }
+        if (entry == NULL) return FREESASA_WARN;
+        *radius = entry->radius;
+        *the_class = entry->the_class;
+        return FREESASA_SUCCESS;
+    }
+
+    if (find_atom(classifier, res_name, atom_name, &res, &atom) == FREESASA_SUCCESS) {
+        *radius = classifier->residue[res]->atom_radius[atom];
+        *the_class = classifier->residue[res]->atom_class[atom];
+        return FREESASA_SUCCESS;
+    }
+    return FREESASA_WARN;
+}
+
 double
 freesasa_classifier_radius(const freesasa_classifier *classifier,
                            const char *res_name,
                            const char *atom_name)
 {
-    int res, atom, status;
+    double radius;
+    freesasa_atom_class the_class;
 
-    assert(classifier);
-    assert(res_name);
-    assert(atom_name);
+    freesasa_classifier_lookup(classifier, res_name, atom_name, &radius, &the_class);
 
-    status = find_atom(classifier, res_name, atom_name, &res, &atom);
-    if (status == FREESASA_SUCCESS)
-        return classifier->residue[res]->atom_radius[atom];
-    return -1.0;
+    return radius;
 }
 
 freesasa_atom_class
@@ -799,16 +1163,12 @@ freesasa_classifier_class(const freesasa_classifier *classifier,
                           const char *res_name,
                           const char *atom_name)
 {
-    int res, atom, status;
+    double radius;
+    freesasa_atom_class the_class;
 
-    assert(classifier);
-    assert(res_name);
-    assert(atom_name);
+    freesasa_classifier_lookup(classifier, res_name, atom_name, &radius, &the_class);
 
-    status = find_atom(classifier, res_name, atom_name, &res, &atom);
-    if (status == FREESASA_SUCCESS)
-        return classifier->residue[res]->atom_class[atom];
-    return FREESASA_ATOM_UNKNOWN;
+    return the_class;
 }
 
 const char *
@@ -836,10 +1196,319 @@ freesasa_result_classes(const freesasa_structure *structure,
     return area;
 }
 
+/* Rounds size up to the next multiple of 8 */
+static size_t
+compiled_pad(size_t size)
+{
+    return (size + 7) & ~(size_t)7;
+}
+
+static int
+compare_compiled_residues(const void *a,
+                          const void *b)
+{
+    return strcmp(((const struct compiled_residue *)a)->name,
+                  ((const struct compiled_residue *)b)->name);
+}
+
+/* Takes ownership of data, which is released on failure */
+static freesasa_classifier *
+classifier_from_compiled(void *data,
+                         size_t size,
+                         int mapped)
+{
+    struct freesasa_classifier *classifier = NULL;
+    struct classifier_compiled *compiled = NULL;
+    struct compiled_header header;
+    const struct compiled_residue *res;
+    const char *name;
+    size_t seed_offset, slot_offset, residue_offset, name_offset, end;
+    uint32_t i;
+
+    compiled = malloc(sizeof(struct classifier_compiled));
+    if (compiled == NULL) {
+        freesasa_file_unmap(data, size, mapped);
+        mem_fail();
+        return NULL;
+    }
+    compiled->data = data;
+    compiled->size = size;
+    compiled->mapped = mapped;
+    compiled->reference = NULL;
+
+    if (size < sizeof(header)) {
+        fail_msg("compiled classifier is truncated");
+        goto cleanup;
+    }
+    memcpy(&header, data, sizeof(header));
+
+    if (header.version != COMPILED_VERSION) {
+        fail_msg("compiled classifier has version %d, expected %d",
+                 header.version, COMPILED_VERSION);
+        goto cleanup;
+    }
+    if (header.byte_order != COMPILED_BYTE_ORDER ||
+        header.seed_size != sizeof(unsigned int) ||
+        header.entry_size != sizeof(struct classifier_index_entry)) {
+        fail_msg("compiled classifier was compiled on an incompatible platform, "
+                 "compile it again from the original configuration");
+        goto cleanup;
+    }
+
+    seed_offset = compiled_pad(sizeof(header));
+    slot_offset = seed_offset + compiled_pad((size_t)header.n_buckets * header.seed_size);
+    residue_offset = slot_offset + (size_t)header.n_slots * header.entry_size;
+    name_offset = residue_offset + (size_t)header.n_residues * sizeof(struct compiled_residue);
+    end = name_offset + header.name_length;
+
+    if (header.n_buckets == 0 || header.n_slots == 0 ||
+        header.name_length == 0 || end > size) {
+        fail_msg("compiled classifier is truncated or corrupt");
+        goto cleanup;
+    }
+
+    name = (const char *)data + name_offset;
+    res = (const struct compiled_residue *)((const char *)data + residue_offset);
+    if (name[header.name_length - 1] != '\0') {
+        fail_msg("compiled classifier is corrupt");
+        goto cleanup;
+    }
+    for (i = 0; i < header.n_residues; ++i) {
+        if (res[i].name[sizeof(res[i].name) - 1] != '\0') {
+            fail_msg("compiled classifier is corrupt");
+            goto cleanup;
+        }
+    }
+
+    compiled->n_residues = header.n_residues;
+    compiled->residue = res;
+    if (header.n_residues > 0) {
+        compiled->reference = malloc(sizeof(freesasa_nodearea) * header.n_residues);
+        if (compiled->reference == NULL) {
+            mem_fail();
+            goto cleanup;
+        }
+    }
+    for (i = 0; i < header.n_residues; ++i) {
+        freesasa_nodearea *ref = &compiled->reference[i];
+        ref->name = res[i].has_reference ? res[i].name : NULL;
+        ref->total = res[i].total;
+        ref->main_chain = res[i].main_chain;
+        ref->side_chain = res[i].side_chain;
+        ref->polar = res[i].polar;
+        ref->apolar = res[i].apolar;
+        ref->unknown = res[i].unknown;
+    }
+
+    if (!(classifier = freesasa_classifier_new()))
+        goto cleanup;
+    classifier->compiled = compiled;
+    if (!(classifier->name = strdup(name))) {
+        mem_fail();
+        goto cleanup;
+    }
+    if (!(classifier->index = malloc(sizeof(struct classifier_index)))) {
+        mem_fail();
+        goto cleanup;
+    }
+    classifier->index->n_buckets = header.n_buckets;
+    classifier->index->n_slots = header.n_slots;
+    classifier->index->seed = (unsigned int *)((char *)data + seed_offset);
+    classifier->index->slot = (struct classifier_index_entry *)((char *)data + slot_offset);
+
+    return classifier;
+
+cleanup:
+    if (classifier)
+        freesasa_classifier_free(classifier);
+    else
+        classifier_compiled_free(compiled);
+    return NULL;
+}
+
+/* Read a compiled classifier, using mmap() if possible */
+static freesasa_classifier *
+read_compiled(FILE *input)
+{
+    void *data;
+    size_t size;
+    int mapped = freesasa_file_map(input, &data, &size);
+
+    if (mapped == FREESASA_FAIL) {
+        fail_msg("");
+        return NULL;
+    }
+
+    return classifier_from_compiled(data, size, mapped);
+}
+
+/* Checks for the magic string of compiled classifiers, leaves file
+   position unchanged */
+static int
+is_compiled(FILE *input)
+{
+    char magic[sizeof(COMPILED_MAGIC)];
+    long pos = ftell(input);
+    size_t n = fread(magic, 1, sizeof(magic), input);
+
+    fseek(input, pos, SEEK_SET);
+
+    return n == sizeof(magic) && memcmp(magic, COMPILED_MAGIC, sizeof(magic)) == 0;
+}
+
+/* Fills the array residue (of size n_residues) */
+static int
+compiled_residues(struct compiled_residue *residue,
+                  const freesasa_classifier *classifier)
+{
+    const freesasa_nodearea *ref;
+    int i;
+
+    if (classifier->compiled) {
+        memcpy(residue, classifier->compiled->residue,
+               sizeof(struct compiled_residue) * classifier->compiled->n_residues);
+        return FREESASA_SUCCESS;
+    }
+
+    for (i = 0; i < classifier->n_residues; ++i) {
+        if (strlen(classifier->residue_name[i]) >= sizeof(residue[i].name)) {
+            return fail_msg("residue name '%s' too long for compiled classifier",
+                            classifier->residue_name[i]);
+        }
+        memset(&residue[i], 0, sizeof(struct compiled_residue));
+        strcpy(residue[i].name, classifier->residue_name[i]);
+        ref = &classifier->residue[i]->max_area;
+        residue[i].has_reference = ref->name != NULL;
+        residue[i].total = ref->total;
+        residue[i].main_chain = ref->main_chain;
+        residue[i].side_chain = ref->side_chain;
+        residue[i].polar = ref->polar;
+        residue[i].apolar = ref->apolar;
+        residue[i].unknown = ref->unknown;
+    }
+    qsort(residue, classifier->n_residues, sizeof(struct compiled_residue),
+          compare_compiled_residues);
+
+    return FREESASA_SUCCESS;
+}
+
+int freesasa_classifier_write_compiled(FILE *output,
+                                       const freesasa_classifier *classifier)
+{
+    struct freesasa_classifier copy = *classifier;
+    struct compiled_header header;
+    struct compiled_residue *residue = NULL;
+    struct classifier_index_entry entry;
+    const struct classifier_index *index = classifier->index;
+    const char *name = classifier->name ? classifier->name : STD_CLASSIFIER_NAME;
+    const char zeros[8] = {0};
+    int i, n_residues, ret = FREESASA_FAIL;
+
+    assert(output);
+    assert(classifier);
+
+    copy.index = NULL;
+    if (index == NULL) {
+        if (classifier_build_index(&copy)) return fail_msg("");
+        if (copy.index == NULL) {
+            return fail_msg("classifier can't be compiled, it has no atoms, "
+                            "or residue or atom names longer than %d and %d characters",
+                            PDB_ATOM_RES_NAME_STRL, PDB_ATOM_NAME_STRL);
+        }
+        index = copy.index;
+    }
+
+    n_residues = classifier->compiled ? classifier->compiled->n_residues : classifier->n_residues;
+    if (n_residues > 0) {
+        residue = malloc(sizeof(struct compiled_residue) * n_residues);
+        if (residue == NULL) {
+            mem_fail();
+            goto cleanup;
+        }
+        if (compiled_residues(residue, classifier)) goto cleanup;
+    }
+
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, COMPILED_MAGIC, sizeof(header.magic));
+    header.version = COMPILED_VERSION;
+    header.byte_order = COMPILED_BYTE_ORDER;
+    header.seed_size = sizeof(unsigned int);
+    header.entry_size = sizeof(struct classifier_index_entry);
+    header.n_buckets = index->n_buckets;
+    header.n_slots = index->n_slots;
+    header.n_residues = n_residues;
+    header.name_length = strlen(name) + 1;
+
+    if (fwrite(&header, sizeof(header), 1, output) != 1 ||
+        fwrite(zeros, 1, compiled_pad(sizeof(header)) - sizeof(header), output) != compiled_pad(sizeof(header)) - sizeof(header) ||
+        fwrite(index->seed, sizeof(unsigned int), index->n_buckets, output) != index->n_buckets ||
+        fwrite(zeros, 1, compiled_pad(sizeof(unsigned int) * index->n_buckets) - sizeof(unsigned int) * index->n_buckets, output) !=
+            compiled_pad(sizeof(unsigned int) * index->n_buckets) - sizeof(unsigned int) * index->n_buckets) {
+        fail_msg(strerror(errno));
+        goto cleanup;
+    }
+
+    /* write slots one by one, to not include padding and content of empty slots */
+    for (i = 0; i < index->n_slots; ++i) {
+        memset(&entry, 0, sizeof(entry));
+        if (index->slot[i].key != 0) {
+            entry.key = index->slot[i].key;
+            entry.radius = index->slot[i].radius;
+            entry.the_class = index->slot[i].the_class;
+        } else {
+            entry.the_class = FREESASA_ATOM_UNKNOWN;
+        }
+        if (fwrite(&entry, sizeof(entry), 1, output) != 1) {
+            fail_msg(strerror(errno));
+            goto cleanup;
+        }
+    }
+
+    if ((n_residues > 0 &&
+         fwrite(residue, sizeof(struct compiled_residue), n_residues, output) != n_residues) ||
+        fwrite(name, 1, header.name_length, output) != header.name_length ||
+        fflush(output)) {
+        fail_msg(strerror(errno));
+        goto cleanup;
+    }
+
+    ret = FREESASA_SUCCESS;
+
+cleanup:
+    free(residue);
+    classifier_index_free(copy.index);
+    return ret;
+}
+
+/* Binary search for residue in compiled classifier */
+static const freesasa_nodearea *
+compiled_reference(const struct classifier_compiled *compiled,
+                   const char *res_name)
+{
+    struct compiled_residue key;
+    const struct compiled_residue *found;
+    int n = first_word(&res_name);
+
+    if (n >= sizeof(key.name)) return NULL;
+
+    memset(key.name, 0, sizeof(key.name));
+    memcpy(key.name, res_name, n);
+    found = bsearch(&key, compiled->residue, compiled->n_residues,
+                    sizeof(struct compiled_residue), compare_compiled_residues);
+
+    if (found == NULL) return NULL;
+    return &compiled->reference[found - compiled->residue];
+}
+
 freesasa_classifier *
 freesasa_classifier_from_file(FILE *file)
 {
-    struct freesasa_classifier *classifier = read_config(file);
+    struct freesasa_classifier *classifier;
+
+    if (is_compiled(file))
+        classifier = read_compiled(file);
+    else
+        classifier = read_config(file);
 
     if (classifier == NULL) {
         fail_msg("");
@@ -853,7 +1522,12 @@ const freesasa_nodearea *
 freesasa_classifier_residue_reference(const freesasa_classifier *classifier,
                                       const char *res_name)
 {
-    int res = find_string(classifier->residue_name, res_name, classifier->n_residues);
+    int res;
+
+    if (classifier->compiled)
+        return compiled_reference(classifier->compiled, res_name);
+
+    res = find_string(classifier->residue_name, res_name, classifier->n_residues);
 
     if (res < 0) return NULL;
 
@@ -1161,12 +1835,160 @@ START_TEST(test_classifier_utils)
 }
 END_TEST
 
+/* Check that index lookups agree with the arrays for all atoms */
+static void
+check_index(const freesasa_classifier *clf)
+{
+    const struct classifier_residue *res;
+    double r;
+    freesasa_atom_class c;
+    char padded[PDB_ATOM_NAME_STRL + 3];
+    int i, j;
+
+    ck_assert_ptr_ne(clf->index, NULL);
+    for (i = 0; i < clf->n_residues; ++i) {
+        res = clf->residue[i];
+        for (j = 0; j < res->n_atoms; ++j) {
+            ck_assert_ptr_ne(index_find(clf->index, index_key(res->name, res->atom_name[j])), NULL);
+            sprintf(padded, " %s ", res->atom_name[j]);
+            ck_assert_int_eq(freesasa_classifier_lookup(clf, res->name, padded, &r, &c),
+                             FREESASA_SUCCESS);
+            ck_assert(fabs(r - res->atom_radius[j]) < 1e-10);
+            ck_assert_int_eq(c, res->atom_class[j]);
+        }
+    }
+}
+
+START_TEST(test_classifier_index)
+{
+    struct classifier_types *types = freesasa_classifier_types_new();
+    struct freesasa_classifier *clf = freesasa_classifier_new();
+    double r;
+    freesasa_atom_class c;
+
+    check_index(&freesasa_protor_classifier);
+    check_index(&freesasa_naccess_classifier);
+    check_index(&freesasa_oons_classifier);
+
+    ck_assert_int_eq(read_types_line(types, "a 1.0 apolar"), FREESASA_SUCCESS);
+    ck_assert_int_eq(read_types_line(types, "b 2.0 polar"), FREESASA_SUCCESS);
+    ck_assert_int_eq(read_atoms_line(clf, types, "ANY CA a"), FREESASA_SUCCESS);
+    ck_assert_int_eq(read_atoms_line(clf, types, "ALA CB b"), FREESASA_SUCCESS);
+    ck_assert_int_eq(read_atoms_line(clf, types, "ARG CB a"), FREESASA_SUCCESS);
+    ck_assert_int_eq(read_atoms_line(clf, types, "ARG NH1 b"), FREESASA_SUCCESS);
+    ck_assert_ptr_eq(clf->index, NULL);
+    ck_assert_int_eq(classifier_build_index(clf), FREESASA_SUCCESS);
+    check_index(clf);
+
+    /* fall back to ANY, both for known and unknown residues */
+    ck_assert_int_eq(freesasa_classifier_lookup(clf, "ALA", " CA ", &r, &c), FREESASA_SUCCESS);
+    ck_assert(fabs(r - 1.0) < 1e-10);
+    ck_assert_int_eq(c, FREESASA_ATOM_APOLAR);
+    ck_assert_int_eq(freesasa_classifier_lookup(clf, "XXX", " CA ", &r, &c), FREESASA_SUCCESS);
+    ck_assert(fabs(r - 1.0) < 1e-10);
+    ck_assert_int_eq(freesasa_classifier_lookup(clf, "ALA", " X  ", &r, &c), FREESASA_WARN);
+    ck_assert(r < 0);
+    ck_assert_int_eq(c, FREESASA_ATOM_UNKNOWN);
+
+    /* names that are too long for the index can only match ANY */
+    ck_assert_int_eq(index_key("ALAX", "CA"), 0);
+    ck_assert_int_eq(index_key("ALA", "CAXXX"), 0);
+    ck_assert_int_eq(freesasa_classifier_lookup(clf, "ALAX", "CA", &r, &c), FREESASA_SUCCESS);
+    ck_assert_int_eq(freesasa_classifier_lookup(clf, "ALA", "CAXXX", &r, &c), FREESASA_WARN);
+
+    /* adding residues invalidates the index */
+    ck_assert_int_ge(freesasa_classifier_add_residue(clf, "NEW"), 0);
+    ck_assert_ptr_eq(clf->index, NULL);
+    ck_assert_int_eq(freesasa_classifier_lookup(clf, "ALA", " CA ", &r, &c), FREESASA_SUCCESS);
+
+    freesasa_classifier_free(clf);
+    freesasa_classifier_types_free(types);
+}
+END_TEST
+
+/* Compile, read back and compare all atoms and references */
+static void
+check_compiled(const freesasa_classifier *clf)
+{
+    FILE *tf = tmpfile();
+    freesasa_classifier *compiled;
+    const struct classifier_residue *res;
+    const freesasa_nodearea *ref, *ref_compiled;
+    double r1, r2;
+    freesasa_atom_class c1, c2;
+    int i, j;
+
+    ck_assert_ptr_ne(tf, NULL);
+    ck_assert_int_eq(freesasa_classifier_write_compiled(tf, clf), FREESASA_SUCCESS);
+    rewind(tf);
+    compiled = freesasa_classifier_from_file(tf);
+    fclose(tf);
+
+    ck_assert_ptr_ne(compiled, NULL);
+    ck_assert_ptr_ne(compiled->compiled, NULL);
+    ck_assert_str_eq(compiled->name, clf->name);
+
+    for (i = 0; i < clf->n_residues; ++i) {
+        res = clf->residue[i];
+        for (j = 0; j < res->n_atoms; ++j) {
+            freesasa_classifier_lookup(clf, res->name, res->atom_name[j], &r1, &c1);
+            freesasa_classifier_lookup(compiled, res->name, res->atom_name[j], &r2, &c2);
+            ck_assert(r1 == r2);
+            ck_assert_int_eq(c1, c2);
+        }
+        ref = freesasa_classifier_residue_reference(clf, res->name);
+        ref_compiled = freesasa_classifier_residue_reference(compiled, res->name);
+        ck_assert_ptr_ne(ref_compiled, NULL);
+        if (ref->name == NULL) {
+            ck_assert_ptr_eq(ref_compiled->name, NULL);
+        } else {
+            ck_assert_str_eq(ref_compiled->name, ref->name);
+        }
+        ck_assert(ref->total == ref_compiled->total);
+        ck_assert(ref->side_chain == ref_compiled->side_chain);
+        ck_assert(ref->apolar == ref_compiled->apolar);
+    }
+    ck_assert_ptr_eq(freesasa_classifier_residue_reference(compiled, "XXX"), NULL);
+    ck_assert_int_lt(freesasa_classifier_add_residue(compiled, "XXX"), 0);
+
+    freesasa_classifier_free(compiled);
+}
+
+START_TEST(test_classifier_compiled)
+{
+    FILE *tf;
+    char buf[64];
+    size_t n;
+
+    check_compiled(&freesasa_protor_classifier);
+    check_compiled(&freesasa_naccess_classifier);
+    check_compiled(&freesasa_oons_classifier);
+
+    /* truncated file */
+    tf = tmpfile();
+    ck_assert_int_eq(freesasa_classifier_write_compiled(tf, &freesasa_protor_classifier), FREESASA_SUCCESS);
+    rewind(tf);
+    n = fread(buf, 1, sizeof(buf), tf);
+    ck_assert_int_eq(n, sizeof(buf));
+    fclose(tf);
+    tf = tmpfile();
+    fwrite(buf, 1, sizeof(buf), tf);
+    rewind(tf);
+    freesasa_set_verbosity(FREESASA_V_SILENT);
+    ck_assert_ptr_eq(freesasa_classifier_from_file(tf), NULL);
+    freesasa_set_verbosity(FREESASA_V_NORMAL);
+    fclose(tf);
+}
+END_TEST
+
 TCase *
 test_classifier_static()
 {
     TCase *tc = tcase_create("classifier.c static");
     tcase_add_test(tc, test_classifier);
     tcase_add_test(tc, test_classifier_utils);
+    tcase_add_test(tc, test_classifier_index);
+    tcase_add_test(tc, test_classifier_compiled);
 
     return tc;
 }
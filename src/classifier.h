@@ -1,6 +1,8 @@
 #ifndef CLASSIFIER_H
 #define CLASSIFIER_H
 
+#include <stdint.h>
+
 #include "freesasa_internal.h"
 
 /**
@@ -46,6 +48,44 @@ struct classifier_residue {
     freesasa_nodearea max_area;      /**< Maximum area (for RSA) */
 };
 
+/**
+    An entry in a ::classifier_index. The key packs the residue name
+    (3 bytes) and atom name (4 bytes), whitespace trimmed and zero
+    padded, into one integer. Empty slots have key 0.
+ */
+struct classifier_index_entry {
+    uint64_t key;                  /**< Packed residue and atom name */
+    double radius;                 /**< Atomic radius */
+    freesasa_atom_class the_class; /**< Class of atom */
+};
+
+/**
+    Perfect hash from (residue, atom) to radius and class, using
+    hash-and-displace: a key is first hashed with seed 0 to find its
+    bucket, the seed stored for that bucket then gives its slot. The
+    seeds are chosen so that no two keys share a slot, so a lookup is
+    two hashes and one key comparison.
+
+    The static classifiers have their index generated by
+    `scripts/config2c.pl`, classifiers read from file get theirs when
+    they are read. The hash function here and in the script have to
+    match.
+ */
+struct classifier_index {
+    int n_buckets;                        /**< Number of buckets */
+    int n_slots;                          /**< Number of slots */
+    unsigned int *seed;                   /**< Seed for each bucket */
+    struct classifier_index_entry *slot;  /**< The slots */
+};
+
+/**
+    Data of a classifier read from a compiled file (see
+    freesasa_classifier_write_compiled()). Such classifiers have no
+    residue arrays, all lookups go through the index, which points
+    into the compiled data.
+ */
+struct classifier_compiled;
+
 /**
     Stores a user-configuration as extracted from a configuration
     file. No info about types, since those are only a tool used
@@ -63,6 +103,9 @@ struct freesasa_classifier {
     char **residue_name; /**< Names of residues */
     char *name;
     struct classifier_residue **residue;
+    struct classifier_index *index;         /**< NULL means linear search */
+    struct classifier_compiled *compiled;   /**< Non-NULL if read from compiled file */
+    unsigned long id;                       /**< Unique for classifiers created by freesasa_classifier_new(), 0 for static ones */
 };
 
 /**
@@ -71,6 +114,28 @@ struct freesasa_classifier {
 double
 freesasa_guess_radius(const char *symbol);
 
+/**
+    Look up radius and class of an atom in one go.
+
+    Leading and trailing whitespace in the names is ignored. If the
+    atom is not found for the given residue, the residue `ANY` is
+    tried.
+
+    @param classifier The classifier.
+    @param res_name Residue name.
+    @param atom_name Atom name.
+    @param radius The radius is written here, -1 if not found.
+    @param the_class The class is written here,
+      ::FREESASA_ATOM_UNKNOWN if not found.
+    @return ::FREESASA_SUCCESS if the atom was found,
+      ::FREESASA_WARN if not.
+ */
+int freesasa_classifier_lookup(const freesasa_classifier *classifier,
+                               const char *res_name,
+                               const char *atom_name,
+                               double *radius,
+                               freesasa_atom_class *the_class);
+
 const freesasa_nodearea *
 freesasa_classifier_residue_reference(const freesasa_classifier *classifier,
                                       const char *res_name);
@@ -3,9 +3,9 @@
 /* Autogenerated code from the script config2c.pl */
 
 static const char *naccess_residue_name[] = {"A", "ALA", "ANY", "ARG", "ASN", "ASP", "C", "CYS", "DA", "DC", "DG", "DI", "DT", "DU", "G", "GLN", "GLU", "GLY", "HIS", "I", "ILE", "LEU", "LYS", "MET", "PHE", "PRO", "SEC", "SER", "T", "THR", "TRP", "TYR", "U", "VAL", };
-static const char *naccess_A_atom_name[] = {"C5", "C8", "N9", "N1", "N7", "N6", "C2", "N3", "C6", "C4", };
-static double naccess_A_atom_radius[] = {1.80, 1.80, 1.60, 1.60, 1.60, 1.60, 1.80, 1.60, 1.80, 1.80, };
-static int naccess_A_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, };
+static const char *naccess_A_atom_name[] = {"C2", "C4", "C5", "C6", "C8", "N1", "N3", "N6", "N7", "N9", };
+static double naccess_A_atom_radius[] = {1.80, 1.80, 1.80, 1.80, 1.80, 1.60, 1.60, 1.60, 1.60, 1.60, };
+static int naccess_A_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue naccess_A_cfg = {
     10,
  "A",
@@ -27,9 +27,9 @@ static struct classifier_residue naccess_ALA_cfg = {
  {"ALA", 107.89, 43.94, 63.94, 36.71, 71.17, 0},
 };
 
-static const char *naccess_ANY_atom_name[] = {"OXT", "O5'", "C", "P", "N", "CB", "OP1", "C5'", "O", "CA", "C3'", "C4'", "C1'", "C2'", "O4'", "O3'", "OP3", "OP2", "O2'", };
-static double naccess_ANY_atom_radius[] = {1.40, 1.40, 1.76, 1.90, 1.65, 1.87, 1.40, 1.80, 1.40, 1.87, 1.80, 1.80, 1.80, 1.80, 1.40, 1.40, 1.40, 1.40, 1.40, };
-static int naccess_ANY_atom_class[] = {FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
+static const char *naccess_ANY_atom_name[] = {"C", "C1'", "C2'", "C3'", "C4'", "C5'", "CA", "CB", "N", "O", "O2'", "O3'", "O4'", "O5'", "OP1", "OP2", "OP3", "OXT", "P", };
+static double naccess_ANY_atom_radius[] = {1.76, 1.80, 1.80, 1.80, 1.80, 1.80, 1.87, 1.87, 1.65, 1.40, 1.40, 1.40, 1.40, 1.40, 1.40, 1.40, 1.40, 1.40, 1.90, };
+static int naccess_ANY_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, };
 static struct classifier_residue naccess_ANY_cfg = {
     19,
  "ANY",
@@ -39,9 +39,9 @@ static struct classifier_residue naccess_ANY_cfg = {
  {NULL, 0, 0, 0, 0, 0},
 };
 
-static const char *naccess_ARG_atom_name[] = {"NH2", "CD", "NE", "CG", "CZ", "NH1", };
-static double naccess_ARG_atom_radius[] = {1.65, 1.87, 1.65, 1.87, 1.76, 1.65, };
-static int naccess_ARG_atom_class[] = {FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, };
+static const char *naccess_ARG_atom_name[] = {"CD", "CG", "CZ", "NE", "NH1", "NH2", };
+static double naccess_ARG_atom_radius[] = {1.87, 1.87, 1.76, 1.65, 1.65, 1.65, };
+static int naccess_ARG_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue naccess_ARG_cfg = {
     6,
  "ARG",
@@ -51,8 +51,8 @@ static struct classifier_residue naccess_ARG_cfg = {
  {"ARG", 238.33, 41.72, 196.61, 161.10, 77.23, 0},
 };
 
-static const char *naccess_ASN_atom_name[] = {"CG", "OD1", "ND2", };
-static double naccess_ASN_atom_radius[] = {1.76, 1.40, 1.65, };
+static const char *naccess_ASN_atom_name[] = {"CG", "ND2", "OD1", };
+static double naccess_ASN_atom_radius[] = {1.76, 1.65, 1.40, };
 static int naccess_ASN_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue naccess_ASN_cfg = {
     3,
@@ -63,9 +63,9 @@ static struct classifier_residue naccess_ASN_cfg = {
  {"ASN", 143.97, 41.03, 102.94, 97.83, 46.14, 0},
 };
 
-static const char *naccess_ASP_atom_name[] = {"OD1", "OD2", "CG", };
-static double naccess_ASP_atom_radius[] = {1.40, 1.40, 1.76, };
-static int naccess_ASP_atom_class[] = {FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, };
+static const char *naccess_ASP_atom_name[] = {"CG", "OD1", "OD2", };
+static double naccess_ASP_atom_radius[] = {1.76, 1.40, 1.40, };
+static int naccess_ASP_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue naccess_ASP_cfg = {
     3,
  "ASP",
@@ -75,9 +75,9 @@ static struct classifier_residue naccess_ASP_cfg = {
  {"ASP", 140.48, 41.76, 98.72, 91.19, 49.29, 0},
 };
 
-static const char *naccess_C_atom_name[] = {"C6", "C4", "N3", "N4", "C2", "N1", "C5", "O2", };
-static double naccess_C_atom_radius[] = {1.80, 1.80, 1.60, 1.60, 1.80, 1.60, 1.80, 1.40, };
-static int naccess_C_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, };
+static const char *naccess_C_atom_name[] = {"C2", "C4", "C5", "C6", "N1", "N3", "N4", "O2", };
+static double naccess_C_atom_radius[] = {1.80, 1.80, 1.80, 1.80, 1.60, 1.60, 1.60, 1.40, };
+static int naccess_C_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue naccess_C_cfg = {
     8,
  "C",
@@ -99,9 +99,9 @@ static struct classifier_residue naccess_CYS_cfg = {
  {"CYS", 134.24, 41.92, 92.33, 36.49, 97.75, 0},
 };
 
-static const char *naccess_DA_atom_name[] = {"N6", "N7", "N3", "C2", "C6", "C4", "C5", "C8", "N1", "N9", };
-static double naccess_DA_atom_radius[] = {1.60, 1.60, 1.60, 1.80, 1.80, 1.80, 1.80, 1.80, 1.60, 1.60, };
-static int naccess_DA_atom_class[] = {FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
+static const char *naccess_DA_atom_name[] = {"C2", "C4", "C5", "C6", "C8", "N1", "N3", "N6", "N7", "N9", };
+static double naccess_DA_atom_radius[] = {1.80, 1.80, 1.80, 1.80, 1.80, 1.60, 1.60, 1.60, 1.60, 1.60, };
+static int naccess_DA_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue naccess_DA_cfg = {
     10,
  "DA",
@@ -111,9 +111,9 @@ static struct classifier_residue naccess_DA_cfg = {
  {NULL, 0, 0, 0, 0, 0},
 };
 
-static const char *naccess_DC_atom_name[] = {"N1", "C5", "O2", "C6", "C4", "N3", "N4", "C2", };
-static double naccess_DC_atom_radius[] = {1.60, 1.80, 1.40, 1.80, 1.80, 1.60, 1.60, 1.80, };
-static int naccess_DC_atom_class[] = {FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, };
+static const char *naccess_DC_atom_name[] = {"C2", "C4", "C5", "C6", "N1", "N3", "N4", "O2", };
+static double naccess_DC_atom_radius[] = {1.80, 1.80, 1.80, 1.80, 1.60, 1.60, 1.60, 1.40, };
+static int naccess_DC_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue naccess_DC_cfg = {
     8,
  "DC",
@@ -123,9 +123,9 @@ static struct classifier_residue naccess_DC_cfg = {
  {NULL, 0, 0, 0, 0, 0},
 };
 
-static const char *naccess_DG_atom_name[] = {"N1", "N9", "C5", "C8", "O6", "C6", "C4", "N2", "N7", "N3", "C2", };
-static double naccess_DG_atom_radius[] = {1.60, 1.60, 1.80, 1.80, 1.40, 1.80, 1.80, 1.60, 1.60, 1.60, 1.80, };
-static int naccess_DG_atom_class[] = {FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, };
+static const char *naccess_DG_atom_name[] = {"C2", "C4", "C5", "C6", "C8", "N1", "N2", "N3", "N7", "N9", "O6", };
+static double naccess_DG_atom_radius[] = {1.80, 1.80, 1.80, 1.80, 1.80, 1.60, 1.60, 1.60, 1.60, 1.60, 1.40, };
+static int naccess_DG_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue naccess_DG_cfg = {
     11,
  "DG",
@@ -135,9 +135,9 @@ static struct classifier_residue naccess_DG_cfg = {
  {NULL, 0, 0, 0, 0, 0},
 };
 
-static const char *naccess_DI_atom_name[] = {"N7", "N3", "C2", "O6", "C6", "C4", "C5", "C8", "N1", "N9", };
-static double naccess_DI_atom_radius[] = {1.60, 1.60, 1.80, 1.40, 1.80, 1.80, 1.80, 1.80, 1.60, 1.60, };
-static int naccess_DI_atom_class[] = {FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
+static const char *naccess_DI_atom_name[] = {"C2", "C4", "C5", "C6", "C8", "N1", "N3", "N7", "N9", "O6", };
+static double naccess_DI_atom_radius[] = {1.80, 1.80, 1.80, 1.80, 1.80, 1.60, 1.60, 1.60, 1.60, 1.40, };
+static int naccess_DI_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue naccess_DI_cfg = {
     10,
  "DI",
@@ -147,9 +147,9 @@ static struct classifier_residue naccess_DI_cfg = {
  {NULL, 0, 0, 0, 0, 0},
 };
 
-static const char *naccess_DT_atom_name[] = {"O4", "N1", "O2", "C5", "C4", "C7", "C6", "N3", "C2", };
-static double naccess_DT_atom_radius[] = {1.40, 1.60, 1.40, 1.80, 1.80, 1.80, 1.80, 1.60, 1.80, };
-static int naccess_DT_atom_class[] = {FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, };
+static const char *naccess_DT_atom_name[] = {"C2", "C4", "C5", "C6", "C7", "N1", "N3", "O2", "O4", };
+static double naccess_DT_atom_radius[] = {1.80, 1.80, 1.80, 1.80, 1.80, 1.60, 1.60, 1.40, 1.40, };
+static int naccess_DT_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue naccess_DT_cfg = {
     9,
  "DT",
@@ -159,9 +159,9 @@ static struct classifier_residue naccess_DT_cfg = {
  {NULL, 0, 0, 0, 0, 0},
 };
 
-static const char *naccess_DU_atom_name[] = {"C2", "N3", "C6", "C4", "O2", "C5", "O4", "N1", };
-static double naccess_DU_atom_radius[] = {1.80, 1.60, 1.80, 1.80, 1.40, 1.80, 1.40, 1.60, };
-static int naccess_DU_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
+static const char *naccess_DU_atom_name[] = {"C2", "C4", "C5", "C6", "N1", "N3", "O2", "O4", };
+static double naccess_DU_atom_radius[] = {1.80, 1.80, 1.80, 1.80, 1.60, 1.60, 1.40, 1.40, };
+static int naccess_DU_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue naccess_DU_cfg = {
     8,
  "DU",
@@ -171,9 +171,9 @@ static struct classifier_residue naccess_DU_cfg = {
  {NULL, 0, 0, 0, 0, 0},
 };
 
-static const char *naccess_G_atom_name[] = {"N1", "N9", "C8", "C5", "C4", "O6", "C6", "N3", "C2", "N2", "N7", };
-static double naccess_G_atom_radius[] = {1.60, 1.60, 1.80, 1.80, 1.80, 1.40, 1.80, 1.60, 1.80, 1.60, 1.60, };
-static int naccess_G_atom_class[] = {FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
+static const char *naccess_G_atom_name[] = {"C2", "C4", "C5", "C6", "C8", "N1", "N2", "N3", "N7", "N9", "O6", };
+static double naccess_G_atom_radius[] = {1.80, 1.80, 1.80, 1.80, 1.80, 1.60, 1.60, 1.60, 1.60, 1.60, 1.40, };
+static int naccess_G_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue naccess_G_cfg = {
     11,
  "G",
@@ -183,9 +183,9 @@ static struct classifier_residue naccess_G_cfg = {
  {NULL, 0, 0, 0, 0, 0},
 };
 
-static const char *naccess_GLN_atom_name[] = {"OE1", "CD", "CG", "NE2", };
-static double naccess_GLN_atom_radius[] = {1.40, 1.76, 1.87, 1.65, };
-static int naccess_GLN_atom_class[] = {FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, };
+static const char *naccess_GLN_atom_name[] = {"CD", "CG", "NE2", "OE1", };
+static double naccess_GLN_atom_radius[] = {1.76, 1.87, 1.65, 1.40, };
+static int naccess_GLN_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue naccess_GLN_cfg = {
     4,
  "GLN",
@@ -195,9 +195,9 @@ static struct classifier_residue naccess_GLN_cfg = {
  {"GLN", 178.24, 41.72, 136.52, 126.35, 51.89, 0},
 };
 
-static const char *naccess_GLU_atom_name[] = {"OE2", "CG", "CD", "OE1", };
-static double naccess_GLU_atom_radius[] = {1.40, 1.87, 1.76, 1.40, };
-static int naccess_GLU_atom_class[] = {FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, };
+static const char *naccess_GLU_atom_name[] = {"CD", "CG", "OE1", "OE2", };
+static double naccess_GLU_atom_radius[] = {1.76, 1.87, 1.40, 1.40, };
+static int naccess_GLU_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue naccess_GLU_cfg = {
     4,
  "GLU",
@@ -219,7 +219,7 @@ static struct classifier_residue naccess_GLY_cfg = {
  {"GLY", 80.30, 80.30, 0.00, 42.62, 37.69, 0},
 };
 
-static const char *naccess_HIS_atom_name[] = {"CG", "CD2", "CE1", "NE2", "ND1", };
+static const char *naccess_HIS_atom_name[] = {"CD2", "CE1", "CG", "ND1", "NE2", };
 static double naccess_HIS_atom_radius[] = {1.76, 1.76, 1.76, 1.65, 1.65, };
 static int naccess_HIS_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue naccess_HIS_cfg = {
@@ -231,9 +231,9 @@ static struct classifier_residue naccess_HIS_cfg = {
  {"HIS", 182.75, 38.76, 143.99, 85.61, 97.14, 0},
 };
 
-static const char *naccess_I_atom_name[] = {"C4", "O6", "C6", "N3", "C2", "N7", "N1", "N9", "C8", "C5", };
-static double naccess_I_atom_radius[] = {1.80, 1.40, 1.80, 1.60, 1.80, 1.60, 1.60, 1.60, 1.80, 1.80, };
-static int naccess_I_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, };
+static const char *naccess_I_atom_name[] = {"C2", "C4", "C5", "C6", "C8", "N1", "N3", "N7", "N9", "O6", };
+static double naccess_I_atom_radius[] = {1.80, 1.80, 1.80, 1.80, 1.80, 1.60, 1.60, 1.60, 1.60, 1.40, };
+static int naccess_I_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue naccess_I_cfg = {
     10,
  "I",
@@ -243,7 +243,7 @@ static struct classifier_residue naccess_I_cfg = {
  {NULL, 0, 0, 0, 0, 0},
 };
 
-static const char *naccess_ILE_atom_name[] = {"CG1", "CG2", "CD1", };
+static const char *naccess_ILE_atom_name[] = {"CD1", "CG1", "CG2", };
 static double naccess_ILE_atom_radius[] = {1.87, 1.87, 1.87, };
 static int naccess_ILE_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, };
 static struct classifier_residue naccess_ILE_cfg = {
@@ -255,7 +255,7 @@ static struct classifier_residue naccess_ILE_cfg = {
  {"ILE", 175.10, 41.16, 133.94, 36.10, 139.00, 0},
 };
 
-static const char *naccess_LEU_atom_name[] = {"CD2", "CG", "CD1", };
+static const char *naccess_LEU_atom_name[] = {"CD1", "CD2", "CG", };
 static double naccess_LEU_atom_radius[] = {1.87, 1.87, 1.87, };
 static int naccess_LEU_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, };
 static struct classifier_residue naccess_LEU_cfg = {
@@ -267,9 +267,9 @@ static struct classifier_residue naccess_LEU_cfg = {
  {"LEU", 178.40, 39.50, 138.90, 36.45, 141.95, 0},
 };
 
-static const char *naccess_LYS_atom_name[] = {"NZ", "CG", "CE", "CD", };
-static double naccess_LYS_atom_radius[] = {1.50, 1.87, 1.87, 1.87, };
-static int naccess_LYS_atom_class[] = {FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, };
+static const char *naccess_LYS_atom_name[] = {"CD", "CE", "CG", "NZ", };
+static double naccess_LYS_atom_radius[] = {1.87, 1.87, 1.87, 1.50, };
+static int naccess_LYS_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue naccess_LYS_cfg = {
     4,
  "LYS",
@@ -291,7 +291,7 @@ static struct classifier_residue naccess_MET_cfg = {
  {"MET", 193.72, 41.72, 152.00, 36.45, 157.27, 0},
 };
 
-static const char *naccess_PHE_atom_name[] = {"CD1", "CZ", "CG", "CD2", "CE2", "CE1", };
+static const char *naccess_PHE_atom_name[] = {"CD1", "CD2", "CE1", "CE2", "CG", "CZ", };
 static double naccess_PHE_atom_radius[] = {1.76, 1.76, 1.76, 1.76, 1.76, 1.76, };
 static int naccess_PHE_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, };
 static struct classifier_residue naccess_PHE_cfg = {
@@ -339,9 +339,9 @@ static struct classifier_residue naccess_SER_cfg = {
  {"SER", 116.56, 43.38, 73.18, 68.03, 48.53, 0},
 };
 
-static const char *naccess_T_atom_name[] = {"C5", "O2", "N1", "O4", "C2", "N3", "C6", "C7", "C4", };
-static double naccess_T_atom_radius[] = {1.80, 1.40, 1.60, 1.40, 1.80, 1.60, 1.80, 1.80, 1.80, };
-static int naccess_T_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, };
+static const char *naccess_T_atom_name[] = {"C2", "C4", "C5", "C6", "C7", "N1", "N3", "O2", "O4", };
+static double naccess_T_atom_radius[] = {1.80, 1.80, 1.80, 1.80, 1.80, 1.60, 1.60, 1.40, 1.40, };
+static int naccess_T_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue naccess_T_cfg = {
     9,
  "T",
@@ -351,9 +351,9 @@ static struct classifier_residue naccess_T_cfg = {
  {NULL, 0, 0, 0, 0, 0},
 };
 
-static const char *naccess_THR_atom_name[] = {"OG1", "CG2", };
-static double naccess_THR_atom_radius[] = {1.40, 1.87, };
-static int naccess_THR_atom_class[] = {FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, };
+static const char *naccess_THR_atom_name[] = {"CG2", "OG1", };
+static double naccess_THR_atom_radius[] = {1.87, 1.40, };
+static int naccess_THR_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue naccess_THR_cfg = {
     2,
  "THR",
@@ -363,7 +363,7 @@ static struct classifier_residue naccess_THR_cfg = {
  {"THR", 139.25, 41.70, 97.55, 63.50, 75.75, 0},
 };
 
-static const char *naccess_TRP_atom_name[] = {"CZ3", "CZ2", "CE2", "CG", "CD1", "CE3", "CD2", "CH2", "NE1", };
+static const char *naccess_TRP_atom_name[] = {"CD1", "CD2", "CE2", "CE3", "CG", "CH2", "CZ2", "CZ3", "NE1", };
 static double naccess_TRP_atom_radius[] = {1.76, 1.76, 1.76, 1.76, 1.76, 1.76, 1.76, 1.76, 1.65, };
 static int naccess_TRP_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue naccess_TRP_cfg = {
@@ -375,9 +375,9 @@ static struct classifier_residue naccess_TRP_cfg = {
  {"TRP", 248.97, 42.38, 206.59, 59.83, 189.14, 0},
 };
 
-static const char *naccess_TYR_atom_name[] = {"CE1", "CE2", "CG", "CD2", "OH", "CZ", "CD1", };
-static double naccess_TYR_atom_radius[] = {1.76, 1.76, 1.76, 1.76, 1.40, 1.76, 1.76, };
-static int naccess_TYR_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, };
+static const char *naccess_TYR_atom_name[] = {"CD1", "CD2", "CE1", "CE2", "CG", "CZ", "OH", };
+static double naccess_TYR_atom_radius[] = {1.76, 1.76, 1.76, 1.76, 1.76, 1.76, 1.40, };
+static int naccess_TYR_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue naccess_TYR_cfg = {
     7,
  "TYR",
@@ -387,9 +387,9 @@ static struct classifier_residue naccess_TYR_cfg = {
  {"TYR", 212.23, 38.13, 174.10, 76.34, 135.89, 0},
 };
 
-static const char *naccess_U_atom_name[] = {"N3", "C2", "C6", "C4", "O2", "C5", "N1", "O4", };
-static double naccess_U_atom_radius[] = {1.60, 1.80, 1.80, 1.80, 1.40, 1.80, 1.60, 1.40, };
-static int naccess_U_atom_class[] = {FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
+static const char *naccess_U_atom_name[] = {"C2", "C4", "C5", "C6", "N1", "N3", "O2", "O4", };
+static double naccess_U_atom_radius[] = {1.80, 1.80, 1.80, 1.80, 1.60, 1.60, 1.40, 1.40, };
+static int naccess_U_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue naccess_U_cfg = {
     8,
  "U",
@@ -399,7 +399,7 @@ static struct classifier_residue naccess_U_cfg = {
  {NULL, 0, 0, 0, 0, 0},
 };
 
-static const char *naccess_VAL_atom_name[] = {"CG2", "CG1", };
+static const char *naccess_VAL_atom_name[] = {"CG1", "CG2", };
 static double naccess_VAL_atom_radius[] = {1.87, 1.87, };
 static int naccess_VAL_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, };
 static struct classifier_residue naccess_VAL_cfg = {
@@ -414,9 +414,277 @@ static struct classifier_residue naccess_VAL_cfg = {
 static struct classifier_residue *naccess_residue_cfg[] = {
     &naccess_A_cfg, &naccess_ALA_cfg, &naccess_ANY_cfg, &naccess_ARG_cfg, &naccess_ASN_cfg, &naccess_ASP_cfg, &naccess_C_cfg, &naccess_CYS_cfg, &naccess_DA_cfg, &naccess_DC_cfg, &naccess_DG_cfg, &naccess_DI_cfg, &naccess_DT_cfg, &naccess_DU_cfg, &naccess_G_cfg, &naccess_GLN_cfg, &naccess_GLU_cfg, &naccess_GLY_cfg, &naccess_HIS_cfg, &naccess_I_cfg, &naccess_ILE_cfg, &naccess_LEU_cfg, &naccess_LYS_cfg, &naccess_MET_cfg, &naccess_PHE_cfg, &naccess_PRO_cfg, &naccess_SEC_cfg, &naccess_SER_cfg, &naccess_T_cfg, &naccess_THR_cfg, &naccess_TRP_cfg, &naccess_TYR_cfg, &naccess_U_cfg, &naccess_VAL_cfg, };
 
+static unsigned int naccess_index_seed[] = {2, 2, 2, 4, 5, 2, 1, 3, 5, 18, 26, 4, 23, 10, 1, 7, 0, 17, 18, 10, 6, 28, 3, 30, 3, 26, 38, 0, 3, 13, 9, 6, 9, 11, 41, 35, 4, 4, 155, 11, 1, 1, 27, 23, 2, 16, 4, 4, 54, 1, 15, };
+
+static struct classifier_index_entry naccess_index_slot[] = {
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x0000003643004744ULL, 1.80, FREESASA_ATOM_APOLAR},
+    {0x0000005a43525954ULL, 1.76, FREESASA_ATOM_APOLAR},
+    {0x000027334f594e41ULL, 1.40, FREESASA_ATOM_POLAR},
+    {0x0000324443454850ULL, 1.76, FREESASA_ATOM_APOLAR},
+    {0x000000324e004744ULL, 1.60, FREESASA_ATOM_POLAR},
+    {0x0000003543004344ULL, 1.80, FREESASA_ATOM_APOLAR},
+    {0x0000003243000049ULL, 1.80, FREESASA_ATOM_APOLAR},
+    {0x0000003843004744ULL, 1.80, FREESASA_ATOM_APOLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x0000003643004344ULL, 1.80, FREESASA_ATOM_APOLAR},
+    {0x000000474355454cULL, 1.87, FREESASA_ATOM_APOLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x000031454f4e4c47ULL, 1.40, FREESASA_ATOM_POLAR},
+    {0x000000334e000055ULL, 1.60, FREESASA_ATOM_POLAR},
+    {0x0000003243000047ULL, 1.80, FREESASA_ATOM_APOLAR},
+    {0x000000344e004344ULL, 1.60, FREESASA_ATOM_POLAR},
+    {0x0000003243000055ULL, 1.80, FREESASA_ATOM_APOLAR},
+    {0x0000273143594e41ULL, 1.80, FREESASA_ATOM_APOLAR},
+    {0x00000047434e5341ULL, 1.76, FREESASA_ATOM_APOLAR},
+    {0x0000003243004744ULL, 1.80, FREESASA_ATOM_APOLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x000031444f4e5341ULL, 1.40, FREESASA_ATOM_POLAR},
+    {0x0000004553434553ULL, 1.80, FREESASA_ATOM_APOLAR},
+    {0x0000003543000047ULL, 1.80, FREESASA_ATOM_APOLAR},
+    {0x0000004243414c41ULL, 1.87, FREESASA_ATOM_APOLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x000000344f000055ULL, 1.40, FREESASA_ATOM_POLAR},
+    {0x000000314e005544ULL, 1.60, FREESASA_ATOM_POLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x0000003243004144ULL, 1.80, FREESASA_ATOM_APOLAR},
+    {0x000000364f004944ULL, 1.40, FREESASA_ATOM_POLAR},
+    {0x0000324843505254ULL, 1.76, FREESASA_ATOM_APOLAR},
+    {0x000000344f000054ULL, 1.40, FREESASA_ATOM_POLAR},
+    {0x000000445354454dULL, 1.85, FREESASA_ATOM_APOLAR},
+    {0x00000044434f5250ULL, 1.87, FREESASA_ATOM_APOLAR},
+    {0x000000334e004944ULL, 1.60, FREESASA_ATOM_POLAR},
+    {0x0000003643000043ULL, 1.80, FREESASA_ATOM_APOLAR},
+    {0x000031444355454cULL, 1.87, FREESASA_ATOM_APOLAR},
+    {0x000000314e000043ULL, 1.60, FREESASA_ATOM_POLAR},
+    {0x000033504f594e41ULL, 1.40, FREESASA_ATOM_POLAR},
+    {0x0000003543000054ULL, 1.80, FREESASA_ATOM_APOLAR},
+    {0x0000324543525954ULL, 1.76, FREESASA_ATOM_APOLAR},
+    {0x000000364f004744ULL, 1.40, FREESASA_ATOM_POLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x000032484e475241ULL, 1.65, FREESASA_ATOM_POLAR},
+    {0x0000005a43454850ULL, 1.76, FREESASA_ATOM_APOLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x0000314443505254ULL, 1.76, FREESASA_ATOM_APOLAR},
+    {0x0000003543004944ULL, 1.80, FREESASA_ATOM_APOLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x0000273543594e41ULL, 1.80, FREESASA_ATOM_APOLAR},
+    {0x000031444e534948ULL, 1.65, FREESASA_ATOM_POLAR},
+    {0x000000334e005544ULL, 1.60, FREESASA_ATOM_POLAR},
+    {0x00000047434f5250ULL, 1.87, FREESASA_ATOM_APOLAR},
+    {0x0000003443000055ULL, 1.80, FREESASA_ATOM_APOLAR},
+    {0x0000273443594e41ULL, 1.80, FREESASA_ATOM_APOLAR},
+    {0x0000314743454c49ULL, 1.87, FREESASA_ATOM_APOLAR},
+    {0x000000474f524553ULL, 1.40, FREESASA_ATOM_POLAR},
+    {0x000000324f000054ULL, 1.40, FREESASA_ATOM_POLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x000000444353594cULL, 1.87, FREESASA_ATOM_APOLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x0000004743525954ULL, 1.76, FREESASA_ATOM_APOLAR},
+    {0x000000394e004144ULL, 1.60, FREESASA_ATOM_POLAR},
+    {0x0000003543000041ULL, 1.80, FREESASA_ATOM_APOLAR},
+    {0x0000004443475241ULL, 1.87, FREESASA_ATOM_APOLAR},
+    {0x000032454e534948ULL, 1.65, FREESASA_ATOM_POLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x0000003443005444ULL, 1.80, FREESASA_ATOM_APOLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x0000003443004744ULL, 1.80, FREESASA_ATOM_APOLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x0000003543000055ULL, 1.80, FREESASA_ATOM_APOLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x000000394e000041ULL, 1.60, FREESASA_ATOM_POLAR},
+    {0x0000004443554c47ULL, 1.76, FREESASA_ATOM_APOLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x00003147434c4156ULL, 1.87, FREESASA_ATOM_APOLAR},
+    {0x000000454353594cULL, 1.87, FREESASA_ATOM_APOLAR},
+    {0x0000003643005544ULL, 1.80, FREESASA_ATOM_APOLAR},
+    {0x0000003843004944ULL, 1.80, FREESASA_ATOM_APOLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x0000325a43505254ULL, 1.76, FREESASA_ATOM_APOLAR},
+    {0x000000334e000054ULL, 1.60, FREESASA_ATOM_POLAR},
+    {0x0000314543454850ULL, 1.76, FREESASA_ATOM_APOLAR},
+    {0x000000314e004144ULL, 1.60, FREESASA_ATOM_POLAR},
+    {0x0000003543004144ULL, 1.80, FREESASA_ATOM_APOLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x000000344f005444ULL, 1.40, FREESASA_ATOM_POLAR},
+    {0x0000003743005444ULL, 1.80, FREESASA_ATOM_APOLAR},
+    {0x000000454e475241ULL, 1.65, FREESASA_ATOM_POLAR},
+    {0x0000003543004744ULL, 1.80, FREESASA_ATOM_APOLAR},
+    {0x0000005a4e53594cULL, 1.50, FREESASA_ATOM_POLAR},
+    {0x0000324743524854ULL, 1.87, FREESASA_ATOM_APOLAR},
+    {0x0000314543534948ULL, 1.76, FREESASA_ATOM_APOLAR},
+    {0x000000454354454dULL, 1.87, FREESASA_ATOM_APOLAR},
+    {0x0000000043594e41ULL, 1.76, FREESASA_ATOM_APOLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x000031454e505254ULL, 1.65, FREESASA_ATOM_POLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x000000334e004344ULL, 1.60, FREESASA_ATOM_POLAR},
+    {0x0000003843000041ULL, 1.80, FREESASA_ATOM_APOLAR},
+    {0x000000364f000047ULL, 1.40, FREESASA_ATOM_POLAR},
+    {0x0000003243005444ULL, 1.80, FREESASA_ATOM_APOLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x0000324443505254ULL, 1.76, FREESASA_ATOM_APOLAR},
+    {0x000000364e004144ULL, 1.60, FREESASA_ATOM_POLAR},
+    {0x0000335a43505254ULL, 1.76, FREESASA_ATOM_APOLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x0000003643004944ULL, 1.80, FREESASA_ATOM_APOLAR},
+    {0x0000003643005444ULL, 1.80, FREESASA_ATOM_APOLAR},
+    {0x000000314e004744ULL, 1.60, FREESASA_ATOM_POLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x0000003443000041ULL, 1.80, FREESASA_ATOM_APOLAR},
+    {0x0000003843004144ULL, 1.80, FREESASA_ATOM_APOLAR},
+    {0x0000004743505341ULL, 1.76, FREESASA_ATOM_APOLAR},
+    {0x000000484f525954ULL, 1.40, FREESASA_ATOM_POLAR},
+    {0x0000004743534948ULL, 1.76, FREESASA_ATOM_APOLAR},
+    {0x0000314443454c49ULL, 1.87, FREESASA_ATOM_APOLAR},
+    {0x0000003243000043ULL, 1.80, FREESASA_ATOM_APOLAR},
+    {0x000032444f505341ULL, 1.40, FREESASA_ATOM_POLAR},
+    {0x0000003543005544ULL, 1.80, FREESASA_ATOM_APOLAR},
+    {0x000054584f594e41ULL, 1.40, FREESASA_ATOM_POLAR},
+    {0x0000003243000041ULL, 1.80, FREESASA_ATOM_APOLAR},
+    {0x000031444f505341ULL, 1.40, FREESASA_ATOM_POLAR},
+    {0x000000344f005544ULL, 1.40, FREESASA_ATOM_POLAR},
+    {0x0000003643000047ULL, 1.80, FREESASA_ATOM_APOLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x000027354f594e41ULL, 1.40, FREESASA_ATOM_POLAR},
+    {0x000032444e4e5341ULL, 1.65, FREESASA_ATOM_POLAR},
+    {0x0000004753535943ULL, 1.85, FREESASA_ATOM_APOLAR},
+    {0x0000005a43475241ULL, 1.76, FREESASA_ATOM_APOLAR},
+    {0x00003247434c4156ULL, 1.87, FREESASA_ATOM_APOLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x0000004743454850ULL, 1.76, FREESASA_ATOM_APOLAR},
+    {0x000000474354454dULL, 1.87, FREESASA_ATOM_APOLAR},
+    {0x000031474f524854ULL, 1.40, FREESASA_ATOM_POLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x0000003843000049ULL, 1.80, FREESASA_ATOM_APOLAR},
+    {0x0000324543454850ULL, 1.76, FREESASA_ATOM_APOLAR},
+    {0x0000003443005544ULL, 1.80, FREESASA_ATOM_APOLAR},
+    {0x0000324443534948ULL, 1.76, FREESASA_ATOM_APOLAR},
+    {0x0000003643000054ULL, 1.80, FREESASA_ATOM_APOLAR},
+    {0x000027344f594e41ULL, 1.40, FREESASA_ATOM_POLAR},
+    {0x0000324443525954ULL, 1.76, FREESASA_ATOM_APOLAR},
+    {0x0000003443000049ULL, 1.80, FREESASA_ATOM_APOLAR},
+    {0x000000334e004744ULL, 1.60, FREESASA_ATOM_POLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x000000324f000043ULL, 1.40, FREESASA_ATOM_POLAR},
+    {0x0000003643004144ULL, 1.80, FREESASA_ATOM_APOLAR},
+    {0x000000334e004144ULL, 1.60, FREESASA_ATOM_POLAR},
+    {0x000000374e004744ULL, 1.60, FREESASA_ATOM_POLAR},
+    {0x0000004243594e41ULL, 1.87, FREESASA_ATOM_APOLAR},
+    {0x000000374e000049ULL, 1.60, FREESASA_ATOM_POLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x000032454f554c47ULL, 1.40, FREESASA_ATOM_POLAR},
+    {0x000000374e000041ULL, 1.60, FREESASA_ATOM_POLAR},
+    {0x00000047434e4c47ULL, 1.87, FREESASA_ATOM_APOLAR},
+    {0x000000314e004944ULL, 1.60, FREESASA_ATOM_POLAR},
+    {0x0000003843000047ULL, 1.80, FREESASA_ATOM_APOLAR},
+    {0x000000004e594e41ULL, 1.65, FREESASA_ATOM_POLAR},
+    {0x0000334543505254ULL, 1.76, FREESASA_ATOM_APOLAR},
+    {0x000000334e000049ULL, 1.60, FREESASA_ATOM_POLAR},
+    {0x0000003743000054ULL, 1.80, FREESASA_ATOM_APOLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x0000003243004344ULL, 1.80, FREESASA_ATOM_APOLAR},
+    {0x0000003543000049ULL, 1.80, FREESASA_ATOM_APOLAR},
+    {0x000000344e000043ULL, 1.60, FREESASA_ATOM_POLAR},
+    {0x0000314443525954ULL, 1.76, FREESASA_ATOM_APOLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x000000314e000047ULL, 1.60, FREESASA_ATOM_POLAR},
+    {0x0000004143594e41ULL, 1.87, FREESASA_ATOM_APOLAR},
+    {0x000000334e005444ULL, 1.60, FREESASA_ATOM_POLAR},
+    {0x0000003543000043ULL, 1.80, FREESASA_ATOM_APOLAR},
+    {0x000000394e004944ULL, 1.60, FREESASA_ATOM_POLAR},
+    {0x0000003243005544ULL, 1.80, FREESASA_ATOM_APOLAR},
+    {0x000000334e000041ULL, 1.60, FREESASA_ATOM_POLAR},
+    {0x0000273343594e41ULL, 1.80, FREESASA_ATOM_APOLAR},
+    {0x00000044434e4c47ULL, 1.76, FREESASA_ATOM_APOLAR},
+    {0x0000000050594e41ULL, 1.90, FREESASA_ATOM_APOLAR},
+    {0x000000324f004344ULL, 1.40, FREESASA_ATOM_POLAR},
+    {0x000000324f000055ULL, 1.40, FREESASA_ATOM_POLAR},
+    {0x0000004743554c47ULL, 1.87, FREESASA_ATOM_APOLAR},
+    {0x000031504f594e41ULL, 1.40, FREESASA_ATOM_POLAR},
+    {0x0000003443000054ULL, 1.80, FREESASA_ATOM_APOLAR},
+    {0x0000003443000043ULL, 1.80, FREESASA_ATOM_APOLAR},
+    {0x0000003443004144ULL, 1.80, FREESASA_ATOM_APOLAR},
+    {0x000032444355454cULL, 1.87, FREESASA_ATOM_APOLAR},
+    {0x0000003643000049ULL, 1.80, FREESASA_ATOM_APOLAR},
+    {0x000000364e000041ULL, 1.60, FREESASA_ATOM_POLAR},
+    {0x0000003643000055ULL, 1.80, FREESASA_ATOM_APOLAR},
+    {0x000000324e000047ULL, 1.60, FREESASA_ATOM_POLAR},
+    {0x0000324743454c49ULL, 1.87, FREESASA_ATOM_APOLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x0000003443004944ULL, 1.80, FREESASA_ATOM_APOLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x000000324f005544ULL, 1.40, FREESASA_ATOM_POLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x0000003243004944ULL, 1.80, FREESASA_ATOM_APOLAR},
+    {0x000000394e004744ULL, 1.60, FREESASA_ATOM_POLAR},
+    {0x000000364f000049ULL, 1.40, FREESASA_ATOM_POLAR},
+    {0x0000324543505254ULL, 1.76, FREESASA_ATOM_APOLAR},
+    {0x0000004143594c47ULL, 1.87, FREESASA_ATOM_APOLAR},
+    {0x000000334e000047ULL, 1.60, FREESASA_ATOM_POLAR},
+    {0x000000314e000054ULL, 1.60, FREESASA_ATOM_POLAR},
+    {0x000000374e000047ULL, 1.60, FREESASA_ATOM_POLAR},
+    {0x000000374e004144ULL, 1.60, FREESASA_ATOM_POLAR},
+    {0x0000314543525954ULL, 1.76, FREESASA_ATOM_APOLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x000000314e005444ULL, 1.60, FREESASA_ATOM_POLAR},
+    {0x0000004743475241ULL, 1.87, FREESASA_ATOM_APOLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x000000314e000055ULL, 1.60, FREESASA_ATOM_POLAR},
+    {0x000000324f005444ULL, 1.40, FREESASA_ATOM_POLAR},
+    {0x0000003543005444ULL, 1.80, FREESASA_ATOM_APOLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x000031454f554c47ULL, 1.40, FREESASA_ATOM_POLAR},
+    {0x000000314e004344ULL, 1.60, FREESASA_ATOM_POLAR},
+    {0x0000004743505254ULL, 1.76, FREESASA_ATOM_APOLAR},
+    {0x0000003443000047ULL, 1.80, FREESASA_ATOM_APOLAR},
+    {0x000000394e000049ULL, 1.60, FREESASA_ATOM_POLAR},
+    {0x0000003243000054ULL, 1.80, FREESASA_ATOM_APOLAR},
+    {0x000031484e475241ULL, 1.65, FREESASA_ATOM_POLAR},
+    {0x000000374e004944ULL, 1.60, FREESASA_ATOM_POLAR},
+    {0x0000003443004344ULL, 1.80, FREESASA_ATOM_APOLAR},
+    {0x000027324f594e41ULL, 1.40, FREESASA_ATOM_POLAR},
+    {0x000000314e000041ULL, 1.60, FREESASA_ATOM_POLAR},
+    {0x0000314443454850ULL, 1.76, FREESASA_ATOM_APOLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x000032454e4e4c47ULL, 1.65, FREESASA_ATOM_POLAR},
+    {0x0000003643000041ULL, 1.80, FREESASA_ATOM_APOLAR},
+    {0x0000273243594e41ULL, 1.80, FREESASA_ATOM_APOLAR},
+    {0x000032504f594e41ULL, 1.40, FREESASA_ATOM_POLAR},
+    {0x000000474353594cULL, 1.87, FREESASA_ATOM_APOLAR},
+    {0x000000314e000049ULL, 1.60, FREESASA_ATOM_POLAR},
+    {0x000000394e000047ULL, 1.60, FREESASA_ATOM_POLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x000000004f594e41ULL, 1.40, FREESASA_ATOM_POLAR},
+    {0x000000334e000043ULL, 1.60, FREESASA_ATOM_POLAR},
+};
+
+static struct classifier_index naccess_index = {
+    51,
+    253,
+    naccess_index_seed,
+    naccess_index_slot,
+};
+
 const freesasa_classifier freesasa_naccess_classifier = {
     34,    (char**) naccess_residue_name,
     "NACCESS",
     (struct classifier_residue **) naccess_residue_cfg,
+    &naccess_index,
+    NULL,
+    0,
 };
 
@@ -15,9 +15,9 @@ static struct classifier_residue oons_ACE_cfg = {
  {NULL, 0, 0, 0, 0, 0},
 };
 
-static const char *oons_ANY_atom_name[] = {"C8", "C2'", "C2", "C4'", "O6", "N", "N1", "P", "O2", "O2'", "C7", "O", "O4", "O4'", "OP3", "C5'", "N6", "N4", "O3'", "C6", "CA", "C3'", "CM2", "OXT", "C4", "OP2", "C1'", "N9", "CB", "N2", "C", "O5'", "N7", "OP1", "C5", "N3", };
-static double oons_ANY_atom_radius[] = {1.75, 1.75, 1.75, 1.75, 1.40, 1.55, 1.55, 1.80, 1.40, 1.40, 1.75, 1.40, 1.40, 1.40, 1.40, 2.00, 1.55, 1.55, 1.40, 1.75, 2.00, 1.75, 2.00, 1.40, 1.75, 1.40, 1.75, 1.55, 2.00, 1.55, 1.55, 1.40, 1.55, 1.40, 1.75, 1.55, };
-static int oons_ANY_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, };
+static const char *oons_ANY_atom_name[] = {"C", "C1'", "C2", "C2'", "C3'", "C4", "C4'", "C5", "C5'", "C6", "C7", "C8", "CA", "CB", "CM2", "N", "N1", "N2", "N3", "N4", "N6", "N7", "N9", "O", "O2", "O2'", "O3'", "O4", "O4'", "O5'", "O6", "OP1", "OP2", "OP3", "OXT", "P", };
+static double oons_ANY_atom_radius[] = {1.55, 1.75, 1.75, 1.75, 1.75, 1.75, 1.75, 1.75, 2.00, 1.75, 1.75, 1.75, 2.00, 2.00, 2.00, 1.55, 1.55, 1.55, 1.55, 1.55, 1.55, 1.55, 1.55, 1.40, 1.40, 1.40, 1.40, 1.40, 1.40, 1.40, 1.40, 1.40, 1.40, 1.40, 1.40, 1.80, };
+static int oons_ANY_atom_class[] = {FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue oons_ANY_cfg = {
     36,
  "ANY",
@@ -27,9 +27,9 @@ static struct classifier_residue oons_ANY_cfg = {
  {NULL, 0, 0, 0, 0, 0},
 };
 
-static const char *oons_ARG_atom_name[] = {"NH1", "CD", "CZ", "NE", "NH2", "CG", };
-static double oons_ARG_atom_radius[] = {1.55, 2.00, 2.00, 1.55, 1.55, 2.00, };
-static int oons_ARG_atom_class[] = {FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, };
+static const char *oons_ARG_atom_name[] = {"CD", "CG", "CZ", "NE", "NH1", "NH2", };
+static double oons_ARG_atom_radius[] = {2.00, 2.00, 2.00, 1.55, 1.55, 1.55, };
+static int oons_ARG_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue oons_ARG_cfg = {
     6,
  "ARG",
@@ -51,8 +51,8 @@ static struct classifier_residue oons_ASN_cfg = {
  {"ASN", 143.47, 38.26, 105.21, 97.51, 45.97, 0},
 };
 
-static const char *oons_ASP_atom_name[] = {"OD2", "OD1", "CG", };
-static double oons_ASP_atom_radius[] = {1.40, 1.40, 1.55, };
+static const char *oons_ASP_atom_name[] = {"CG", "OD1", "OD2", };
+static double oons_ASP_atom_radius[] = {1.55, 1.40, 1.40, };
 static int oons_ASP_atom_class[] = {FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue oons_ASP_cfg = {
     3,
@@ -63,8 +63,8 @@ static struct classifier_residue oons_ASP_cfg = {
  {"ASP", 141.20, 38.87, 102.33, 95.17, 46.03, 0},
 };
 
-static const char *oons_ASX_atom_name[] = {"AD2", "XD2", "AD1", "XD1", "CG", };
-static double oons_ASX_atom_radius[] = {1.5, 1.5, 1.5, 1.5, 1.55, };
+static const char *oons_ASX_atom_name[] = {"AD1", "AD2", "CG", "XD1", "XD2", };
+static double oons_ASX_atom_radius[] = {1.5, 1.5, 1.55, 1.5, 1.5, };
 static int oons_ASX_atom_class[] = {FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue oons_ASX_cfg = {
     5,
@@ -99,9 +99,9 @@ static struct classifier_residue oons_CYS_cfg = {
  {"CYS", 140.29, 38.44, 101.85, 98.30, 41.99, 0},
 };
 
-static const char *oons_GLN_atom_name[] = {"OE1", "CD", "NE2", "CG", };
-static double oons_GLN_atom_radius[] = {1.40, 1.55, 1.55, 2.00, };
-static int oons_GLN_atom_class[] = {FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, };
+static const char *oons_GLN_atom_name[] = {"CD", "CG", "NE2", "OE1", };
+static double oons_GLN_atom_radius[] = {1.55, 2.00, 1.55, 1.40, };
+static int oons_GLN_atom_class[] = {FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue oons_GLN_cfg = {
     4,
  "GLN",
@@ -111,9 +111,9 @@ static struct classifier_residue oons_GLN_cfg = {
  {"GLN", 176.23, 38.31, 137.92, 122.17, 54.06, 0},
 };
 
-static const char *oons_GLU_atom_name[] = {"OE1", "CD", "OE2", "CG", };
-static double oons_GLU_atom_radius[] = {1.40, 1.55, 1.40, 2.00, };
-static int oons_GLU_atom_class[] = {FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, };
+static const char *oons_GLU_atom_name[] = {"CD", "CG", "OE1", "OE2", };
+static double oons_GLU_atom_radius[] = {1.55, 2.00, 1.40, 1.40, };
+static int oons_GLU_atom_class[] = {FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue oons_GLU_cfg = {
     4,
  "GLU",
@@ -123,9 +123,9 @@ static struct classifier_residue oons_GLU_cfg = {
  {"GLU", 172.43, 38.31, 134.11, 115.92, 56.51, 0},
 };
 
-static const char *oons_GLX_atom_name[] = {"XE2", "CD", "AE1", "AE2", "CG", "XE1", };
-static double oons_GLX_atom_radius[] = {1.5, 1.55, 1.5, 1.5, 2.00, 1.5, };
-static int oons_GLX_atom_class[] = {FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, };
+static const char *oons_GLX_atom_name[] = {"AE1", "AE2", "CD", "CG", "XE1", "XE2", };
+static double oons_GLX_atom_radius[] = {1.5, 1.5, 1.55, 2.00, 1.5, 1.5, };
+static int oons_GLX_atom_class[] = {FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue oons_GLX_cfg = {
     6,
  "GLX",
@@ -135,9 +135,9 @@ static struct classifier_residue oons_GLX_cfg = {
  {NULL, 0, 0, 0, 0, 0},
 };
 
-static const char *oons_HIS_atom_name[] = {"CG", "ND1", "CD2", "CE1", "NE2", };
-static double oons_HIS_atom_radius[] = {1.75, 1.55, 1.75, 1.75, 1.55, };
-static int oons_HIS_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, };
+static const char *oons_HIS_atom_name[] = {"CD2", "CE1", "CG", "ND1", "NE2", };
+static double oons_HIS_atom_radius[] = {1.75, 1.75, 1.75, 1.55, 1.55, };
+static int oons_HIS_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue oons_HIS_cfg = {
     5,
  "HIS",
@@ -159,7 +159,7 @@ static struct classifier_residue oons_HOH_cfg = {
  {NULL, 0, 0, 0, 0, 0},
 };
 
-static const char *oons_ILE_atom_name[] = {"CG2", "CG1", "CD1", };
+static const char *oons_ILE_atom_name[] = {"CD1", "CG1", "CG2", };
 static double oons_ILE_atom_radius[] = {2.00, 2.00, 2.00, };
 static int oons_ILE_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, };
 static struct classifier_residue oons_ILE_cfg = {
@@ -171,7 +171,7 @@ static struct classifier_residue oons_ILE_cfg = {
  {"ILE", 182.12, 37.96, 144.16, 31.67, 150.45, 0},
 };
 
-static const char *oons_LEU_atom_name[] = {"CD1", "CG", "CD2", };
+static const char *oons_LEU_atom_name[] = {"CD1", "CD2", "CG", };
 static double oons_LEU_atom_radius[] = {2.00, 2.00, 2.00, };
 static int oons_LEU_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, };
 static struct classifier_residue oons_LEU_cfg = {
@@ -183,7 +183,7 @@ static struct classifier_residue oons_LEU_cfg = {
  {"LEU", 185.43, 35.34, 150.08, 31.73, 153.69, 0},
 };
 
-static const char *oons_LYS_atom_name[] = {"CE", "CG", "CD", "NZ", };
+static const char *oons_LYS_atom_name[] = {"CD", "CE", "CG", "NZ", };
 static double oons_LYS_atom_radius[] = {2.00, 2.00, 2.00, 1.55, };
 static int oons_LYS_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue oons_LYS_cfg = {
@@ -195,9 +195,9 @@ static struct classifier_residue oons_LYS_cfg = {
  {"LYS", 205.80, 38.31, 167.49, 78.02, 127.78, 0},
 };
 
-static const char *oons_MET_atom_name[] = {"SD", "CE", "CG", };
+static const char *oons_MET_atom_name[] = {"CE", "CG", "SD", };
 static double oons_MET_atom_radius[] = {2.00, 2.00, 2.00, };
-static int oons_MET_atom_class[] = {FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, };
+static int oons_MET_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue oons_MET_cfg = {
     3,
  "MET",
@@ -219,7 +219,7 @@ static struct classifier_residue oons_NH2_cfg = {
  {NULL, 0, 0, 0, 0, 0},
 };
 
-static const char *oons_PHE_atom_name[] = {"CG", "CD1", "CE2", "CZ", "CD2", "CE1", };
+static const char *oons_PHE_atom_name[] = {"CD1", "CD2", "CE1", "CE2", "CG", "CZ", };
 static double oons_PHE_atom_radius[] = {1.75, 1.75, 1.75, 1.75, 1.75, 1.75, };
 static int oons_PHE_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, };
 static struct classifier_residue oons_PHE_cfg = {
@@ -243,9 +243,9 @@ static struct classifier_residue oons_PRO_cfg = {
  {"PRO", 128.18, 31.08, 97.10, 13.95, 114.23, 0},
 };
 
-static const char *oons_PYL_atom_name[] = {"CD2", "CG2", "CB2", "CD", "CA2", "CE2", "O2", "N2", "NZ", "C2", "CG", "CE", };
-static double oons_PYL_atom_radius[] = {1.75, 1.75, 2.00, 2.00, 1.75, 1.75, 1.40, 1.55, 1.55, 1.55, 2.00, 2.00, };
-static int oons_PYL_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, };
+static const char *oons_PYL_atom_name[] = {"C2", "CA2", "CB2", "CD", "CD2", "CE", "CE2", "CG", "CG2", "N2", "NZ", "O2", };
+static double oons_PYL_atom_radius[] = {1.55, 1.75, 2.00, 2.00, 1.75, 2.00, 1.75, 2.00, 1.75, 1.55, 1.55, 1.40, };
+static int oons_PYL_atom_class[] = {FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue oons_PYL_cfg = {
     12,
  "PYL",
@@ -291,9 +291,9 @@ static struct classifier_residue oons_THR_cfg = {
  {"THR", 142.41, 38.32, 104.08, 56.42, 85.99, 0},
 };
 
-static const char *oons_TRP_atom_name[] = {"NE1", "CH2", "CG", "CZ2", "CE3", "CD2", "CE2", "CD1", "CZ3", };
-static double oons_TRP_atom_radius[] = {1.55, 1.75, 1.75, 1.75, 1.75, 1.75, 1.75, 1.75, 1.75, };
-static int oons_TRP_atom_class[] = {FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, };
+static const char *oons_TRP_atom_name[] = {"CD1", "CD2", "CE2", "CE3", "CG", "CH2", "CZ2", "CZ3", "NE1", };
+static double oons_TRP_atom_radius[] = {1.75, 1.75, 1.75, 1.75, 1.75, 1.75, 1.75, 1.75, 1.55, };
+static int oons_TRP_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue oons_TRP_cfg = {
     9,
  "TRP",
@@ -303,9 +303,9 @@ static struct classifier_residue oons_TRP_cfg = {
  {"TRP", 247.08, 39.43, 207.65, 52.90, 194.18, 0},
 };
 
-static const char *oons_TYR_atom_name[] = {"CZ", "CE1", "CD2", "OH", "CG", "CD1", "CE2", };
-static double oons_TYR_atom_radius[] = {1.75, 1.75, 1.75, 1.40, 1.75, 1.75, 1.75, };
-static int oons_TYR_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, };
+static const char *oons_TYR_atom_name[] = {"CD1", "CD2", "CE1", "CE2", "CG", "CZ", "OH", };
+static double oons_TYR_atom_radius[] = {1.75, 1.75, 1.75, 1.75, 1.75, 1.75, 1.40, };
+static int oons_TYR_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue oons_TYR_cfg = {
     7,
  "TYR",
@@ -315,7 +315,7 @@ static struct classifier_residue oons_TYR_cfg = {
  {"TYR", 212.31, 35.20, 177.11, 72.41, 139.90, 0},
 };
 
-static const char *oons_VAL_atom_name[] = {"CG2", "CG1", };
+static const char *oons_VAL_atom_name[] = {"CG1", "CG2", };
 static double oons_VAL_atom_radius[] = {2.00, 2.00, };
 static int oons_VAL_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, };
 static struct classifier_residue oons_VAL_cfg = {
@@ -330,9 +330,191 @@ static struct classifier_residue oons_VAL_cfg = {
 static struct classifier_residue *oons_residue_cfg[] = {
     &oons_ACE_cfg, &oons_ANY_cfg, &oons_ARG_cfg, &oons_ASN_cfg, &oons_ASP_cfg, &oons_ASX_cfg, &oons_CSE_cfg, &oons_CYS_cfg, &oons_GLN_cfg, &oons_GLU_cfg, &oons_GLX_cfg, &oons_HIS_cfg, &oons_HOH_cfg, &oons_ILE_cfg, &oons_LEU_cfg, &oons_LYS_cfg, &oons_MET_cfg, &oons_NH2_cfg, &oons_PHE_cfg, &oons_PRO_cfg, &oons_PYL_cfg, &oons_SEC_cfg, &oons_SER_cfg, &oons_THR_cfg, &oons_TRP_cfg, &oons_TYR_cfg, &oons_VAL_cfg, };
 
+static unsigned int oons_index_seed[] = {0, 13, 1, 15, 4, 1, 6, 12, 4, 7, 6, 4, 3, 4, 10, 17, 8, 6, 3, 6, 2, 136, 2, 2, 33, 7, 76, 51, 29, 1, 41, 3, 15, 14, };
+
+static struct classifier_index_entry oons_index_slot[] = {
+    {0x000031444e534948ULL, 1.55, FREESASA_ATOM_POLAR},
+    {0x0000314543534948ULL, 1.75, FREESASA_ATOM_APOLAR},
+    {0x000000324e594e41ULL, 1.55, FREESASA_ATOM_POLAR},
+    {0x00000042434f5250ULL, 1.75, FREESASA_ATOM_APOLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x0000003743594e41ULL, 1.75, FREESASA_ATOM_APOLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x00000044434f5250ULL, 1.75, FREESASA_ATOM_APOLAR},
+    {0x000000444353594cULL, 2.00, FREESASA_ATOM_APOLAR},
+    {0x000000324f594e41ULL, 1.40, FREESASA_ATOM_POLAR},
+    {0x000032454e4e4c47ULL, 1.55, FREESASA_ATOM_POLAR},
+    {0x0000334543505254ULL, 1.75, FREESASA_ATOM_APOLAR},
+    {0x0000004243594e41ULL, 2.00, FREESASA_ATOM_APOLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x0000273243594e41ULL, 1.75, FREESASA_ATOM_APOLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x0000314441585341ULL, 1.5, FREESASA_ATOM_POLAR},
+    {0x0000324843505254ULL, 1.75, FREESASA_ATOM_APOLAR},
+    {0x000027344f594e41ULL, 1.40, FREESASA_ATOM_POLAR},
+    {0x000000474353594cULL, 2.00, FREESASA_ATOM_APOLAR},
+    {0x0000004743505341ULL, 1.55, FREESASA_ATOM_POLAR},
+    {0x000000474f524553ULL, 1.40, FREESASA_ATOM_POLAR},
+    {0x000031504f594e41ULL, 1.40, FREESASA_ATOM_POLAR},
+    {0x000000454354454dULL, 2.00, FREESASA_ATOM_APOLAR},
+    {0x00003247434c4156ULL, 2.00, FREESASA_ATOM_APOLAR},
+    {0x0000325a43505254ULL, 1.75, FREESASA_ATOM_APOLAR},
+    {0x00003241434c5950ULL, 1.75, FREESASA_ATOM_APOLAR},
+    {0x0000004443554c47ULL, 1.55, FREESASA_ATOM_POLAR},
+    {0x000054584f594e41ULL, 1.40, FREESASA_ATOM_POLAR},
+    {0x0000324541584c47ULL, 1.5, FREESASA_ATOM_POLAR},
+    {0x000000364f594e41ULL, 1.40, FREESASA_ATOM_POLAR},
+    {0x000031444f505341ULL, 1.40, FREESASA_ATOM_POLAR},
+    {0x0000000043594e41ULL, 1.55, FREESASA_ATOM_POLAR},
+    {0x000000374e594e41ULL, 1.55, FREESASA_ATOM_POLAR},
+    {0x0000003543594e41ULL, 1.75, FREESASA_ATOM_APOLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x0000314443454c49ULL, 2.00, FREESASA_ATOM_APOLAR},
+    {0x000032454f554c47ULL, 1.40, FREESASA_ATOM_POLAR},
+    {0x0000324443505254ULL, 1.75, FREESASA_ATOM_APOLAR},
+    {0x0000324543454850ULL, 1.75, FREESASA_ATOM_APOLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x000000484f525954ULL, 1.40, FREESASA_ATOM_POLAR},
+    {0x00000032434c5950ULL, 1.55, FREESASA_ATOM_POLAR},
+    {0x000031444f4e5341ULL, 1.40, FREESASA_ATOM_POLAR},
+    {0x000000454353594cULL, 2.00, FREESASA_ATOM_APOLAR},
+    {0x0000324558584c47ULL, 1.5, FREESASA_ATOM_POLAR},
+    {0x0000004443475241ULL, 2.00, FREESASA_ATOM_APOLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x0000005a43475241ULL, 2.00, FREESASA_ATOM_APOLAR},
+    {0x0000004743554c47ULL, 2.00, FREESASA_ATOM_APOLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x000032444e4e5341ULL, 1.55, FREESASA_ATOM_POLAR},
+    {0x000031454f554c47ULL, 1.40, FREESASA_ATOM_POLAR},
+    {0x0000314558584c47ULL, 1.5, FREESASA_ATOM_POLAR},
+    {0x0000273343594e41ULL, 1.75, FREESASA_ATOM_APOLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x000000004e594e41ULL, 1.55, FREESASA_ATOM_POLAR},
+    {0x000000004f484f48ULL, 1.40, FREESASA_ATOM_POLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x0000334843454341ULL, 2.00, FREESASA_ATOM_APOLAR},
+    {0x0000004553455343ULL, 1.90, FREESASA_ATOM_POLAR},
+    {0x0000005a43454850ULL, 1.75, FREESASA_ATOM_APOLAR},
+    {0x0000324443534948ULL, 1.75, FREESASA_ATOM_APOLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x0000324743524854ULL, 2.00, FREESASA_ATOM_APOLAR},
+    {0x0000324543525954ULL, 1.75, FREESASA_ATOM_APOLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x0000314443505254ULL, 1.75, FREESASA_ATOM_APOLAR},
+    {0x0000004743505254ULL, 1.75, FREESASA_ATOM_APOLAR},
+    {0x00000047434c5950ULL, 2.00, FREESASA_ATOM_APOLAR},
+    {0x00000044434e4c47ULL, 1.55, FREESASA_ATOM_POLAR},
+    {0x00000045434c5950ULL, 2.00, FREESASA_ATOM_APOLAR},
+    {0x000027324f594e41ULL, 1.40, FREESASA_ATOM_POLAR},
+    {0x0000273143594e41ULL, 1.75, FREESASA_ATOM_APOLAR},
+    {0x000032444f505341ULL, 1.40, FREESASA_ATOM_POLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x0000000050594e41ULL, 1.80, FREESASA_ATOM_POLAR},
+    {0x0000004743475241ULL, 2.00, FREESASA_ATOM_APOLAR},
+    {0x0000324458585341ULL, 1.5, FREESASA_ATOM_POLAR},
+    {0x0000324d43594e41ULL, 2.00, FREESASA_ATOM_APOLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x000032454e534948ULL, 1.55, FREESASA_ATOM_POLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x000000474355454cULL, 2.00, FREESASA_ATOM_APOLAR},
+    {0x0000324743454c49ULL, 2.00, FREESASA_ATOM_APOLAR},
+    {0x0000003443594e41ULL, 1.75, FREESASA_ATOM_APOLAR},
+    {0x000000344f594e41ULL, 1.40, FREESASA_ATOM_POLAR},
+    {0x0000324443454850ULL, 1.75, FREESASA_ATOM_APOLAR},
+    {0x0000003243594e41ULL, 1.75, FREESASA_ATOM_APOLAR},
+    {0x000000314e594e41ULL, 1.55, FREESASA_ATOM_POLAR},
+    {0x000032484e475241ULL, 1.55, FREESASA_ATOM_POLAR},
+    {0x0000314458585341ULL, 1.5, FREESASA_ATOM_POLAR},
+    {0x0000004143594e41ULL, 2.00, FREESASA_ATOM_APOLAR},
+    {0x00000047434e4c47ULL, 2.00, FREESASA_ATOM_APOLAR},
+    {0x0000273443594e41ULL, 1.75, FREESASA_ATOM_APOLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x0000004743584c47ULL, 2.00, FREESASA_ATOM_APOLAR},
+    {0x00003244434c5950ULL, 1.75, FREESASA_ATOM_APOLAR},
+    {0x000031484e475241ULL, 1.55, FREESASA_ATOM_POLAR},
+    {0x0000004753535943ULL, 2.00, FREESASA_ATOM_POLAR},
+    {0x0000314743454c49ULL, 2.00, FREESASA_ATOM_APOLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x0000314443454850ULL, 1.75, FREESASA_ATOM_APOLAR},
+    {0x000027334f594e41ULL, 1.40, FREESASA_ATOM_POLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x0000314543454850ULL, 1.75, FREESASA_ATOM_APOLAR},
+    {0x0000003843594e41ULL, 1.75, FREESASA_ATOM_APOLAR},
+    {0x000000344e594e41ULL, 1.55, FREESASA_ATOM_POLAR},
+    {0x000027354f594e41ULL, 1.40, FREESASA_ATOM_POLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x000032484e32484eULL, 1.55, FREESASA_ATOM_POLAR},
+    {0x000000364e594e41ULL, 1.55, FREESASA_ATOM_POLAR},
+    {0x00003245434c5950ULL, 1.75, FREESASA_ATOM_APOLAR},
+    {0x0000324441585341ULL, 1.5, FREESASA_ATOM_POLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x00003147434c4156ULL, 2.00, FREESASA_ATOM_APOLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x000032444355454cULL, 2.00, FREESASA_ATOM_APOLAR},
+    {0x000032504f594e41ULL, 1.40, FREESASA_ATOM_POLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x0000324543505254ULL, 1.75, FREESASA_ATOM_APOLAR},
+    {0x0000004743534948ULL, 1.75, FREESASA_ATOM_APOLAR},
+    {0x0000004743454850ULL, 1.75, FREESASA_ATOM_APOLAR},
+    {0x000031474f524854ULL, 1.40, FREESASA_ATOM_POLAR},
+    {0x00003247434c5950ULL, 1.75, FREESASA_ATOM_APOLAR},
+    {0x000031454e505254ULL, 1.55, FREESASA_ATOM_POLAR},
+    {0x00000047434e5341ULL, 1.55, FREESASA_ATOM_POLAR},
+    {0x000000445354454dULL, 2.00, FREESASA_ATOM_POLAR},
+    {0x000000474354454dULL, 2.00, FREESASA_ATOM_APOLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x00000047434f5250ULL, 1.75, FREESASA_ATOM_APOLAR},
+    {0x000000324e4c5950ULL, 1.55, FREESASA_ATOM_POLAR},
+    {0x0000005a4e53594cULL, 1.55, FREESASA_ATOM_POLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x0000003643594e41ULL, 1.75, FREESASA_ATOM_APOLAR},
+    {0x000000004f594e41ULL, 1.40, FREESASA_ATOM_POLAR},
+    {0x0000273543594e41ULL, 2.00, FREESASA_ATOM_APOLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x000000334e594e41ULL, 1.55, FREESASA_ATOM_POLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x0000005a43525954ULL, 1.75, FREESASA_ATOM_APOLAR},
+    {0x0000314543525954ULL, 1.75, FREESASA_ATOM_APOLAR},
+    {0x0000314541584c47ULL, 1.5, FREESASA_ATOM_POLAR},
+    {0x00000044434c5950ULL, 2.00, FREESASA_ATOM_APOLAR},
+    {0x0000004443584c47ULL, 1.55, FREESASA_ATOM_POLAR},
+    {0x000031444355454cULL, 2.00, FREESASA_ATOM_APOLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x000000394e594e41ULL, 1.55, FREESASA_ATOM_POLAR},
+    {0x000031454f4e4c47ULL, 1.40, FREESASA_ATOM_POLAR},
+    {0x0000005a4e4c5950ULL, 1.55, FREESASA_ATOM_POLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x0000004743585341ULL, 1.55, FREESASA_ATOM_POLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x0000004743525954ULL, 1.75, FREESASA_ATOM_APOLAR},
+    {0x0000324443525954ULL, 1.75, FREESASA_ATOM_APOLAR},
+    {0x000000324f4c5950ULL, 1.40, FREESASA_ATOM_POLAR},
+    {0x000033504f594e41ULL, 1.40, FREESASA_ATOM_POLAR},
+    {0x0000004553434553ULL, 1.90, FREESASA_ATOM_POLAR},
+    {0x00003242434c5950ULL, 2.00, FREESASA_ATOM_APOLAR},
+    {0x000000454e475241ULL, 1.55, FREESASA_ATOM_POLAR},
+    {0x0000335a43505254ULL, 1.75, FREESASA_ATOM_APOLAR},
+    {0x0000314443525954ULL, 1.75, FREESASA_ATOM_APOLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+};
+
+static struct classifier_index oons_index = {
+    34,
+    167,
+    oons_index_seed,
+    oons_index_slot,
+};
+
 const freesasa_classifier freesasa_oons_classifier = {
     27,    (char**) oons_residue_name,
     "OONS",
     (struct classifier_residue **) oons_residue_cfg,
+    &oons_index,
+    NULL,
+    0,
 };
 
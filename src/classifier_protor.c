@@ -3,9 +3,9 @@
 /* Autogenerated code from the script config2c.pl */
 
 static const char *protor_residue_name[] = {"A", "ACE", "ALA", "ARG", "ASN", "ASP", "ASX", "C", "CYS", "DA", "DC", "DG", "DI", "DT", "DU", "G", "GLN", "GLU", "GLX", "GLY", "HIS", "HOH", "I", "ILE", "LEU", "LYS", "MET", "NH2", "PHE", "PRO", "PYL", "SEC", "SER", "T", "THR", "TRP", "TYR", "U", "VAL", };
-static const char *protor_A_atom_name[] = {"N6", "P", "C2", "O5'", "O4'", "O3'", "OP2", "OP1", "N3", "C2'", "C6", "O2'", "N7", "N9", "C3'", "C4", "C4'", "OP3", "C5", "C8", "C5'", "N1", "C1'", };
-static double protor_A_atom_radius[] = {1.64, 1.8, 1.76, 1.46, 1.46, 1.46, 1.46, 1.42, 1.64, 1.88, 1.61, 1.46, 1.64, 1.64, 1.88, 1.61, 1.88, 1.46, 1.61, 1.76, 1.88, 1.64, 1.88, };
-static int protor_A_atom_class[] = {FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, };
+static const char *protor_A_atom_name[] = {"C1'", "C2", "C2'", "C3'", "C4", "C4'", "C5", "C5'", "C6", "C8", "N1", "N3", "N6", "N7", "N9", "O2'", "O3'", "O4'", "O5'", "OP1", "OP2", "OP3", "P", };
+static double protor_A_atom_radius[] = {1.88, 1.76, 1.88, 1.88, 1.61, 1.88, 1.61, 1.88, 1.61, 1.76, 1.64, 1.64, 1.64, 1.64, 1.64, 1.46, 1.46, 1.46, 1.46, 1.42, 1.46, 1.46, 1.8, };
+static int protor_A_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue protor_A_cfg = {
     23,
  "A",
@@ -15,9 +15,9 @@ static struct classifier_residue protor_A_cfg = {
  {NULL, 0, 0, 0, 0, 0},
 };
 
-static const char *protor_ACE_atom_name[] = {"CH3", "O", "C", };
-static double protor_ACE_atom_radius[] = {1.88, 1.42, 1.76, };
-static int protor_ACE_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, };
+static const char *protor_ACE_atom_name[] = {"C", "CH3", "O", };
+static double protor_ACE_atom_radius[] = {1.76, 1.88, 1.42, };
+static int protor_ACE_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue protor_ACE_cfg = {
     3,
  "ACE",
@@ -27,9 +27,9 @@ static struct classifier_residue protor_ACE_cfg = {
  {NULL, 0, 0, 0, 0, 0},
 };
 
-static const char *protor_ALA_atom_name[] = {"OXT", "O", "CB", "N", "CA", "C", };
-static double protor_ALA_atom_radius[] = {1.46, 1.42, 1.88, 1.64, 1.88, 1.61, };
-static int protor_ALA_atom_class[] = {FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, };
+static const char *protor_ALA_atom_name[] = {"C", "CA", "CB", "N", "O", "OXT", };
+static double protor_ALA_atom_radius[] = {1.61, 1.88, 1.88, 1.64, 1.42, 1.46, };
+static int protor_ALA_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue protor_ALA_cfg = {
     6,
  "ALA",
@@ -39,9 +39,9 @@ static struct classifier_residue protor_ALA_cfg = {
  {"ALA", 108.76, 43.96, 64.80, 37.75, 71.01, 0},
 };
 
-static const char *protor_ARG_atom_name[] = {"NH1", "OXT", "CA", "CZ", "CG", "CB", "N", "O", "NH2", "CD", "C", "NE", };
-static double protor_ARG_atom_radius[] = {1.64, 1.46, 1.88, 1.61, 1.88, 1.88, 1.64, 1.42, 1.64, 1.88, 1.61, 1.64, };
-static int protor_ARG_atom_class[] = {FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, };
+static const char *protor_ARG_atom_name[] = {"C", "CA", "CB", "CD", "CG", "CZ", "N", "NE", "NH1", "NH2", "O", "OXT", };
+static double protor_ARG_atom_radius[] = {1.61, 1.88, 1.88, 1.88, 1.88, 1.61, 1.64, 1.64, 1.64, 1.64, 1.42, 1.46, };
+static int protor_ARG_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue protor_ARG_cfg = {
     12,
  "ARG",
@@ -51,9 +51,9 @@ static struct classifier_residue protor_ARG_cfg = {
  {"ARG", 238.17, 42.00, 196.17, 165.00, 73.17, 0},
 };
 
-static const char *protor_ASN_atom_name[] = {"C", "ND2", "O", "OD1", "CG", "CA", "N", "CB", "OXT", };
-static double protor_ASN_atom_radius[] = {1.61, 1.64, 1.42, 1.42, 1.61, 1.88, 1.64, 1.88, 1.46, };
-static int protor_ASN_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, };
+static const char *protor_ASN_atom_name[] = {"C", "CA", "CB", "CG", "N", "ND2", "O", "OD1", "OXT", };
+static double protor_ASN_atom_radius[] = {1.61, 1.88, 1.88, 1.61, 1.64, 1.64, 1.42, 1.42, 1.46, };
+static int protor_ASN_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue protor_ASN_cfg = {
     9,
  "ASN",
@@ -63,9 +63,9 @@ static struct classifier_residue protor_ASN_cfg = {
  {"ASN", 145.01, 41.53, 103.48, 103.46, 41.55, 0},
 };
 
-static const char *protor_ASP_atom_name[] = {"OD2", "CB", "N", "CA", "CG", "OXT", "C", "OD1", "O", };
-static double protor_ASP_atom_radius[] = {1.46, 1.88, 1.64, 1.88, 1.61, 1.46, 1.61, 1.42, 1.42, };
-static int protor_ASP_atom_class[] = {FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
+static const char *protor_ASP_atom_name[] = {"C", "CA", "CB", "CG", "N", "O", "OD1", "OD2", "OXT", };
+static double protor_ASP_atom_radius[] = {1.61, 1.88, 1.88, 1.61, 1.64, 1.42, 1.42, 1.46, 1.46, };
+static int protor_ASP_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue protor_ASP_cfg = {
     9,
  "ASP",
@@ -75,9 +75,9 @@ static struct classifier_residue protor_ASP_cfg = {
  {"ASP", 142.76, 42.29, 100.47, 100.27, 42.49, 0},
 };
 
-static const char *protor_ASX_atom_name[] = {"XD1", "XD2", "O", "C", "OXT", "CB", "N", "CG", "CA", };
-static double protor_ASX_atom_radius[] = {1.5, 1.5, 1.42, 1.61, 1.46, 1.88, 1.64, 1.61, 1.88, };
-static int protor_ASX_atom_class[] = {FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, };
+static const char *protor_ASX_atom_name[] = {"C", "CA", "CB", "CG", "N", "O", "OXT", "XD1", "XD2", };
+static double protor_ASX_atom_radius[] = {1.61, 1.88, 1.88, 1.61, 1.64, 1.42, 1.46, 1.5, 1.5, };
+static int protor_ASX_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue protor_ASX_cfg = {
     9,
  "ASX",
@@ -87,9 +87,9 @@ static struct classifier_residue protor_ASX_cfg = {
  {NULL, 0, 0, 0, 0, 0},
 };
 
-static const char *protor_C_atom_name[] = {"O5'", "O4'", "O3'", "N4", "C2", "P", "C2'", "N3", "C6", "OP1", "OP2", "C4'", "C4", "C3'", "OP3", "O2'", "C5'", "N1", "C1'", "O2", "C5", };
-static double protor_C_atom_radius[] = {1.46, 1.46, 1.46, 1.64, 1.61, 1.8, 1.88, 1.64, 1.76, 1.42, 1.46, 1.88, 1.61, 1.88, 1.46, 1.46, 1.88, 1.64, 1.88, 1.42, 1.76, };
-static int protor_C_atom_class[] = {FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, };
+static const char *protor_C_atom_name[] = {"C1'", "C2", "C2'", "C3'", "C4", "C4'", "C5", "C5'", "C6", "N1", "N3", "N4", "O2", "O2'", "O3'", "O4'", "O5'", "OP1", "OP2", "OP3", "P", };
+static double protor_C_atom_radius[] = {1.88, 1.61, 1.88, 1.88, 1.61, 1.88, 1.76, 1.88, 1.76, 1.64, 1.64, 1.64, 1.42, 1.46, 1.46, 1.46, 1.46, 1.42, 1.46, 1.46, 1.8, };
+static int protor_C_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue protor_C_cfg = {
     21,
  "C",
@@ -99,9 +99,9 @@ static struct classifier_residue protor_C_cfg = {
  {NULL, 0, 0, 0, 0, 0},
 };
 
-static const char *protor_CYS_atom_name[] = {"OXT", "SG", "O", "N", "CB", "CA", "C", };
-static double protor_CYS_atom_radius[] = {1.46, 1.77, 1.42, 1.64, 1.88, 1.88, 1.61, };
-static int protor_CYS_atom_class[] = {FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, };
+static const char *protor_CYS_atom_name[] = {"C", "CA", "CB", "N", "O", "OXT", "SG", };
+static double protor_CYS_atom_radius[] = {1.61, 1.88, 1.88, 1.64, 1.42, 1.46, 1.77, };
+static int protor_CYS_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue protor_CYS_cfg = {
     7,
  "CYS",
@@ -111,9 +111,9 @@ static struct classifier_residue protor_CYS_cfg = {
  {"CYS", 132.20, 42.55, 89.66, 92.74, 39.47, 0},
 };
 
-static const char *protor_DA_atom_name[] = {"C6", "C2'", "N3", "OP1", "OP2", "O4'", "O3'", "O5'", "C2", "N6", "P", "N1", "C1'", "C5'", "C8", "C5", "OP3", "C4'", "C4", "C3'", "N9", "N7", };
-static double protor_DA_atom_radius[] = {1.61, 1.88, 1.64, 1.42, 1.46, 1.46, 1.46, 1.46, 1.76, 1.64, 1.8, 1.64, 1.88, 1.88, 1.76, 1.61, 1.46, 1.88, 1.61, 1.88, 1.64, 1.64, };
-static int protor_DA_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
+static const char *protor_DA_atom_name[] = {"C1'", "C2", "C2'", "C3'", "C4", "C4'", "C5", "C5'", "C6", "C8", "N1", "N3", "N6", "N7", "N9", "O3'", "O4'", "O5'", "OP1", "OP2", "OP3", "P", };
+static double protor_DA_atom_radius[] = {1.88, 1.76, 1.88, 1.88, 1.61, 1.88, 1.61, 1.88, 1.61, 1.76, 1.64, 1.64, 1.64, 1.64, 1.64, 1.46, 1.46, 1.46, 1.42, 1.46, 1.46, 1.8, };
+static int protor_DA_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue protor_DA_cfg = {
     22,
  "DA",
@@ -123,9 +123,9 @@ static struct classifier_residue protor_DA_cfg = {
  {NULL, 0, 0, 0, 0, 0},
 };
 
-static const char *protor_DC_atom_name[] = {"OP2", "OP1", "N3", "C2'", "C6", "N4", "P", "C2", "O5'", "O3'", "O4'", "C5", "O2", "C5'", "N1", "C1'", "C3'", "C4'", "C4", "OP3", };
-static double protor_DC_atom_radius[] = {1.46, 1.42, 1.64, 1.88, 1.76, 1.64, 1.8, 1.61, 1.46, 1.46, 1.46, 1.76, 1.42, 1.88, 1.64, 1.88, 1.88, 1.88, 1.61, 1.46, };
-static int protor_DC_atom_class[] = {FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, };
+static const char *protor_DC_atom_name[] = {"C1'", "C2", "C2'", "C3'", "C4", "C4'", "C5", "C5'", "C6", "N1", "N3", "N4", "O2", "O3'", "O4'", "O5'", "OP1", "OP2", "OP3", "P", };
+static double protor_DC_atom_radius[] = {1.88, 1.61, 1.88, 1.88, 1.61, 1.88, 1.76, 1.88, 1.76, 1.64, 1.64, 1.64, 1.42, 1.46, 1.46, 1.46, 1.42, 1.46, 1.46, 1.8, };
+static int protor_DC_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue protor_DC_cfg = {
     20,
  "DC",
@@ -135,9 +135,9 @@ static struct classifier_residue protor_DC_cfg = {
  {NULL, 0, 0, 0, 0, 0},
 };
 
-static const char *protor_DG_atom_name[] = {"O3'", "O4'", "O5'", "P", "C2", "N2", "C6", "C2'", "N3", "OP2", "OP1", "OP3", "C3'", "C4'", "C4", "N9", "N7", "N1", "C1'", "O6", "C5'", "C5", "C8", };
-static double protor_DG_atom_radius[] = {1.46, 1.46, 1.46, 1.8, 1.61, 1.64, 1.61, 1.88, 1.64, 1.46, 1.42, 1.46, 1.88, 1.88, 1.61, 1.64, 1.64, 1.64, 1.88, 1.42, 1.88, 1.61, 1.76, };
-static int protor_DG_atom_class[] = {FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, };
+static const char *protor_DG_atom_name[] = {"C1'", "C2", "C2'", "C3'", "C4", "C4'", "C5", "C5'", "C6", "C8", "N1", "N2", "N3", "N7", "N9", "O3'", "O4'", "O5'", "O6", "OP1", "OP2", "OP3", "P", };
+static double protor_DG_atom_radius[] = {1.88, 1.61, 1.88, 1.88, 1.61, 1.88, 1.61, 1.88, 1.61, 1.76, 1.64, 1.64, 1.64, 1.64, 1.64, 1.46, 1.46, 1.46, 1.42, 1.42, 1.46, 1.46, 1.8, };
+static int protor_DG_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue protor_DG_cfg = {
     23,
  "DG",
@@ -147,9 +147,9 @@ static struct classifier_residue protor_DG_cfg = {
  {NULL, 0, 0, 0, 0, 0},
 };
 
-static const char *protor_DI_atom_name[] = {"OP2", "OP1", "C6", "C2'", "N3", "P", "C2", "O4'", "O3'", "O5'", "C5", "C8", "C1'", "N1", "O6", "C5'", "N9", "N7", "OP3", "C3'", "C4'", "C4", };
-static double protor_DI_atom_radius[] = {1.46, 1.42, 1.61, 1.88, 1.64, 1.8, 1.76, 1.46, 1.46, 1.46, 1.61, 1.76, 1.88, 1.64, 1.42, 1.88, 1.64, 1.64, 1.46, 1.88, 1.88, 1.61, };
-static int protor_DI_atom_class[] = {FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, };
+static const char *protor_DI_atom_name[] = {"C1'", "C2", "C2'", "C3'", "C4", "C4'", "C5", "C5'", "C6", "C8", "N1", "N3", "N7", "N9", "O3'", "O4'", "O5'", "O6", "OP1", "OP2", "OP3", "P", };
+static double protor_DI_atom_radius[] = {1.88, 1.76, 1.88, 1.88, 1.61, 1.88, 1.61, 1.88, 1.61, 1.76, 1.64, 1.64, 1.64, 1.64, 1.46, 1.46, 1.46, 1.42, 1.42, 1.46, 1.46, 1.8, };
+static int protor_DI_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue protor_DI_cfg = {
     22,
  "DI",
@@ -159,9 +159,9 @@ static struct classifier_residue protor_DI_cfg = {
  {NULL, 0, 0, 0, 0, 0},
 };
 
-static const char *protor_DT_atom_name[] = {"OP3", "C3'", "C4'", "C4", "C5", "O2", "N1", "C1'", "C5'", "P", "C2", "O4", "O4'", "C7", "O3'", "O5'", "OP2", "OP1", "C6", "C2'", "N3", };
-static double protor_DT_atom_radius[] = {1.46, 1.88, 1.88, 1.61, 1.61, 1.42, 1.64, 1.88, 1.88, 1.8, 1.61, 1.42, 1.46, 1.88, 1.46, 1.46, 1.46, 1.42, 1.76, 1.88, 1.64, };
-static int protor_DT_atom_class[] = {FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, };
+static const char *protor_DT_atom_name[] = {"C1'", "C2", "C2'", "C3'", "C4", "C4'", "C5", "C5'", "C6", "C7", "N1", "N3", "O2", "O3'", "O4", "O4'", "O5'", "OP1", "OP2", "OP3", "P", };
+static double protor_DT_atom_radius[] = {1.88, 1.61, 1.88, 1.88, 1.61, 1.88, 1.61, 1.88, 1.76, 1.88, 1.64, 1.64, 1.42, 1.46, 1.42, 1.46, 1.46, 1.42, 1.46, 1.46, 1.8, };
+static int protor_DT_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue protor_DT_cfg = {
     21,
  "DT",
@@ -171,9 +171,9 @@ static struct classifier_residue protor_DT_cfg = {
  {NULL, 0, 0, 0, 0, 0},
 };
 
-static const char *protor_DU_atom_name[] = {"C3'", "C4", "C4'", "OP3", "O2", "C5", "C5'", "C1'", "N1", "P", "O4", "C2", "O5'", "O3'", "O4'", "OP2", "OP1", "C2'", "N3", "C6", };
-static double protor_DU_atom_radius[] = {1.88, 1.61, 1.88, 1.46, 1.42, 1.76, 1.88, 1.88, 1.64, 1.8, 1.42, 1.61, 1.46, 1.46, 1.46, 1.46, 1.42, 1.88, 1.64, 1.76, };
-static int protor_DU_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, };
+static const char *protor_DU_atom_name[] = {"C1'", "C2", "C2'", "C3'", "C4", "C4'", "C5", "C5'", "C6", "N1", "N3", "O2", "O3'", "O4", "O4'", "O5'", "OP1", "OP2", "OP3", "P", };
+static double protor_DU_atom_radius[] = {1.88, 1.61, 1.88, 1.88, 1.61, 1.88, 1.76, 1.88, 1.76, 1.64, 1.64, 1.42, 1.46, 1.42, 1.46, 1.46, 1.42, 1.46, 1.46, 1.8, };
+static int protor_DU_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue protor_DU_cfg = {
     20,
  "DU",
@@ -183,9 +183,9 @@ static struct classifier_residue protor_DU_cfg = {
  {NULL, 0, 0, 0, 0, 0},
 };
 
-static const char *protor_G_atom_name[] = {"C8", "C5", "C1'", "N1", "C5'", "O6", "N9", "N7", "O2'", "OP3", "C4", "C4'", "C3'", "OP1", "OP2", "C6", "N3", "C2'", "C2", "N2", "P", "O3'", "O4'", "O5'", };
-static double protor_G_atom_radius[] = {1.76, 1.61, 1.88, 1.64, 1.88, 1.42, 1.64, 1.64, 1.46, 1.46, 1.61, 1.88, 1.88, 1.42, 1.46, 1.61, 1.64, 1.88, 1.61, 1.64, 1.8, 1.46, 1.46, 1.46, };
-static int protor_G_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
+static const char *protor_G_atom_name[] = {"C1'", "C2", "C2'", "C3'", "C4", "C4'", "C5", "C5'", "C6", "C8", "N1", "N2", "N3", "N7", "N9", "O2'", "O3'", "O4'", "O5'", "O6", "OP1", "OP2", "OP3", "P", };
+static double protor_G_atom_radius[] = {1.88, 1.61, 1.88, 1.88, 1.61, 1.88, 1.61, 1.88, 1.61, 1.76, 1.64, 1.64, 1.64, 1.64, 1.64, 1.46, 1.46, 1.46, 1.46, 1.42, 1.42, 1.46, 1.46, 1.8, };
+static int protor_G_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue protor_G_cfg = {
     24,
  "G",
@@ -195,9 +195,9 @@ static struct classifier_residue protor_G_cfg = {
  {NULL, 0, 0, 0, 0, 0},
 };
 
-static const char *protor_GLN_atom_name[] = {"C", "CD", "O", "CB", "N", "NE2", "CG", "CA", "OXT", "OE1", };
-static double protor_GLN_atom_radius[] = {1.61, 1.61, 1.42, 1.88, 1.64, 1.64, 1.88, 1.88, 1.46, 1.42, };
-static int protor_GLN_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
+static const char *protor_GLN_atom_name[] = {"C", "CA", "CB", "CD", "CG", "N", "NE2", "O", "OE1", "OXT", };
+static double protor_GLN_atom_radius[] = {1.61, 1.88, 1.88, 1.61, 1.88, 1.64, 1.64, 1.42, 1.42, 1.46, };
+static int protor_GLN_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue protor_GLN_cfg = {
     10,
  "GLN",
@@ -207,9 +207,9 @@ static struct classifier_residue protor_GLN_cfg = {
  {"GLN", 178.83, 42.00, 136.83, 131.85, 46.98, 0},
 };
 
-static const char *protor_GLU_atom_name[] = {"CG", "CA", "CB", "N", "OE2", "OXT", "OE1", "CD", "C", "O", };
-static double protor_GLU_atom_radius[] = {1.88, 1.88, 1.88, 1.64, 1.46, 1.46, 1.42, 1.61, 1.61, 1.42, };
-static int protor_GLU_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, };
+static const char *protor_GLU_atom_name[] = {"C", "CA", "CB", "CD", "CG", "N", "O", "OE1", "OE2", "OXT", };
+static double protor_GLU_atom_radius[] = {1.61, 1.88, 1.88, 1.61, 1.88, 1.64, 1.42, 1.42, 1.46, 1.46, };
+static int protor_GLU_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue protor_GLU_cfg = {
     10,
  "GLU",
@@ -219,9 +219,9 @@ static struct classifier_residue protor_GLU_cfg = {
  {"GLU", 174.18, 42.00, 132.18, 122.48, 51.70, 0},
 };
 
-static const char *protor_GLX_atom_name[] = {"CG", "CA", "CB", "N", "OXT", "CD", "C", "O", "XE2", "XE1", };
-static double protor_GLX_atom_radius[] = {1.88, 1.88, 1.88, 1.64, 1.46, 1.61, 1.61, 1.42, 1.5, 1.5, };
-static int protor_GLX_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
+static const char *protor_GLX_atom_name[] = {"C", "CA", "CB", "CD", "CG", "N", "O", "OXT", "XE1", "XE2", };
+static double protor_GLX_atom_radius[] = {1.61, 1.88, 1.88, 1.61, 1.88, 1.64, 1.42, 1.46, 1.5, 1.5, };
+static int protor_GLX_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue protor_GLX_cfg = {
     10,
  "GLX",
@@ -231,9 +231,9 @@ static struct classifier_residue protor_GLX_cfg = {
  {NULL, 0, 0, 0, 0, 0},
 };
 
-static const char *protor_GLY_atom_name[] = {"OXT", "O", "N", "C", "CA", };
-static double protor_GLY_atom_radius[] = {1.46, 1.42, 1.64, 1.61, 1.88, };
-static int protor_GLY_atom_class[] = {FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, };
+static const char *protor_GLY_atom_name[] = {"C", "CA", "N", "O", "OXT", };
+static double protor_GLY_atom_radius[] = {1.61, 1.88, 1.64, 1.42, 1.46, };
+static int protor_GLY_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue protor_GLY_cfg = {
     5,
  "GLY",
@@ -243,9 +243,9 @@ static struct classifier_residue protor_GLY_cfg = {
  {"GLY", 81.09, 81.09, 0.00, 44.65, 36.44, 0},
 };
 
-static const char *protor_HIS_atom_name[] = {"OXT", "CA", "CG", "NE2", "CB", "N", "O", "ND1", "CD2", "CE1", "C", };
-static double protor_HIS_atom_radius[] = {1.46, 1.88, 1.61, 1.64, 1.88, 1.64, 1.42, 1.64, 1.76, 1.76, 1.61, };
-static int protor_HIS_atom_class[] = {FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, };
+static const char *protor_HIS_atom_name[] = {"C", "CA", "CB", "CD2", "CE1", "CG", "N", "ND1", "NE2", "O", "OXT", };
+static double protor_HIS_atom_radius[] = {1.61, 1.88, 1.88, 1.76, 1.76, 1.61, 1.64, 1.64, 1.64, 1.42, 1.46, };
+static int protor_HIS_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue protor_HIS_cfg = {
     11,
  "HIS",
@@ -267,9 +267,9 @@ static struct classifier_residue protor_HOH_cfg = {
  {NULL, 0, 0, 0, 0, 0},
 };
 
-static const char *protor_I_atom_name[] = {"C6", "N3", "C2'", "OP1", "OP2", "O4'", "O3'", "O5'", "C2", "P", "N1", "C1'", "C5'", "O6", "C8", "C5", "OP3", "C4", "C4'", "C3'", "N9", "N7", "O2'", };
-static double protor_I_atom_radius[] = {1.61, 1.64, 1.88, 1.42, 1.46, 1.46, 1.46, 1.46, 1.76, 1.8, 1.64, 1.88, 1.88, 1.42, 1.76, 1.61, 1.46, 1.61, 1.88, 1.88, 1.64, 1.64, 1.46, };
-static int protor_I_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
+static const char *protor_I_atom_name[] = {"C1'", "C2", "C2'", "C3'", "C4", "C4'", "C5", "C5'", "C6", "C8", "N1", "N3", "N7", "N9", "O2'", "O3'", "O4'", "O5'", "O6", "OP1", "OP2", "OP3", "P", };
+static double protor_I_atom_radius[] = {1.88, 1.76, 1.88, 1.88, 1.61, 1.88, 1.61, 1.88, 1.61, 1.76, 1.64, 1.64, 1.64, 1.64, 1.46, 1.46, 1.46, 1.46, 1.42, 1.42, 1.46, 1.46, 1.8, };
+static int protor_I_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue protor_I_cfg = {
     23,
  "I",
@@ -279,9 +279,9 @@ static struct classifier_residue protor_I_cfg = {
  {NULL, 0, 0, 0, 0, 0},
 };
 
-static const char *protor_ILE_atom_name[] = {"O", "CD1", "C", "OXT", "CG2", "CB", "N", "CG1", "CA", };
-static double protor_ILE_atom_radius[] = {1.42, 1.88, 1.61, 1.46, 1.88, 1.88, 1.64, 1.88, 1.88, };
-static int protor_ILE_atom_class[] = {FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, };
+static const char *protor_ILE_atom_name[] = {"C", "CA", "CB", "CD1", "CG1", "CG2", "N", "O", "OXT", };
+static double protor_ILE_atom_radius[] = {1.61, 1.88, 1.88, 1.88, 1.88, 1.88, 1.64, 1.42, 1.46, };
+static int protor_ILE_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue protor_ILE_cfg = {
     9,
  "ILE",
@@ -291,9 +291,9 @@ static struct classifier_residue protor_ILE_cfg = {
  {"ILE", 175.73, 41.49, 134.23, 36.85, 138.87, 0},
 };
 
-static const char *protor_LEU_atom_name[] = {"CA", "CG", "CB", "N", "OXT", "C", "CD1", "O", "CD2", };
-static double protor_LEU_atom_radius[] = {1.88, 1.88, 1.88, 1.64, 1.46, 1.61, 1.88, 1.42, 1.88, };
-static int protor_LEU_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, };
+static const char *protor_LEU_atom_name[] = {"C", "CA", "CB", "CD1", "CD2", "CG", "N", "O", "OXT", };
+static double protor_LEU_atom_radius[] = {1.61, 1.88, 1.88, 1.88, 1.88, 1.88, 1.64, 1.42, 1.46, };
+static int protor_LEU_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue protor_LEU_cfg = {
     9,
  "LEU",
@@ -303,9 +303,9 @@ static struct classifier_residue protor_LEU_cfg = {
  {"LEU", 179.56, 39.78, 139.78, 37.16, 142.39, 0},
 };
 
-static const char *protor_LYS_atom_name[] = {"C", "CD", "CE", "O", "NZ", "N", "CB", "CG", "CA", "OXT", };
-static double protor_LYS_atom_radius[] = {1.61, 1.88, 1.88, 1.42, 1.64, 1.64, 1.88, 1.88, 1.88, 1.46, };
-static int protor_LYS_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, };
+static const char *protor_LYS_atom_name[] = {"C", "CA", "CB", "CD", "CE", "CG", "N", "NZ", "O", "OXT", };
+static double protor_LYS_atom_radius[] = {1.61, 1.88, 1.88, 1.88, 1.88, 1.88, 1.64, 1.64, 1.42, 1.46, };
+static int protor_LYS_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue protor_LYS_cfg = {
     10,
  "LYS",
@@ -315,9 +315,9 @@ static struct classifier_residue protor_LYS_cfg = {
  {"LYS", 204.98, 42.00, 162.98, 93.88, 111.10, 0},
 };
 
-static const char *protor_MET_atom_name[] = {"OXT", "CG", "CA", "N", "CB", "CE", "O", "SD", "C", };
-static double protor_MET_atom_radius[] = {1.46, 1.88, 1.88, 1.64, 1.88, 1.88, 1.42, 1.77, 1.61, };
-static int protor_MET_atom_class[] = {FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, };
+static const char *protor_MET_atom_name[] = {"C", "CA", "CB", "CE", "CG", "N", "O", "OXT", "SD", };
+static double protor_MET_atom_radius[] = {1.61, 1.88, 1.88, 1.88, 1.88, 1.64, 1.42, 1.46, 1.77, };
+static int protor_MET_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue protor_MET_cfg = {
     9,
  "MET",
@@ -339,9 +339,9 @@ static struct classifier_residue protor_NH2_cfg = {
  {NULL, 0, 0, 0, 0, 0},
 };
 
-static const char *protor_PHE_atom_name[] = {"CD2", "CE1", "O", "CD1", "C", "CE2", "OXT", "CB", "N", "CA", "CZ", "CG", };
-static double protor_PHE_atom_radius[] = {1.76, 1.76, 1.42, 1.76, 1.61, 1.76, 1.46, 1.88, 1.64, 1.88, 1.76, 1.61, };
-static int protor_PHE_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, };
+static const char *protor_PHE_atom_name[] = {"C", "CA", "CB", "CD1", "CD2", "CE1", "CE2", "CG", "CZ", "N", "O", "OXT", };
+static double protor_PHE_atom_radius[] = {1.61, 1.88, 1.88, 1.76, 1.76, 1.76, 1.76, 1.61, 1.76, 1.64, 1.42, 1.46, };
+static int protor_PHE_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue protor_PHE_cfg = {
     12,
  "PHE",
@@ -351,9 +351,9 @@ static struct classifier_residue protor_PHE_cfg = {
  {"PHE", 199.88, 38.43, 161.45, 34.94, 164.94, 0},
 };
 
-static const char *protor_PRO_atom_name[] = {"N", "CB", "CG", "CA", "OXT", "C", "CD", "O", };
-static double protor_PRO_atom_radius[] = {1.64, 1.88, 1.88, 1.88, 1.46, 1.61, 1.88, 1.42, };
-static int protor_PRO_atom_class[] = {FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, };
+static const char *protor_PRO_atom_name[] = {"C", "CA", "CB", "CD", "CG", "N", "O", "OXT", };
+static double protor_PRO_atom_radius[] = {1.61, 1.88, 1.88, 1.88, 1.88, 1.64, 1.42, 1.46, };
+static int protor_PRO_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue protor_PRO_cfg = {
     8,
  "PRO",
@@ -363,9 +363,9 @@ static struct classifier_residue protor_PRO_cfg = {
  {"PRO", 137.21, 27.51, 109.70, 16.09, 121.12, 0},
 };
 
-static const char *protor_PYL_atom_name[] = {"OXT", "CA", "CD2", "O", "NZ", "N2", "C2", "CA2", "CD", "C", "O2", "N", "CB", "CG2", "CG", "CE", "CE2", "CB2", };
-static double protor_PYL_atom_radius[] = {1.46, 1.88, 1.88, 1.42, 1.64, 1.64, 1.61, 1.88, 1.88, 1.61, 1.42, 1.64, 1.88, 1.88, 1.88, 1.88, 1.76, 1.88, };
-static int protor_PYL_atom_class[] = {FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, };
+static const char *protor_PYL_atom_name[] = {"C", "C2", "CA", "CA2", "CB", "CB2", "CD", "CD2", "CE", "CE2", "CG", "CG2", "N", "N2", "NZ", "O", "O2", "OXT", };
+static double protor_PYL_atom_radius[] = {1.61, 1.61, 1.88, 1.88, 1.88, 1.88, 1.88, 1.88, 1.88, 1.76, 1.88, 1.88, 1.64, 1.64, 1.64, 1.42, 1.42, 1.46, };
+static int protor_PYL_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue protor_PYL_cfg = {
     18,
  "PYL",
@@ -375,9 +375,9 @@ static struct classifier_residue protor_PYL_cfg = {
  {NULL, 0, 0, 0, 0, 0},
 };
 
-static const char *protor_SEC_atom_name[] = {"O", "OXT", "C", "CA", "SE", "N", "CB", };
-static double protor_SEC_atom_radius[] = {1.42, 1.46, 1.61, 1.88, 1.9, 1.64, 1.88, };
-static int protor_SEC_atom_class[] = {FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, };
+static const char *protor_SEC_atom_name[] = {"C", "CA", "CB", "N", "O", "OXT", "SE", };
+static double protor_SEC_atom_radius[] = {1.61, 1.88, 1.88, 1.64, 1.42, 1.46, 1.9, };
+static int protor_SEC_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue protor_SEC_cfg = {
     7,
  "SEC",
@@ -387,9 +387,9 @@ static struct classifier_residue protor_SEC_cfg = {
  {NULL, 0, 0, 0, 0, 0},
 };
 
-static const char *protor_SER_atom_name[] = {"O", "OXT", "OG", "CA", "C", "CB", "N", };
-static double protor_SER_atom_radius[] = {1.42, 1.46, 1.46, 1.88, 1.61, 1.88, 1.64, };
-static int protor_SER_atom_class[] = {FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, };
+static const char *protor_SER_atom_name[] = {"C", "CA", "CB", "N", "O", "OG", "OXT", };
+static double protor_SER_atom_radius[] = {1.61, 1.88, 1.88, 1.64, 1.42, 1.46, 1.46, };
+static int protor_SER_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue protor_SER_cfg = {
     7,
  "SER",
@@ -399,9 +399,9 @@ static struct classifier_residue protor_SER_cfg = {
  {"SER", 118.34, 43.41, 74.93, 71.38, 46.96, 0},
 };
 
-static const char *protor_T_atom_name[] = {"C6", "C2'", "N3", "OP1", "OP2", "C7", "O4'", "O3'", "O5'", "O4", "C2", "P", "C1'", "N1", "C5'", "O2", "C5", "OP3", "C4'", "C4", "C3'", };
-static double protor_T_atom_radius[] = {1.76, 1.88, 1.64, 1.42, 1.46, 1.88, 1.46, 1.46, 1.46, 1.42, 1.61, 1.8, 1.88, 1.64, 1.88, 1.42, 1.61, 1.46, 1.88, 1.61, 1.88, };
-static int protor_T_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, };
+static const char *protor_T_atom_name[] = {"C1'", "C2", "C2'", "C3'", "C4", "C4'", "C5", "C5'", "C6", "C7", "N1", "N3", "O2", "O3'", "O4", "O4'", "O5'", "OP1", "OP2", "OP3", "P", };
+static double protor_T_atom_radius[] = {1.88, 1.61, 1.88, 1.88, 1.61, 1.88, 1.61, 1.88, 1.76, 1.88, 1.64, 1.64, 1.42, 1.46, 1.42, 1.46, 1.46, 1.42, 1.46, 1.46, 1.8, };
+static int protor_T_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue protor_T_cfg = {
     21,
  "T",
@@ -411,9 +411,9 @@ static struct classifier_residue protor_T_cfg = {
  {NULL, 0, 0, 0, 0, 0},
 };
 
-static const char *protor_THR_atom_name[] = {"O", "OG1", "C", "OXT", "N", "CB", "CG2", "CA", };
-static double protor_THR_atom_radius[] = {1.42, 1.46, 1.61, 1.46, 1.64, 1.88, 1.88, 1.88, };
-static int protor_THR_atom_class[] = {FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, };
+static const char *protor_THR_atom_name[] = {"C", "CA", "CB", "CG2", "N", "O", "OG1", "OXT", };
+static double protor_THR_atom_radius[] = {1.61, 1.88, 1.88, 1.88, 1.64, 1.42, 1.46, 1.46, };
+static int protor_THR_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue protor_THR_cfg = {
     8,
  "THR",
@@ -423,9 +423,9 @@ static struct classifier_residue protor_THR_cfg = {
  {"THR", 140.60, 41.96, 98.64, 66.15, 74.45, 0},
 };
 
-static const char *protor_TRP_atom_name[] = {"NE1", "CG", "CA", "CB", "CE3", "N", "CZ2", "OXT", "CE2", "C", "CD1", "O", "CZ3", "CD2", "CH2", };
-static double protor_TRP_atom_radius[] = {1.64, 1.61, 1.88, 1.88, 1.76, 1.64, 1.76, 1.46, 1.61, 1.61, 1.76, 1.42, 1.76, 1.61, 1.76, };
-static int protor_TRP_atom_class[] = {FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, };
+static const char *protor_TRP_atom_name[] = {"C", "CA", "CB", "CD1", "CD2", "CE2", "CE3", "CG", "CH2", "CZ2", "CZ3", "N", "NE1", "O", "OXT", };
+static double protor_TRP_atom_radius[] = {1.61, 1.88, 1.88, 1.76, 1.61, 1.61, 1.76, 1.61, 1.76, 1.76, 1.76, 1.64, 1.64, 1.42, 1.46, };
+static int protor_TRP_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue protor_TRP_cfg = {
     15,
  "TRP",
@@ -435,9 +435,9 @@ static struct classifier_residue protor_TRP_cfg = {
  {"TRP", 249.19, 42.59, 206.60, 61.64, 187.55, 0},
 };
 
-static const char *protor_TYR_atom_name[] = {"OXT", "N", "CB", "OH", "CG", "CZ", "CA", "CE1", "CD2", "O", "CD1", "CE2", "C", };
-static double protor_TYR_atom_radius[] = {1.46, 1.64, 1.88, 1.46, 1.61, 1.61, 1.88, 1.76, 1.76, 1.42, 1.76, 1.76, 1.61, };
-static int protor_TYR_atom_class[] = {FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, };
+static const char *protor_TYR_atom_name[] = {"C", "CA", "CB", "CD1", "CD2", "CE1", "CE2", "CG", "CZ", "N", "O", "OH", "OXT", };
+static double protor_TYR_atom_radius[] = {1.61, 1.88, 1.88, 1.76, 1.76, 1.76, 1.76, 1.61, 1.61, 1.64, 1.42, 1.46, 1.46, };
+static int protor_TYR_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue protor_TYR_cfg = {
     13,
  "TYR",
@@ -447,9 +447,9 @@ static struct classifier_residue protor_TYR_cfg = {
  {"TYR", 214.19, 38.43, 175.76, 81.12, 133.07, 0},
 };
 
-static const char *protor_U_atom_name[] = {"OP3", "C4'", "C4", "C3'", "O2'", "C1'", "N1", "C5'", "C5", "O2", "O3'", "O4'", "O5'", "C2", "O4", "P", "C6", "C2'", "N3", "OP1", "OP2", };
-static double protor_U_atom_radius[] = {1.46, 1.88, 1.61, 1.88, 1.46, 1.88, 1.64, 1.88, 1.76, 1.42, 1.46, 1.46, 1.46, 1.61, 1.42, 1.8, 1.76, 1.88, 1.64, 1.42, 1.46, };
-static int protor_U_atom_class[] = {FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
+static const char *protor_U_atom_name[] = {"C1'", "C2", "C2'", "C3'", "C4", "C4'", "C5", "C5'", "C6", "N1", "N3", "O2", "O2'", "O3'", "O4", "O4'", "O5'", "OP1", "OP2", "OP3", "P", };
+static double protor_U_atom_radius[] = {1.88, 1.61, 1.88, 1.88, 1.61, 1.88, 1.76, 1.88, 1.76, 1.64, 1.64, 1.42, 1.46, 1.46, 1.42, 1.46, 1.46, 1.42, 1.46, 1.46, 1.8, };
+static int protor_U_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue protor_U_cfg = {
     21,
  "U",
@@ -459,9 +459,9 @@ static struct classifier_residue protor_U_cfg = {
  {NULL, 0, 0, 0, 0, 0},
 };
 
-static const char *protor_VAL_atom_name[] = {"OXT", "CG2", "N", "CB", "CA", "CG1", "O", "C", };
-static double protor_VAL_atom_radius[] = {1.46, 1.88, 1.64, 1.88, 1.88, 1.88, 1.42, 1.61, };
-static int protor_VAL_atom_class[] = {FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_APOLAR, };
+static const char *protor_VAL_atom_name[] = {"C", "CA", "CB", "CG1", "CG2", "N", "O", "OXT", };
+static double protor_VAL_atom_radius[] = {1.61, 1.88, 1.88, 1.88, 1.88, 1.64, 1.42, 1.46, };
+static int protor_VAL_atom_class[] = {FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_APOLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, FREESASA_ATOM_POLAR, };
 static struct classifier_residue protor_VAL_cfg = {
     8,
  "VAL",
@@ -474,9 +474,646 @@ static struct classifier_residue protor_VAL_cfg = {
 static struct classifier_residue *protor_residue_cfg[] = {
     &protor_A_cfg, &protor_ACE_cfg, &protor_ALA_cfg, &protor_ARG_cfg, &protor_ASN_cfg, &protor_ASP_cfg, &protor_ASX_cfg, &protor_C_cfg, &protor_CYS_cfg, &protor_DA_cfg, &protor_DC_cfg, &protor_DG_cfg, &protor_DI_cfg, &protor_DT_cfg, &protor_DU_cfg, &protor_G_cfg, &protor_GLN_cfg, &protor_GLU_cfg, &protor_GLX_cfg, &protor_GLY_cfg, &protor_HIS_cfg, &protor_HOH_cfg, &protor_I_cfg, &protor_ILE_cfg, &protor_LEU_cfg, &protor_LYS_cfg, &protor_MET_cfg, &protor_NH2_cfg, &protor_PHE_cfg, &protor_PRO_cfg, &protor_PYL_cfg, &protor_SEC_cfg, &protor_SER_cfg, &protor_T_cfg, &protor_THR_cfg, &protor_TRP_cfg, &protor_TYR_cfg, &protor_U_cfg, &protor_VAL_cfg, };
 
+static unsigned int protor_index_seed[] = {16, 1, 0, 77, 1, 14, 20, 7, 3, 2, 6, 1, 12, 26, 12, 4, 1, 8, 9, 106, 21, 3, 3, 1, 14, 1, 1, 2, 2, 11, 28, 15, 14, 5, 2, 15, 3, 20, 10, 10, 2, 2, 19, 2, 11, 4, 3, 41, 6, 28, 60, 8, 2, 19, 11, 5, 12, 1, 22, 5, 1, 8, 34, 1, 6, 12, 14, 11, 21, 2, 5, 7, 39, 3, 12, 9, 3, 1, 1, 18, 5, 2, 2, 1, 32, 6, 1, 10, 13, 22, 2, 3, 17, 1, 1, 11, 21, 3, 21, 47, 22, 9, 20, 2, 18, 39, 4, 16, 16, 12, 1, 13, 38, 19, 90, 36, 45, 3, 6, 50, 36, 38, 3, 1, 10, };
+
+static struct classifier_index_entry protor_index_slot[] = {
+    {0x0000324543525954ULL, 1.76, FREESASA_ATOM_APOLAR},
+    {0x0000000043434553ULL, 1.61, FREESASA_ATOM_APOLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x00000000434e5341ULL, 1.61, FREESASA_ATOM_APOLAR},
+    {0x000027344f004344ULL, 1.46, FREESASA_ATOM_POLAR},
+    {0x0000004243414c41ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0x000054584f4f5250ULL, 1.46, FREESASA_ATOM_POLAR},
+    {0x00003247434c4156ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0x0000273543000055ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0x0000000050005544ULL, 1.8, FREESASA_ATOM_POLAR},
+    {0x000027324f000055ULL, 1.46, FREESASA_ATOM_POLAR},
+    {0x0000004143554c47ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0x0000000050004944ULL, 1.8, FREESASA_ATOM_POLAR},
+    {0x000000394e000049ULL, 1.64, FREESASA_ATOM_POLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x0000314458585341ULL, 1.5, FREESASA_ATOM_POLAR},
+    {0x000027344f004744ULL, 1.46, FREESASA_ATOM_POLAR},
+    {0x00003245434c5950ULL, 1.76, FREESASA_ATOM_APOLAR},
+    {0x0000004753535943ULL, 1.77, FREESASA_ATOM_POLAR},
+    {0x0000003243000049ULL, 1.76, FREESASA_ATOM_APOLAR},
+    {0x000032504f004344ULL, 1.46, FREESASA_ATOM_POLAR},
+    {0x000000364f000049ULL, 1.42, FREESASA_ATOM_POLAR},
+    {0x000000314e004144ULL, 1.64, FREESASA_ATOM_POLAR},
+    {0x000027334f005444ULL, 1.46, FREESASA_ATOM_POLAR},
+    {0x0000003443005444ULL, 1.61, FREESASA_ATOM_APOLAR},
+    {0x0000273543004144ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0x000000374e000047ULL, 1.64, FREESASA_ATOM_POLAR},
+    {0x000027344f000049ULL, 1.46, FREESASA_ATOM_POLAR},
+    {0x0000003643004144ULL, 1.61, FREESASA_ATOM_APOLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x0000004743525954ULL, 1.61, FREESASA_ATOM_APOLAR},
+    {0x0000314543534948ULL, 1.76, FREESASA_ATOM_APOLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x000031504f000054ULL, 1.42, FREESASA_ATOM_POLAR},
+    {0x000000454354454dULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x000000004e4e5341ULL, 1.64, FREESASA_ATOM_POLAR},
+    {0x00000042434e5341ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0x000000004f505341ULL, 1.42, FREESASA_ATOM_POLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x00000042434e4c47ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0x0000273443000054ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0x000000004e505341ULL, 1.64, FREESASA_ATOM_POLAR},
+    {0x000054584f524854ULL, 1.46, FREESASA_ATOM_POLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x0000004143505341ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x0000003443000041ULL, 1.61, FREESASA_ATOM_APOLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x000000394e000041ULL, 1.64, FREESASA_ATOM_POLAR},
+    {0x000000004e594c47ULL, 1.64, FREESASA_ATOM_POLAR},
+    {0x000000004f505254ULL, 1.42, FREESASA_ATOM_POLAR},
+    {0x000000004354454dULL, 1.61, FREESASA_ATOM_APOLAR},
+    {0x000000324f004344ULL, 1.42, FREESASA_ATOM_POLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x0000324458585341ULL, 1.5, FREESASA_ATOM_POLAR},
+    {0x0000273543000047ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x0000004243505254ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x000031454f554c47ULL, 1.42, FREESASA_ATOM_POLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x000054584f534948ULL, 1.46, FREESASA_ATOM_POLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x000031474f524854ULL, 1.46, FREESASA_ATOM_POLAR},
+    {0x0000004143505254ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0x0000000043524854ULL, 1.61, FREESASA_ATOM_APOLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x0000004143524553ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x000000454353594cULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0x000000314e000041ULL, 1.64, FREESASA_ATOM_POLAR},
+    {0x0000273543000041ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0x0000003843004744ULL, 1.76, FREESASA_ATOM_APOLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x000032504f004744ULL, 1.46, FREESASA_ATOM_POLAR},
+    {0x000000004f524854ULL, 1.42, FREESASA_ATOM_POLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x0000324543454850ULL, 1.76, FREESASA_ATOM_APOLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x000000394e004744ULL, 1.64, FREESASA_ATOM_POLAR},
+    {0x000000324f000055ULL, 1.42, FREESASA_ATOM_POLAR},
+    {0x000027334f000043ULL, 1.46, FREESASA_ATOM_POLAR},
+    {0x000032444e4e5341ULL, 1.64, FREESASA_ATOM_POLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x000000334e005444ULL, 1.64, FREESASA_ATOM_POLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x0000003643004944ULL, 1.61, FREESASA_ATOM_APOLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x000000324e000047ULL, 1.64, FREESASA_ATOM_POLAR},
+    {0x000000374e004944ULL, 1.64, FREESASA_ATOM_POLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x000000314e004344ULL, 1.64, FREESASA_ATOM_POLAR},
+    {0x000000474355454cULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0x0000273243000043ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0x0000324543505254ULL, 1.61, FREESASA_ATOM_APOLAR},
+    {0x000000004f53594cULL, 1.42, FREESASA_ATOM_POLAR},
+    {0x000054584f525954ULL, 1.46, FREESASA_ATOM_POLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x0000004143535943ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0x000054584f4e5341ULL, 1.46, FREESASA_ATOM_POLAR},
+    {0x00003242434c5950ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x0000324743454c49ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0x0000003243000055ULL, 1.61, FREESASA_ATOM_APOLAR},
+    {0x000000004e535943ULL, 1.64, FREESASA_ATOM_POLAR},
+    {0x0000004143594c47ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0x0000003243000043ULL, 1.61, FREESASA_ATOM_APOLAR},
+    {0x0000004243554c47ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x0000273143000047ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0x000000004e475241ULL, 1.64, FREESASA_ATOM_POLAR},
+    {0x000027344f005444ULL, 1.46, FREESASA_ATOM_POLAR},
+    {0x0000003443000043ULL, 1.61, FREESASA_ATOM_APOLAR},
+    {0x0000000050000041ULL, 1.8, FREESASA_ATOM_POLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x000000004e4e4c47ULL, 1.64, FREESASA_ATOM_POLAR},
+    {0x0000004143525954ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0x000033504f000049ULL, 1.46, FREESASA_ATOM_POLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x000000314e004944ULL, 1.64, FREESASA_ATOM_POLAR},
+    {0x000031444f4e5341ULL, 1.42, FREESASA_ATOM_POLAR},
+    {0x000027354f005544ULL, 1.46, FREESASA_ATOM_POLAR},
+    {0x000000004e454850ULL, 1.64, FREESASA_ATOM_POLAR},
+    {0x0000273343000054ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0x000054584f524553ULL, 1.46, FREESASA_ATOM_POLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x0000003643000055ULL, 1.76, FREESASA_ATOM_APOLAR},
+    {0x0000273343005444ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0x000000004e534948ULL, 1.64, FREESASA_ATOM_POLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x000032504f000047ULL, 1.46, FREESASA_ATOM_POLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x000000004f594c47ULL, 1.42, FREESASA_ATOM_POLAR},
+    {0x000032504f000049ULL, 1.46, FREESASA_ATOM_POLAR},
+    {0x0000314443454c49ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0x0000273343004344ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0x0000000043584c47ULL, 1.61, FREESASA_ATOM_APOLAR},
+    {0x0000000043454850ULL, 1.61, FREESASA_ATOM_APOLAR},
+    {0x000000424355454cULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x000031504f004944ULL, 1.42, FREESASA_ATOM_POLAR},
+    {0x00000047434e4c47ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0x0000003243005444ULL, 1.61, FREESASA_ATOM_APOLAR},
+    {0x000000314e000049ULL, 1.64, FREESASA_ATOM_POLAR},
+    {0x000000454e475241ULL, 1.64, FREESASA_ATOM_POLAR},
+    {0x000032454f554c47ULL, 1.46, FREESASA_ATOM_POLAR},
+    {0x000027324f000047ULL, 1.46, FREESASA_ATOM_POLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x000027324f000041ULL, 1.46, FREESASA_ATOM_POLAR},
+    {0x0000005a43475241ULL, 1.61, FREESASA_ATOM_APOLAR},
+    {0x0000273543005444ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x000000324f4c5950ULL, 1.42, FREESASA_ATOM_POLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x000032504f005544ULL, 1.46, FREESASA_ATOM_POLAR},
+    {0x0000273443004944ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0x000027324f000049ULL, 1.46, FREESASA_ATOM_POLAR},
+    {0x0000000043414c41ULL, 1.61, FREESASA_ATOM_APOLAR},
+    {0x0000003643005544ULL, 1.76, FREESASA_ATOM_APOLAR},
+    {0x0000004243505341ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0x000000004f475241ULL, 1.42, FREESASA_ATOM_POLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x00000042434c4156ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0x000000334e000041ULL, 1.64, FREESASA_ATOM_POLAR},
+    {0x0000003643000049ULL, 1.61, FREESASA_ATOM_APOLAR},
+    {0x000033504f004744ULL, 1.46, FREESASA_ATOM_POLAR},
+    {0x0000273443004144ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0x0000000050000049ULL, 1.8, FREESASA_ATOM_POLAR},
+    {0x000000414353594cULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0x00000000434f5250ULL, 1.61, FREESASA_ATOM_APOLAR},
+    {0x0000273243005544ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0x00000041434e5341ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0x000000334e004344ULL, 1.64, FREESASA_ATOM_POLAR},
+    {0x00000041434c5950ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0x000031504f000043ULL, 1.42, FREESASA_ATOM_POLAR},
+    {0x0000004243434553ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0x000000314e000054ULL, 1.64, FREESASA_ATOM_POLAR},
+    {0x000054584f4c4156ULL, 1.46, FREESASA_ATOM_POLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x00000047434e5341ULL, 1.61, FREESASA_ATOM_APOLAR},
+    {0x000000004e585341ULL, 1.64, FREESASA_ATOM_POLAR},
+    {0x000027354f004344ULL, 1.46, FREESASA_ATOM_POLAR},
+    {0x0000003643005444ULL, 1.76, FREESASA_ATOM_APOLAR},
+    {0x0000003743000054ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0x000000004e55454cULL, 1.64, FREESASA_ATOM_POLAR},
+    {0x0000004243525954ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0x0000003543004944ULL, 1.61, FREESASA_ATOM_APOLAR},
+    {0x000000004e4c4156ULL, 1.64, FREESASA_ATOM_POLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x000027334f000055ULL, 1.46, FREESASA_ATOM_POLAR},
+    {0x00000000434e4c47ULL, 1.61, FREESASA_ATOM_APOLAR},
+    {0x0000273543004744ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0x0000004443475241ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x000000004f55454cULL, 1.42, FREESASA_ATOM_POLAR},
+    {0x0000273443000049ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0x0000003243004144ULL, 1.76, FREESASA_ATOM_APOLAR},
+    {0x0000335a43505254ULL, 1.76, FREESASA_ATOM_APOLAR},
+    {0x00003147434c4156ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0x000027334f004944ULL, 1.46, FREESASA_ATOM_POLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x0000004243454850ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0x000000314e004744ULL, 1.64, FREESASA_ATOM_POLAR},
+    {0x000032454e534948ULL, 1.64, FREESASA_ATOM_POLAR},
+    {0x0000003643000047ULL, 1.61, FREESASA_ATOM_APOLAR},
+    {0x00000042434f5250ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0x0000003443000055ULL, 1.61, FREESASA_ATOM_APOLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x0000004443554c47ULL, 1.61, FREESASA_ATOM_APOLAR},
+    {0x000000004e414c41ULL, 1.64, FREESASA_ATOM_POLAR},
+    {0x000000004f585341ULL, 1.42, FREESASA_ATOM_POLAR},
+    {0x000000004e32484eULL, 1.64, FREESASA_ATOM_POLAR},
+    {0x000000004f54454dULL, 1.42, FREESASA_ATOM_POLAR},
+    {0x000000004f454341ULL, 1.42, FREESASA_ATOM_POLAR},
+    {0x0000005a4e53594cULL, 1.64, FREESASA_ATOM_POLAR},
+    {0x000054584f414c41ULL, 1.46, FREESASA_ATOM_POLAR},
+    {0x000027354f000047ULL, 1.46, FREESASA_ATOM_POLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x000027344f000054ULL, 1.46, FREESASA_ATOM_POLAR},
+    {0x0000003243004344ULL, 1.61, FREESASA_ATOM_APOLAR},
+    {0x0000003843004944ULL, 1.76, FREESASA_ATOM_APOLAR},
+    {0x000027334f000054ULL, 1.46, FREESASA_ATOM_POLAR},
+    {0x00000000434c4156ULL, 1.61, FREESASA_ATOM_APOLAR},
+    {0x0000334543505254ULL, 1.76, FREESASA_ATOM_APOLAR},
+    {0x0000003843000047ULL, 1.76, FREESASA_ATOM_APOLAR},
+    {0x0000273143004344ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0x000000474354454dULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0x0000273343000047ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0x000027354f000049ULL, 1.46, FREESASA_ATOM_POLAR},
+    {0x0000003443004144ULL, 1.61, FREESASA_ATOM_APOLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x000000424354454dULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x0000000050004744ULL, 1.8, FREESASA_ATOM_POLAR},
+    {0x000000004f4e5341ULL, 1.42, FREESASA_ATOM_POLAR},
+    {0x0000273243000054ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0x0000004553434553ULL, 1.9, FREESASA_ATOM_POLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x0000314443454850ULL, 1.76, FREESASA_ATOM_APOLAR},
+    {0x0000000043475241ULL, 1.61, FREESASA_ATOM_APOLAR},
+    {0x000000344f000054ULL, 1.42, FREESASA_ATOM_POLAR},
+    {0x0000273243005444ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0x0000000043505341ULL, 1.61, FREESASA_ATOM_APOLAR},
+    {0x0000003443004744ULL, 1.61, FREESASA_ATOM_APOLAR},
+    {0x000032504f000043ULL, 1.46, FREESASA_ATOM_POLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x000054584f554c47ULL, 1.46, FREESASA_ATOM_POLAR},
+    {0x0000003543000043ULL, 1.76, FREESASA_ATOM_APOLAR},
+    {0x000000004e4f5250ULL, 1.64, FREESASA_ATOM_POLAR},
+    {0x0000004243584c47ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0x000000324f000043ULL, 1.42, FREESASA_ATOM_POLAR},
+    {0x0000004143534948ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0x0000273143000043ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0x000000364e004144ULL, 1.64, FREESASA_ATOM_POLAR},
+    {0x0000000050004344ULL, 1.8, FREESASA_ATOM_POLAR},
+    {0x0000003243005544ULL, 1.61, FREESASA_ATOM_APOLAR},
+    {0x00000042434c5950ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0x0000273443005544ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0x000000364f004944ULL, 1.42, FREESASA_ATOM_POLAR},
+    {0x0000003443004344ULL, 1.61, FREESASA_ATOM_APOLAR},
+    {0x0000004143475241ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0x0000003643000041ULL, 1.61, FREESASA_ATOM_APOLAR},
+    {0x0000004243524854ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0x000033504f000055ULL, 1.46, FREESASA_ATOM_POLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x000033504f004144ULL, 1.46, FREESASA_ATOM_POLAR},
+    {0x000031484e475241ULL, 1.64, FREESASA_ATOM_POLAR},
+    {0x0000273543004944ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0x0000004243524553ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x0000004743584c47ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0x000027334f004344ULL, 1.46, FREESASA_ATOM_POLAR},
+    {0x0000003543000054ULL, 1.61, FREESASA_ATOM_APOLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x0000004143434553ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0x0000003543004344ULL, 1.76, FREESASA_ATOM_APOLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x000033504f000041ULL, 1.46, FREESASA_ATOM_POLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x000054584f4c5950ULL, 1.46, FREESASA_ATOM_POLAR},
+    {0x00000044434e4c47ULL, 1.61, FREESASA_ATOM_APOLAR},
+    {0x000000334e000047ULL, 1.64, FREESASA_ATOM_POLAR},
+    {0x0000273243000055ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0x0000003643004744ULL, 1.61, FREESASA_ATOM_APOLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x00000041434c4156ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0x0000004743505341ULL, 1.61, FREESASA_ATOM_APOLAR},
+    {0x0000273243004144ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0x000032484e475241ULL, 1.64, FREESASA_ATOM_POLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x00000044434c5950ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0x000027354f004744ULL, 1.46, FREESASA_ATOM_POLAR},
+    {0x0000003543005544ULL, 1.76, FREESASA_ATOM_APOLAR},
+    {0x000000344f000055ULL, 1.42, FREESASA_ATOM_POLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x000000004f524553ULL, 1.42, FREESASA_ATOM_POLAR},
+    {0x0000273243000041ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0x000000004f454c49ULL, 1.42, FREESASA_ATOM_POLAR},
+    {0x000027344f000041ULL, 1.46, FREESASA_ATOM_POLAR},
+    {0x0000004143414c41ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x00000041434e4c47ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0x000000344f005544ULL, 1.42, FREESASA_ATOM_POLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x000031504f005544ULL, 1.42, FREESASA_ATOM_POLAR},
+    {0x0000005a43454850ULL, 1.76, FREESASA_ATOM_APOLAR},
+    {0x000000004e4c5950ULL, 1.64, FREESASA_ATOM_POLAR},
+    {0x0000003743005444ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0x0000314558584c47ULL, 1.5, FREESASA_ATOM_POLAR},
+    {0x0000000043534948ULL, 1.61, FREESASA_ATOM_APOLAR},
+    {0x000000364f004744ULL, 1.42, FREESASA_ATOM_POLAR},
+    {0x000054584f454850ULL, 1.46, FREESASA_ATOM_POLAR},
+    {0x0000273543004344ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0x000027344f004944ULL, 1.46, FREESASA_ATOM_POLAR},
+    {0x0000003543000041ULL, 1.61, FREESASA_ATOM_APOLAR},
+    {0x0000273443000047ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0x000000314e000047ULL, 1.64, FREESASA_ATOM_POLAR},
+    {0x000000484f525954ULL, 1.46, FREESASA_ATOM_POLAR},
+    {0x000027334f004744ULL, 1.46, FREESASA_ATOM_POLAR},
+    {0x000000004e525954ULL, 1.64, FREESASA_ATOM_POLAR},
+    {0x0000003543005444ULL, 1.61, FREESASA_ATOM_APOLAR},
+    {0x000000004f535943ULL, 1.42, FREESASA_ATOM_POLAR},
+    {0x0000324558584c47ULL, 1.5, FREESASA_ATOM_POLAR},
+    {0x000031504f000047ULL, 1.42, FREESASA_ATOM_POLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x000032504f005444ULL, 1.46, FREESASA_ATOM_POLAR},
+    {0x0000004743534948ULL, 1.61, FREESASA_ATOM_APOLAR},
+    {0x000032444355454cULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x0000004143524854ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0x000033504f000054ULL, 1.46, FREESASA_ATOM_POLAR},
+    {0x0000273543000054ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0x0000273443000041ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0x0000000043454341ULL, 1.76, FREESASA_ATOM_APOLAR},
+    {0x000000324f000054ULL, 1.42, FREESASA_ATOM_POLAR},
+    {0x000032444f505341ULL, 1.46, FREESASA_ATOM_POLAR},
+    {0x000000334e004944ULL, 1.64, FREESASA_ATOM_POLAR},
+    {0x000054584f55454cULL, 1.46, FREESASA_ATOM_POLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x000000004f584c47ULL, 1.42, FREESASA_ATOM_POLAR},
+    {0x0000004443584c47ULL, 1.61, FREESASA_ATOM_APOLAR},
+    {0x000000324e004744ULL, 1.64, FREESASA_ATOM_POLAR},
+    {0x000000004e434553ULL, 1.64, FREESASA_ATOM_POLAR},
+    {0x0000005a43525954ULL, 1.61, FREESASA_ATOM_APOLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x000031454f4e4c47ULL, 1.42, FREESASA_ATOM_POLAR},
+    {0x000054584f454c49ULL, 1.46, FREESASA_ATOM_POLAR},
+    {0x0000004243534948ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0x00000041434f5250ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x0000003243000041ULL, 1.76, FREESASA_ATOM_APOLAR},
+    {0x0000324743524854ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x000033504f000043ULL, 1.46, FREESASA_ATOM_POLAR},
+    {0x000000314e000043ULL, 1.64, FREESASA_ATOM_POLAR},
+    {0x000027354f004944ULL, 1.46, FREESASA_ATOM_POLAR},
+    {0x0000004743505254ULL, 1.61, FREESASA_ATOM_APOLAR},
+    {0x000000334e000049ULL, 1.64, FREESASA_ATOM_POLAR},
+    {0x000032454e4e4c47ULL, 1.64, FREESASA_ATOM_POLAR},
+    {0x00003247434c5950ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0x000000004f525954ULL, 1.42, FREESASA_ATOM_POLAR},
+    {0x0000273343000043ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x000027354f005444ULL, 1.46, FREESASA_ATOM_POLAR},
+    {0x000033504f000047ULL, 1.46, FREESASA_ATOM_POLAR},
+    {0x000000394e004944ULL, 1.64, FREESASA_ATOM_POLAR},
+    {0x0000003443005544ULL, 1.61, FREESASA_ATOM_APOLAR},
+    {0x0000324443525954ULL, 1.76, FREESASA_ATOM_APOLAR},
+    {0x000000004e454c49ULL, 1.64, FREESASA_ATOM_POLAR},
+    {0x00000047434c5950ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0x0000273343004744ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0x000000474f524553ULL, 1.46, FREESASA_ATOM_POLAR},
+    {0x0000273343000055ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0x0000273543005544ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x000000324f005444ULL, 1.42, FREESASA_ATOM_POLAR},
+    {0x0000273443004744ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0x000054584f585341ULL, 1.46, FREESASA_ATOM_POLAR},
+    {0x000027334f000049ULL, 1.46, FREESASA_ATOM_POLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x0000000043585341ULL, 1.61, FREESASA_ATOM_APOLAR},
+    {0x000033504f004944ULL, 1.46, FREESASA_ATOM_POLAR},
+    {0x0000273143004944ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x000054584f54454dULL, 1.46, FREESASA_ATOM_POLAR},
+    {0x000027354f000055ULL, 1.46, FREESASA_ATOM_POLAR},
+    {0x00000032434c5950ULL, 1.61, FREESASA_ATOM_APOLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x000000334e004144ULL, 1.64, FREESASA_ATOM_POLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x000054584f434553ULL, 1.46, FREESASA_ATOM_POLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x000000004e54454dULL, 1.64, FREESASA_ATOM_POLAR},
+    {0x000032504f004944ULL, 1.46, FREESASA_ATOM_POLAR},
+    {0x000027344f005544ULL, 1.46, FREESASA_ATOM_POLAR},
+    {0x000000004f4c5950ULL, 1.42, FREESASA_ATOM_POLAR},
+    {0x0000273243004344ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0x0000004243475241ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0x000000004f434553ULL, 1.42, FREESASA_ATOM_POLAR},
+    {0x0000004743554c47ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x0000003243004744ULL, 1.61, FREESASA_ATOM_APOLAR},
+    {0x0000000043454c49ULL, 1.61, FREESASA_ATOM_APOLAR},
+    {0x0000273343004144ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0x0000003643004344ULL, 1.76, FREESASA_ATOM_APOLAR},
+    {0x0000273143000054ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0x000027334f000041ULL, 1.46, FREESASA_ATOM_POLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x0000003543004744ULL, 1.61, FREESASA_ATOM_APOLAR},
+    {0x0000004143584c47ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x0000273143005544ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0x0000273243004944ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0x000000344f005444ULL, 1.42, FREESASA_ATOM_POLAR},
+    {0x0000273343000041ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0x000000314e000055ULL, 1.64, FREESASA_ATOM_POLAR},
+    {0x000000324f005544ULL, 1.42, FREESASA_ATOM_POLAR},
+    {0x0000334843454341ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0x0000273143000055ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0x000000004f4f5250ULL, 1.42, FREESASA_ATOM_POLAR},
+    {0x0000003443000054ULL, 1.61, FREESASA_ATOM_APOLAR},
+    {0x0000273543000049ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0x000027344f004144ULL, 1.46, FREESASA_ATOM_POLAR},
+    {0x0000004243454c49ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0x0000324843505254ULL, 1.76, FREESASA_ATOM_APOLAR},
+    {0x000000004f554c47ULL, 1.42, FREESASA_ATOM_POLAR},
+    {0x0000003243000047ULL, 1.61, FREESASA_ATOM_APOLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x000027354f000054ULL, 1.46, FREESASA_ATOM_POLAR},
+    {0x00003244434c5950ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0x0000273143004144ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x000000344e004344ULL, 1.64, FREESASA_ATOM_POLAR},
+    {0x0000273243000049ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0x0000000043524553ULL, 1.61, FREESASA_ATOM_APOLAR},
+    {0x0000003543000049ULL, 1.61, FREESASA_ATOM_APOLAR},
+    {0x000000004f484f48ULL, 1.46, FREESASA_ATOM_POLAR},
+    {0x00003241434c5950ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x0000314443525954ULL, 1.76, FREESASA_ATOM_APOLAR},
+    {0x000054584f594c47ULL, 1.46, FREESASA_ATOM_POLAR},
+    {0x0000000043535943ULL, 1.61, FREESASA_ATOM_APOLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x000027344f000055ULL, 1.46, FREESASA_ATOM_POLAR},
+    {0x000027344f000047ULL, 1.46, FREESASA_ATOM_POLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x000027334f000047ULL, 1.46, FREESASA_ATOM_POLAR},
+    {0x00000000434c5950ULL, 1.61, FREESASA_ATOM_APOLAR},
+    {0x0000324443534948ULL, 1.76, FREESASA_ATOM_APOLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x000031454e505254ULL, 1.64, FREESASA_ATOM_POLAR},
+    {0x000000004e505254ULL, 1.64, FREESASA_ATOM_POLAR},
+    {0x000027354f004144ULL, 1.46, FREESASA_ATOM_POLAR},
+    {0x0000005a4e4c5950ULL, 1.64, FREESASA_ATOM_POLAR},
+    {0x0000273143005444ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0x00000045434c5950ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0x000054584f505254ULL, 1.46, FREESASA_ATOM_POLAR},
+    {0x000054584f535943ULL, 1.46, FREESASA_ATOM_POLAR},
+    {0x0000000050000047ULL, 1.8, FREESASA_ATOM_POLAR},
+    {0x0000273443004344ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0x0000004143454c49ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0x000000334e000043ULL, 1.64, FREESASA_ATOM_POLAR},
+    {0x000032504f000055ULL, 1.46, FREESASA_ATOM_POLAR},
+    {0x000031504f004744ULL, 1.42, FREESASA_ATOM_POLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x0000004743585341ULL, 1.61, FREESASA_ATOM_APOLAR},
+    {0x000000334e004744ULL, 1.64, FREESASA_ATOM_POLAR},
+    {0x000000444353594cULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0x000054584f505341ULL, 1.46, FREESASA_ATOM_POLAR},
+    {0x000000004e524553ULL, 1.64, FREESASA_ATOM_POLAR},
+    {0x0000000043505254ULL, 1.61, FREESASA_ATOM_APOLAR},
+    {0x0000004743475241ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0x000027354f000041ULL, 1.46, FREESASA_ATOM_POLAR},
+    {0x000000004e554c47ULL, 1.64, FREESASA_ATOM_POLAR},
+    {0x000000314e005444ULL, 1.64, FREESASA_ATOM_POLAR},
+    {0x000027334f005544ULL, 1.46, FREESASA_ATOM_POLAR},
+    {0x000000004355454cULL, 1.61, FREESASA_ATOM_APOLAR},
+    {0x000000324e4c5950ULL, 1.64, FREESASA_ATOM_POLAR},
+    {0x000000364e000041ULL, 1.64, FREESASA_ATOM_POLAR},
+    {0x00000044434f5250ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0x000027324f000043ULL, 1.46, FREESASA_ATOM_POLAR},
+    {0x000000394e000047ULL, 1.64, FREESASA_ATOM_POLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x000027354f000043ULL, 1.46, FREESASA_ATOM_POLAR},
+    {0x000032504f004144ULL, 1.46, FREESASA_ATOM_POLAR},
+    {0x0000003243000054ULL, 1.61, FREESASA_ATOM_APOLAR},
+    {0x000032504f000054ULL, 1.46, FREESASA_ATOM_POLAR},
+    {0x0000314743454c49ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0x000000004e53594cULL, 1.64, FREESASA_ATOM_POLAR},
+    {0x000000004f4e4c47ULL, 1.42, FREESASA_ATOM_POLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x0000273343000049ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0x000031444355454cULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0x0000000043525954ULL, 1.61, FREESASA_ATOM_APOLAR},
+    {0x000000414354454dULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x000054584f4e4c47ULL, 1.46, FREESASA_ATOM_POLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x000033504f004344ULL, 1.46, FREESASA_ATOM_POLAR},
+    {0x0000004243535943ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0x0000324443454850ULL, 1.76, FREESASA_ATOM_APOLAR},
+    {0x000031504f000041ULL, 1.42, FREESASA_ATOM_POLAR},
+    {0x000000334e000054ULL, 1.64, FREESASA_ATOM_POLAR},
+    {0x0000003443004944ULL, 1.61, FREESASA_ATOM_APOLAR},
+    {0x000031504f004344ULL, 1.42, FREESASA_ATOM_POLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x0000003843000049ULL, 1.76, FREESASA_ATOM_APOLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x0000273243004744ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0x000000334e005544ULL, 1.64, FREESASA_ATOM_POLAR},
+    {0x000000374e004744ULL, 1.64, FREESASA_ATOM_POLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x0000273443000043ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0x0000273343005544ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0x0000273443000055ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0x000000424353594cULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0x0000314443505254ULL, 1.76, FREESASA_ATOM_APOLAR},
+    {0x0000003543000047ULL, 1.61, FREESASA_ATOM_APOLAR},
+    {0x0000003843000041ULL, 1.76, FREESASA_ATOM_APOLAR},
+    {0x000000004353594cULL, 1.61, FREESASA_ATOM_APOLAR},
+    {0x0000273243000047ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x000054584f53594cULL, 1.46, FREESASA_ATOM_POLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x0000004243585341ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x0000004743454850ULL, 1.61, FREESASA_ATOM_APOLAR},
+    {0x0000314543454850ULL, 1.76, FREESASA_ATOM_APOLAR},
+    {0x000031504f004144ULL, 1.42, FREESASA_ATOM_POLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x000031444e534948ULL, 1.64, FREESASA_ATOM_POLAR},
+    {0x000000004f4c4156ULL, 1.42, FREESASA_ATOM_POLAR},
+    {0x0000003643000054ULL, 1.76, FREESASA_ATOM_APOLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x000031504f000049ULL, 1.42, FREESASA_ATOM_POLAR},
+    {0x000000004e524854ULL, 1.64, FREESASA_ATOM_POLAR},
+    {0x000027334f004144ULL, 1.46, FREESASA_ATOM_POLAR},
+    {0x0000273443005444ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0x000032504f000041ULL, 1.46, FREESASA_ATOM_POLAR},
+    {0x0000273143000049ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0x000000374e000041ULL, 1.64, FREESASA_ATOM_POLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x000000004f534948ULL, 1.42, FREESASA_ATOM_POLAR},
+    {0x000000334e000055ULL, 1.64, FREESASA_ATOM_POLAR},
+    {0x000054584f584c47ULL, 1.46, FREESASA_ATOM_POLAR},
+    {0x000000414355454cULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0x0000000043594c47ULL, 1.61, FREESASA_ATOM_APOLAR},
+    {0x0000273143000041ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0x000000474353594cULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0x0000325a43505254ULL, 1.76, FREESASA_ATOM_APOLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x00000047434f5250ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x0000000050005444ULL, 1.8, FREESASA_ATOM_POLAR},
+    {0x0000314543525954ULL, 1.76, FREESASA_ATOM_APOLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x0000273543000043ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0x0000003543000055ULL, 1.76, FREESASA_ATOM_APOLAR},
+    {0x000033504f005544ULL, 1.46, FREESASA_ATOM_POLAR},
+    {0x0000003843004144ULL, 1.76, FREESASA_ATOM_APOLAR},
+    {0x000000364f000047ULL, 1.42, FREESASA_ATOM_POLAR},
+    {0x000031444f505341ULL, 1.42, FREESASA_ATOM_POLAR},
+    {0x0000003243004944ULL, 1.76, FREESASA_ATOM_APOLAR},
+    {0x000033504f005444ULL, 1.46, FREESASA_ATOM_POLAR},
+    {0x0000004143585341ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x000000344e000043ULL, 1.64, FREESASA_ATOM_POLAR},
+    {0x0000000050000054ULL, 1.8, FREESASA_ATOM_POLAR},
+    {0x000000374e000049ULL, 1.64, FREESASA_ATOM_POLAR},
+    {0x000054584f475241ULL, 1.46, FREESASA_ATOM_POLAR},
+    {0x0000273143004744ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0x0000003443000049ULL, 1.61, FREESASA_ATOM_APOLAR},
+    {0x000000004f414c41ULL, 1.42, FREESASA_ATOM_POLAR},
+    {0x000000394e004144ULL, 1.64, FREESASA_ATOM_POLAR},
+    {0x000000374e004144ULL, 1.64, FREESASA_ATOM_POLAR},
+    {0x0000273343004944ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0x000031504f000055ULL, 1.42, FREESASA_ATOM_POLAR},
+    {0x0000324443505254ULL, 1.61, FREESASA_ATOM_APOLAR},
+    {0x000000004e584c47ULL, 1.64, FREESASA_ATOM_POLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x000027344f000043ULL, 1.46, FREESASA_ATOM_POLAR},
+    {0x000000314e005544ULL, 1.64, FREESASA_ATOM_POLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x0000003443000047ULL, 1.61, FREESASA_ATOM_APOLAR},
+    {0x000031504f005444ULL, 1.42, FREESASA_ATOM_POLAR},
+    {0x0000003543004144ULL, 1.61, FREESASA_ATOM_APOLAR},
+    {0x0000003643000043ULL, 1.76, FREESASA_ATOM_APOLAR},
+    {0x0000000043554c47ULL, 1.61, FREESASA_ATOM_APOLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x0000004143454850ULL, 1.88, FREESASA_ATOM_APOLAR},
+    {0x0000000050000043ULL, 1.8, FREESASA_ATOM_POLAR},
+    {0x0000000050004144ULL, 1.8, FREESASA_ATOM_POLAR},
+    {0x0000000050000055ULL, 1.8, FREESASA_ATOM_POLAR},
+    {0x000000445354454dULL, 1.77, FREESASA_ATOM_POLAR},
+    {0, 0, FREESASA_ATOM_UNKNOWN},
+    {0x000000004f454850ULL, 1.42, FREESASA_ATOM_POLAR},
+};
+
+static struct classifier_index protor_index = {
+    125,
+    622,
+    protor_index_seed,
+    protor_index_slot,
+};
+
 const freesasa_classifier freesasa_protor_classifier = {
     39,    (char**) protor_residue_name,
     "ProtOr",
     (struct classifier_residue **) protor_residue_cfg,
+    &protor_index,
+    NULL,
+    0,
 };
 
@@ -152,6 +152,435 @@ freesasa_calc_structure(const freesasa_structure *structure,
                          parameters);
 }
 
+struct freesasa_trajectory {
+    int n_atoms;
+    double *xyz;    /* double precision copy of the current frame */
+    coord_t *coord; /* linked to xyz */
+    sr_workspace *sr;
+    lr_workspace *lr;
+};
+
+freesasa_trajectory *
+freesasa_trajectory_new(const freesasa_structure *structure,
+                        const freesasa_parameters *parameters)
+{
+    freesasa_trajectory *traj;
+    const double *radii;
+    int n;
+
+    assert(structure);
+
+    if (parameters == NULL) parameters = &freesasa_default_parameters;
+
+    n = freesasa_structure_n(structure);
+    if (n == 0) {
+        fail_msg("structure has no atoms");
+        return NULL;
+    }
+
+    traj = malloc(sizeof(freesasa_trajectory));
+    if (traj == NULL) {
+        mem_fail();
+        return NULL;
+    }
+
+    traj->n_atoms = n;
+    traj->coord = NULL;
+    traj->sr = NULL;
+    traj->lr = NULL;
+    traj->xyz = calloc(3 * n, sizeof(double));
+    if (traj->xyz == NULL) {
+        mem_fail();
+        goto cleanup;
+    }
+
+    traj->coord = freesasa_coord_new_linked(traj->xyz, n);
+    if (traj->coord == NULL) {
+        fail_msg("");
+        goto cleanup;
+    }
+
+    radii = freesasa_structure_radius(structure);
+    switch (parameters->alg) {
+    case FREESASA_SHRAKE_RUPLEY:
+        traj->sr = freesasa_sr_workspace_new(radii, n, parameters);
+        if (traj->sr == NULL) goto cleanup;
+        break;
+    case FREESASA_LEE_RICHARDS:
+        traj->lr = freesasa_lr_workspace_new(radii, n, parameters);
+        if (traj->lr == NULL) goto cleanup;
+        break;
+    default:
+        assert(0); /* should never get here */
+        break;
+    }
+
+    return traj;
+
+cleanup:
+    fail_msg("");
+    freesasa_trajectory_free(traj);
+    return NULL;
+}
+
+int freesasa_trajectory_calc_frame(freesasa_trajectory *traj,
+                                   const float *xyz,
+                                   double *sasa_out)
+{
+    int i;
+
+    assert(traj);
+    assert(xyz);
+    assert(sasa_out);
+
+    for (i = 0; i < 3 * traj->n_atoms; ++i) {
+        traj->xyz[i] = xyz[i];
+    }
+
+    if (traj->sr) return freesasa_sr_workspace_calc(traj->sr, sasa_out, traj->coord);
+    return freesasa_lr_workspace_calc(traj->lr, sasa_out, traj->coord);
+}
+
+void freesasa_trajectory_free(freesasa_trajectory *traj)
+{
+    if (traj) {
+        freesasa_sr_workspace_free(traj->sr);
+        freesasa_lr_workspace_free(traj->lr);
+        freesasa_coord_free(traj->coord);
+        free(traj->xyz);
+        free(traj);
+    }
+}
+
+struct freesasa_workspace {
+    int n_atoms;
+    freesasa_parameters parameters;
+    coord_t *coord;
+    double *radii; /* including probe, as in the S&R and L&R calculations */
+    nb_list *nb;
+    char *mask; /* atoms to recalculate, or that have been moved */
+    int *list;  /* indices of atoms to recalculate */
+    sr_workspace *sr;
+    lr_workspace *lr;
+};
+
+freesasa_workspace *
+freesasa_workspace_new(const freesasa_structure *structure,
+                       const freesasa_parameters *parameters)
+{
+    freesasa_workspace *ws;
+    const double *radii;
+    int i, n;
+
+    assert(structure);
+
+    if (parameters == NULL) parameters = &freesasa_default_parameters;
+
+    n = freesasa_structure_n(structure);
+    if (n == 0) {
+        fail_msg("structure has no atoms");
+        return NULL;
+    }
+
+    ws = malloc(sizeof(freesasa_workspace));
+    if (ws == NULL) {
+        mem_fail();
+        return NULL;
+    }
+
+    ws->n_atoms = n;
+    ws->parameters = *parameters;
+    ws->nb = NULL;
+    ws->sr = NULL;
+    ws->lr = NULL;
+    ws->coord = freesasa_coord_clone(freesasa_structure_xyz(structure));
+    ws->radii = malloc(sizeof(double) * n);
+    ws->mask = calloc(n, sizeof(char));
+    ws->list = malloc(sizeof(int) * n);
+    if (ws->coord == NULL || ws->radii == NULL || ws->mask == NULL || ws->list == NULL) {
+        mem_fail();
+        goto cleanup;
+    }
+
+    radii = freesasa_structure_radius(structure);
+    switch (parameters->alg) {
+    case FREESASA_SHRAKE_RUPLEY:
+        ws->sr = freesasa_sr_workspace_new(radii, n, parameters);
+        if (ws->sr == NULL) goto cleanup;
+        break;
+    case FREESASA_LEE_RICHARDS:
+        ws->lr = freesasa_lr_workspace_new(radii, n, parameters);
+        if (ws->lr == NULL) goto cleanup;
+        break;
+    default:
+        assert(0); /* should never get here */
+        break;
+    }
+
+    for (i = 0; i < n; ++i) {
+        ws->radii[i] = radii[i] + parameters->probe_radius;
+    }
+    ws->nb = freesasa_nb_new(ws->coord, ws->radii);
+    if (ws->nb == NULL) goto cleanup;
+
+    return ws;
+
+cleanup:
+    fail_msg("");
+    freesasa_workspace_free(ws);
+    return NULL;
+}
+
+/* Calculates the listed atoms with the current neighbor list of the
+   workspace, all atoms if atoms is NULL. */
+static int
+workspace_calc(freesasa_workspace *ws,
+               double *sasa,
+               const int *atoms,
+               int n)
+{
+    if (ws->sr)
+        return freesasa_sr_workspace_calc_atoms(ws->sr, sasa, ws->coord, ws->nb, atoms, n);
+    return freesasa_lr_workspace_calc_atoms(ws->lr, sasa, ws->coord, ws->nb, atoms, n);
+}
+
+static int
+same_parameters(const freesasa_parameters *p1,
+                const freesasa_parameters *p2)
+{
+    if (p1->alg != p2->alg || p1->probe_radius != p2->probe_radius) return 0;
+    if (p1->alg == FREESASA_SHRAKE_RUPLEY)
+        return p1->shrake_rupley_n_points == p2->shrake_rupley_n_points;
+    return p1->lee_richards_n_slices == p2->lee_richards_n_slices;
+}
+
+int freesasa_result_update(freesasa_result *result,
+                           freesasa_workspace *ws,
+                           const int *moved,
+                           int n_moved,
+                           const double *new_xyz)
+{
+    int i, ret, n_calc = 0;
+
+    assert(result);
+    assert(ws);
+    assert(moved || n_moved == 0);
+    assert(new_xyz || n_moved == 0);
+
+    if (result->n_atoms != ws->n_atoms) {
+        return fail_msg("result has %d atoms, workspace %d", result->n_atoms, ws->n_atoms);
+    }
+    if (!same_parameters(&result->parameters, &ws->parameters)) {
+        return fail_msg("result and workspace have different parameters");
+    }
+
+    for (i = 0; i < n_moved; ++i) {
+        if (moved[i] < 0 || moved[i] >= ws->n_atoms || ws->mask[moved[i]]) break;
+        ws->mask[moved[i]] = 1;
+    }
+    ret = i;
+    while (--i >= 0) {
+        ws->mask[moved[i]] = 0;
+    }
+    if (ret < n_moved) {
+        return fail_msg("invalid or repeated atom index %d", moved[ret]);
+    }
+
+    if (freesasa_nb_move(ws->nb, ws->coord, ws->radii, moved, n_moved, new_xyz, ws->mask))
+        return fail_msg("");
+
+    for (i = 0; i < ws->n_atoms; ++i) {
+        if (ws->mask[i]) {
+            ws->list[n_calc++] = i;
+            ws->mask[i] = 0;
+        }
+    }
+
+    if (workspace_calc(ws, result->sasa, ws->list, n_calc)) return fail_msg("");
+
+    result->total = 0;
+    for (i = 0; i < result->n_atoms; ++i) {
+        result->total += result->sasa[i];
+    }
+
+    return FREESASA_SUCCESS;
+}
+
+void freesasa_workspace_free(freesasa_workspace *ws)
+{
+    if (ws) {
+        freesasa_sr_workspace_free(ws->sr);
+        freesasa_lr_workspace_free(ws->lr);
+        freesasa_nb_free(ws->nb);
+        freesasa_coord_free(ws->coord);
+        free(ws->radii);
+        free(ws->mask);
+        free(ws->list);
+        free(ws);
+    }
+}
+
+/* Compares a padded atom name, such as " CA ", to a trimmed one */
+static int
+atom_name_is(const char *atom_name,
+             const char *name)
+{
+    size_t len = strlen(name);
+
+    while (*atom_name == ' ')
+        ++atom_name;
+    if (strncmp(atom_name, name, len) != 0) return 0;
+    atom_name += len;
+    while (*atom_name == ' ')
+        ++atom_name;
+
+    return *atom_name == '\0';
+}
+
+/* Stores the atoms of residue r_i that are removed in a scan of the
+   given type in removed, returns the number of atoms */
+static int
+scan_removed_atoms(const freesasa_structure *structure,
+                   int r_i,
+                   freesasa_scan_type type,
+                   int *removed)
+{
+    int i, first, last, n = 0, has_ca = 0;
+    const char *name;
+
+    freesasa_structure_residue_atoms(structure, r_i, &first, &last);
+
+    if (type == FREESASA_SCAN_ALANINE) {
+        for (i = first; i <= last; ++i) {
+            if (atom_name_is(freesasa_structure_atom_name(structure, i), "CA")) has_ca = 1;
+        }
+        if (!has_ca) return 0;
+    }
+
+    for (i = first; i <= last; ++i) {
+        name = freesasa_structure_atom_name(structure, i);
+        if (type == FREESASA_SCAN_ALANINE &&
+            (freesasa_atom_is_backbone(name) || atom_name_is(name, "CB"))) continue;
+        removed[n++] = i;
+    }
+
+    return n;
+}
+
+freesasa_scan_result *
+freesasa_residue_scan(const freesasa_structure *structure,
+                      const freesasa_parameters *parameters,
+                      freesasa_scan_type type)
+{
+    freesasa_workspace *ws;
+    freesasa_scan_result *scan = NULL;
+    freesasa_scan_residue *res;
+    double *sasa = NULL, *mutant = NULL;
+    int *removed = NULL;
+    int n_res, r, i, j, k, n_removed, n_calc;
+
+    assert(structure);
+    assert(type == FREESASA_SCAN_DELETE || type == FREESASA_SCAN_ALANINE);
+
+    if (parameters == NULL) parameters = &freesasa_default_parameters;
+
+    ws = freesasa_workspace_new(structure, parameters);
+    if (ws == NULL) {
+        fail_msg("");
+        return NULL;
+    }
+
+    n_res = freesasa_structure_n_residues(structure);
+    scan = calloc(1, sizeof(freesasa_scan_result));
+    sasa = malloc(sizeof(double) * ws->n_atoms);
+    mutant = malloc(sizeof(double) * ws->n_atoms);
+    removed = malloc(sizeof(int) * ws->n_atoms);
+    if (scan == NULL || sasa == NULL || mutant == NULL || removed == NULL) {
+        mem_fail();
+        goto cleanup;
+    }
+    scan->type = type;
+    scan->parameters = *parameters;
+    scan->n_residues = n_res;
+    scan->residue = calloc(n_res, sizeof(freesasa_scan_residue));
+    if (scan->residue == NULL) {
+        mem_fail();
+        goto cleanup;
+    }
+
+    /* wild type */
+    if (workspace_calc(ws, sasa, NULL, ws->n_atoms)) goto cleanup;
+    scan->total = 0;
+    for (i = 0; i < ws->n_atoms; ++i) {
+        scan->total += sasa[i];
+    }
+
+    for (r = 0; r < n_res; ++r) {
+        res = &scan->residue[r];
+        n_removed = scan_removed_atoms(structure, r, type, removed);
+        if (n_removed == 0) continue;
+
+        /* the atoms in contact with the removed ones are the only
+           ones whose SASA changes */
+        for (k = 0; k < n_removed; ++k) {
+            ws->mask[removed[k]] = 2;
+        }
+        n_calc = 0;
+        for (k = 0; k < n_removed; ++k) {
+            i = removed[k];
+            for (j = 0; j < ws->nb->nn[i]; ++j) {
+                if (!ws->mask[ws->nb->nb[i][j]]) {
+                    ws->mask[ws->nb->nb[i][j]] = 1;
+                    ws->list[n_calc++] = ws->nb->nb[i][j];
+                }
+            }
+        }
+
+        freesasa_nb_remove(ws->nb, ws->coord, removed, n_removed, NULL);
+        if (workspace_calc(ws, mutant, ws->list, n_calc)) goto cleanup;
+
+        res->n_removed = n_removed;
+        for (k = 0; k < n_removed; ++k) {
+            res->removed += sasa[removed[k]];
+            ws->mask[removed[k]] = 0;
+        }
+        for (k = 0; k < n_calc; ++k) {
+            i = ws->list[k];
+            res->exposed += mutant[i] - sasa[i];
+            ws->mask[i] = 0;
+        }
+        res->delta = res->exposed - res->removed;
+
+        /* restore the wild type */
+        if (freesasa_nb_insert(ws->nb, ws->coord, ws->radii, removed, n_removed, NULL))
+            goto cleanup;
+    }
+
+    freesasa_workspace_free(ws);
+    free(sasa);
+    free(mutant);
+    free(removed);
+
+    return scan;
+
+cleanup:
+    fail_msg("");
+    freesasa_workspace_free(ws);
+    freesasa_scan_result_free(scan);
+    free(sasa);
+    free(mutant);
+    free(removed);
+    return NULL;
+}
+
+void freesasa_scan_result_free(freesasa_scan_result *scan)
+{
+    if (scan) {
+        free(scan->residue);
+        free(scan);
+    }
+}
+
 freesasa_node *
 freesasa_calc_tree(const freesasa_structure *structure,
                    const freesasa_parameters *parameters,
@@ -167,7 +596,7 @@ freesasa_calc_tree(const freesasa_structure *structure,
                            parameters);
 
     if (result != NULL) {
-        tree = freesasa_tree_init(result, structure, name);
+        tree = freesasa_tree_init(result, structure, name, FREESASA_OUTPUT_ATOM);
     } else {
         fail_msg("");
     }
@@ -212,6 +641,9 @@ int freesasa_tree_export(FILE *file,
     if (options & FREESASA_RSA) {
         count_err(freesasa_write_rsa(file, root, options), &n_err);
     }
+    if (options & FREESASA_BIN) {
+        count_err(freesasa_write_bin(file, root, options), &n_err);
+    }
     if (options & FREESASA_JSON) {
 #if USE_JSON
         count_err(freesasa_write_json(file, root, options), &n_err);
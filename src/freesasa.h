@@ -55,6 +55,12 @@
     exception where a lower level node can be modified is
     freesasa_node_structure_add_selection().
 
+    Note that traversing the tree modifies it: the atom nodes of a
+    residue are only created the first time freesasa_node_children()
+    is called for that residue, and stay in the tree until it is
+    freed. Traversal from several threads at the same time is safe
+    when the library is built with thread support.
+
     @defgroup structure Structure
 
     @brief Representation of macromolecular structures.
@@ -216,6 +222,13 @@ enum freesasa_output_options {
        manually set radii, invalidating reference values
      */
     FREESASA_OUTPUT_SKIP_REL = 1 << 13,
+    FREESASA_BIN = 1 << 14, /**< Binary columnar output, see freesasa_result_map(). */
+
+    /**
+       Store areas and radii in binary output as `float` instead of
+       `double`.
+     */
+    FREESASA_BIN_FLOAT = 1 << 15,
 };
 
 /**
@@ -275,6 +288,52 @@ struct freesasa_result {
 typedef struct freesasa_result freesasa_result;
 #endif
 
+/**
+   @brief Types of residue scans, see freesasa_residue_scan()
+   @ingroup core
+ */
+enum freesasa_scan_type {
+    FREESASA_SCAN_DELETE, /**< Remove all atoms of the residue. */
+    FREESASA_SCAN_ALANINE /**< Remove the side chain beyond CB (alanine scan). */
+};
+
+#ifndef __cplusplus
+typedef enum freesasa_scan_type freesasa_scan_type;
+#endif
+
+/**
+   Change in SASA when (part of) one residue is removed.
+
+   @ingroup core
+ */
+struct freesasa_scan_residue {
+    int n_removed;  /**< Number of atoms removed. */
+    double removed; /**< SASA of the removed atoms in the wild type. */
+    double exposed; /**< SASA gained by the remaining atoms. */
+    double delta;   /**< Change in total SASA, `exposed - removed`. */
+};
+
+#ifndef __cplusplus
+typedef struct freesasa_scan_residue freesasa_scan_residue;
+#endif
+
+/**
+   Results of a residue scan, generated by freesasa_residue_scan().
+
+   @ingroup core
+ */
+struct freesasa_scan_result {
+    freesasa_scan_type type;        /**< Type of scan. */
+    double total;                   /**< Total SASA of the wild type. */
+    int n_residues;                 /**< Number of residues. */
+    freesasa_scan_residue *residue; /**< One element per residue of the structure. */
+    freesasa_parameters parameters; /**< Parameters used in the calculation. */
+};
+
+#ifndef __cplusplus
+typedef struct freesasa_scan_result freesasa_scan_result;
+#endif
+
 /**
    Struct to store integrated SASA values for either a full structure
    or a subset thereof.
@@ -360,6 +419,48 @@ typedef struct freesasa_node freesasa_node;
  */
 typedef struct freesasa_selection freesasa_selection;
 
+/**
+   @brief Compiled selection
+
+   A selection command that has been parsed once, to be evaluated
+   for several structures. Generated by freesasa_selection_compile().
+
+   @ingroup selection
+ */
+typedef struct freesasa_compiled_selection freesasa_compiled_selection;
+
+/**
+   @brief Model iterator
+
+   Reads the models of a PDB file one at a time. Generated by
+   freesasa_model_iter_new().
+
+   @ingroup structure
+ */
+typedef struct freesasa_model_iter freesasa_model_iter;
+
+/**
+   @brief Trajectory
+
+   Buffers and threads for calculating SASA of many sets of
+   coordinates of the same structure. Generated by
+   freesasa_trajectory_new().
+
+   @ingroup core
+ */
+typedef struct freesasa_trajectory freesasa_trajectory;
+
+/**
+   @brief Workspace for incremental calculations
+
+   Coordinates, neighbor lists and buffers of a structure, used to
+   update results when some atoms are moved. Generated by
+   freesasa_workspace_new().
+
+   @ingroup core
+ */
+typedef struct freesasa_workspace freesasa_workspace;
+
 /**
    @brief Classifier struct
 
@@ -443,6 +544,168 @@ freesasa_calc_coord(const double *xyz,
                     int n,
                     const freesasa_parameters *parameters);
 
+/**
+    Prepare SASA calculations for the frames of a trajectory.
+
+    The radii of the structure, and all buffers, test points and
+    threads needed for the calculation are set up once, and reused by
+    each call to freesasa_trajectory_calc_frame(). The structure is
+    only used to get the radii, and is not referenced after the call.
+
+    Return value is dynamically allocated, should be freed with
+    freesasa_trajectory_free().
+
+    @param structure The structure (topology) of the trajectory.
+    @param parameters Parameters for the calculation, if `NULL`
+      defaults are used.
+
+    @return The trajectory, `NULL` if the structure is empty, the
+      parameters invalid, or if memory allocation failed.
+
+    @ingroup core
+ */
+freesasa_trajectory *
+freesasa_trajectory_new(const freesasa_structure *structure,
+                        const freesasa_parameters *parameters);
+
+/**
+    Calculates SASA for one frame of a trajectory.
+
+    No memory is allocated, unless the atoms have more neighbors than
+    in any earlier frame.
+
+    @param trajectory The trajectory.
+    @param xyz Single precision coordinates of the frame, in the form
+      x1,y1,z1,x2,y2,z2,...,xn,yn,zn, where n is the number of atoms
+      in the structure the trajectory was created from.
+    @param sasa_out The SASA of each atom is written to this array,
+      which should have n elements.
+
+    @return ::FREESASA_SUCCESS, or ::FREESASA_FAIL if memory
+      allocation failed.
+
+    @ingroup core
+ */
+int freesasa_trajectory_calc_frame(freesasa_trajectory *trajectory,
+                                   const float *xyz,
+                                   double *sasa_out);
+
+/**
+    Frees a ::freesasa_trajectory object.
+
+    @param trajectory the object to be freed.
+
+    @ingroup core
+ */
+void freesasa_trajectory_free(freesasa_trajectory *trajectory);
+
+/**
+    Prepare incremental updates of the SASA of a structure.
+
+    The workspace keeps a copy of the coordinates of the structure,
+    which are changed by freesasa_result_update(), but the structure
+    itself is not referenced after the call.
+
+    Return value is dynamically allocated, should be freed with
+    freesasa_workspace_free().
+
+    @param structure The structure.
+    @param parameters Parameters for the calculation, if `NULL`
+      defaults are used.
+
+    @return The workspace, `NULL` if the structure is empty, the
+      parameters invalid, or if memory allocation failed.
+
+    @ingroup core
+ */
+freesasa_workspace *
+freesasa_workspace_new(const freesasa_structure *structure,
+                       const freesasa_parameters *parameters);
+
+/**
+    Updates a result after some atoms have been moved.
+
+    Only the SASA of the moved atoms, and of the atoms that were or are
+    in contact with them, are recalculated. The result is identical to
+    that of a new calculation with the new coordinates.
+
+    The result should be calculated with freesasa_calc_structure() for
+    the structure the workspace was created from, with the same
+    parameters. It can then be updated any number of times, each
+    update starting from the coordinates after the previous update.
+
+    @param result The result to update.
+    @param workspace The workspace.
+    @param moved Indices of the moved atoms, each index can only occur
+      once.
+    @param n_moved Number of moved atoms.
+    @param new_xyz New coordinates of the moved atoms, in the form
+      x1,y1,z1,...,xn,yn,zn, in the same order as moved.
+
+    @return ::FREESASA_SUCCESS. ::FREESASA_FAIL if the result and
+      workspace don't match, the indices are invalid, or if memory
+      allocation failed. In the last case the result and workspace
+      can not be used further.
+
+    @ingroup core
+ */
+int freesasa_result_update(freesasa_result *result,
+                           freesasa_workspace *workspace,
+                           const int *moved,
+                           int n_moved,
+                           const double *new_xyz);
+
+/**
+    Frees a ::freesasa_workspace object.
+
+    @param workspace the object to be freed.
+
+    @ingroup core
+ */
+void freesasa_workspace_free(freesasa_workspace *workspace);
+
+/**
+    Calculates the change in SASA when each residue of a structure is
+    removed in turn.
+
+    The SASA of the wild type is calculated once. Then, for each
+    residue, the atoms are removed from the neighbor list of the wild
+    type and only the atoms in contact with them are recalculated, so
+    that a scan costs little more than a few full calculations. The
+    results are the same as calculating the SASA of each mutant
+    structure from scratch.
+
+    With ::FREESASA_SCAN_ALANINE only the side chain atoms beyond CB
+    are removed, and only in residues with a CA atom, for other
+    residues `n_removed` is 0 and all areas are 0.
+
+    Return value is dynamically allocated, should be freed with
+    freesasa_scan_result_free().
+
+    @param structure The structure.
+    @param parameters Parameters for the calculation, if `NULL`
+      defaults are used.
+    @param type Type of scan.
+
+    @return The results, `NULL` if the structure is empty, the
+      parameters invalid, or if memory allocation failed.
+
+    @ingroup core
+ */
+freesasa_scan_result *
+freesasa_residue_scan(const freesasa_structure *structure,
+                      const freesasa_parameters *parameters,
+                      freesasa_scan_type type);
+
+/**
+    Frees a ::freesasa_scan_result object.
+
+    @param scan the object to be freed.
+
+    @ingroup core
+ */
+void freesasa_scan_result_free(freesasa_scan_result *scan);
+
 /**
     Calculates SASA for a structure and returns as a tree of
     ::freesasa_node.
@@ -494,7 +757,10 @@ void freesasa_result_free(freesasa_result *result);
 /**
     Generate a classifier from a config-file.
 
-    Input file format described in @ref Config-file
+    Input file format described in @ref Config-file. The file can
+    also be a compiled classifier written by
+    freesasa_classifier_write_compiled(), which is memory-mapped
+    where the platform supports it.
 
     Return value is dynamically allocated, should be freed with
     freesasa_classifier_free().
@@ -519,6 +785,26 @@ freesasa_classifier_from_file(FILE *file);
  */
 void freesasa_classifier_free(freesasa_classifier *classifier);
 
+/**
+    Write a classifier in compiled binary form.
+
+    The compiled file contains the precomputed lookup tables of the
+    classifier and can be loaded with freesasa_classifier_from_file()
+    without parsing. The format is platform-dependent and is rejected
+    by freesasa_classifier_from_file() on incompatible platforms.
+    Residue and atom names can be at most 3 and 4 characters long
+    respectively (as in PDB files).
+
+    @param output File to write to, should be opened in binary mode.
+    @param classifier The classifier.
+    @return ::FREESASA_SUCCESS on success. ::FREESASA_FAIL if the
+      classifier can't be compiled or if there were write errors.
+
+    @ingroup classifier
+ */
+int freesasa_classifier_write_compiled(FILE *output,
+                                       const freesasa_classifier *classifier);
+
 /**
     Use a classifier to determine the radius of a given atom.
 
@@ -656,6 +942,61 @@ freesasa_selection_area(const freesasa_selection *selection);
  */
 int freesasa_selection_n_atoms(const freesasa_selection *selection);
 
+/**
+    Parse a selection command once, for use with several structures.
+
+    Calling freesasa_selection_new() for each structure parses the
+    command each time, this function allows the parsing to be done
+    once. The command syntax is the same as for
+    freesasa_selection_new().
+
+    The return value should be freed with
+    freesasa_compiled_selection_free().
+
+    @param command The selection
+    @return The compiled selection. `NULL` if the command could not be
+      parsed or if there was a memory allocation failure.
+
+    @ingroup selection
+ */
+freesasa_compiled_selection *
+freesasa_selection_compile(const char *command);
+
+/**
+    Get area of a compiled selection.
+
+    Equivalent to freesasa_selection_new() with the command that
+    `compiled` was generated from. The selected atoms are stored in
+    `compiled`, and if the next structure it is evaluated for has
+    identical atoms (names, residues and chains, but not necessarily
+    coordinates), such as the models of an NMR structure, the atoms
+    are not selected again. This also means that warnings about the
+    selection are only printed once. Selections that use `within` or
+    `around` depend on coordinates and are always evaluated. The same compiled selection
+    should therefore not be used from several threads
+    simultaneously.
+
+    @param compiled The compiled selection
+    @param structure The structure to select from
+    @param result The results to integrate
+    @return The selection. `NULL` if something went wrong.
+
+    @ingroup selection
+ */
+freesasa_selection *
+freesasa_compiled_selection_eval(freesasa_compiled_selection *compiled,
+                                 const freesasa_structure *structure,
+                                 const freesasa_result *result);
+
+/**
+    Free compiled selection.
+
+    @param compiled The compiled selection
+
+    @ingroup selection
+ */
+void freesasa_compiled_selection_free(freesasa_compiled_selection *compiled);
+
 /**
     Set the global verbosity level.
 
@@ -763,7 +1104,8 @@ void freesasa_structure_free(freesasa_structure *structure);
     Return value is dynamically allocated, should be freed with
     freesasa_structure_free().
 
-    @param pdb A PDB file
+    @param pdb A PDB file. Gzip compressed files are decompressed
+      automatically (if FreeSASA was built with zlib).
 
     @param classifier A freesasa_classifier to determine radius of
       atom. If `NULL` default classifier is used.
@@ -792,7 +1134,7 @@ freesasa_structure_from_pdb(FILE *pdb,
     be freed using freesasa_structure_free() and the array itself with
     free().
 
-    @param pdb Input PDB-file.
+    @param pdb Input PDB-file, can be gzip compressed.
     @param n Number of structures found are written to this integer.
     @param classifier A classifier to calculate atomic radii.
     @param options Bitfield. Either or both of
@@ -814,6 +1156,86 @@ freesasa_structure_array(FILE *pdb,
                          const freesasa_classifier *classifier,
                          int options);
 
+/**
+    Init iterator over the models of a PDB file.
+
+    Unlike freesasa_structure_array(), which keeps all models in
+    memory, the iterator reads one model per call to
+    freesasa_model_iter_next(). The first model is read as by
+    freesasa_structure_from_pdb(). For the following models only the
+    coordinates are read, and the atoms, residues, radii and classes
+    of the first model are reused. Memory use is therefore independent
+    of the number of models.
+
+    The file has to stay open while the iterator is used. Gzip
+    compressed input is first decompressed to a temporary file.
+
+    @param pdb Input PDB-file, can be gzip compressed.
+    @param classifier A classifier to calculate atomic radii.
+    @param options Bitfield with options for deciding what atoms to
+      include, see freesasa_structure_from_pdb().
+      ::FREESASA_JOIN_MODELS and ::FREESASA_SEPARATE_CHAINS are not
+      supported.
+    @return The iterator. Returns `NULL` and prints error if options
+      are invalid or upon memory allocation failure.
+
+    @ingroup structure
+ */
+freesasa_model_iter *
+freesasa_model_iter_new(FILE *pdb,
+                        const freesasa_classifier *classifier,
+                        int options);
+
+/**
+    Read the next model.
+
+    The returned structure belongs to the iterator and is only valid
+    until the next call to freesasa_model_iter_next() or
+    freesasa_model_iter_free(), since the same structure is updated
+    with the coordinates of each model. Its model number is the
+    position of the model in the file (starting at 1), as for
+    freesasa_structure_array().
+
+    Atoms in later models that are not in the first model are
+    ignored. A model that lacks some of the atoms of the first model
+    is an error.
+
+    @param iter The iterator.
+    @return The structure of the next model. Returns `NULL` when there
+      are no more models, or prints error and returns `NULL` if the
+      input is invalid. In the latter case
+      freesasa_model_iter_has_next() still returns 1.
+
+    @ingroup structure
+ */
+const freesasa_structure *
+freesasa_model_iter_next(freesasa_model_iter *iter);
+
+/**
+    Check if there are more models.
+
+    Looks ahead in the file for another model, without reading it.
+
+    @param iter The iterator.
+    @return 1 if there is another model to read, or if reading the
+      last one failed, 0 else.
+
+    @ingroup structure
+ */
+int freesasa_model_iter_has_next(const freesasa_model_iter *iter);
+
+/**
+    Free model iterator.
+
+    Also frees the structure returned by the last call to
+    freesasa_model_iter_next(). Does not close the input file.
+
+    @param iter The iterator.
+
+    @ingroup structure
+ */
+void freesasa_model_iter_free(freesasa_model_iter *iter);
+
 /**
     Add individual atom to structure using default behavior.
 
@@ -941,6 +1363,48 @@ freesasa_structure_get_chains(const freesasa_structure *structure,
                               const freesasa_classifier *classifier,
                               int options);
 
+/**
+    Save a structure in binary form.
+
+    All properties of the structure are saved: coordinates, radii,
+    atom classes, the residue and chain tables, reference areas and
+    the PDB lines of the atoms (if any). The structure can be restored
+    with freesasa_structure_load(), without parsing and classifying
+    the input again. Several structures can be saved to the same file,
+    one after the other.
+
+    The format is in native byte order and sizes, the files can only
+    be loaded on the platform they were saved on.
+
+    @param output Output file, should be opened in binary mode.
+    @param structure The structure.
+    @return ::FREESASA_SUCCESS. ::FREESASA_FAIL if there were problems
+      writing to the file.
+
+    @ingroup structure
+ */
+int freesasa_structure_save(FILE *output,
+                            const freesasa_structure *structure);
+
+/**
+    Load a structure saved with freesasa_structure_save().
+
+    Reads one structure from the current position of the file, and
+    leaves the file positioned after it.
+
+    Return value is dynamically allocated, should be freed with
+    freesasa_structure_free().
+
+    @param input Input file, should be opened in binary mode.
+    @return The structure. `NULL` if the file is not a saved structure,
+      was saved on an incompatible platform, is corrupt, or if memory
+      allocation fails.
+
+    @ingroup structure
+ */
+freesasa_structure *
+freesasa_structure_load(FILE *input);
+
 /**
     Get string listing all chains in structure.
 
@@ -1281,6 +1745,14 @@ freesasa_tree_new(void);
     @param structure A structure.
     @param name Name of the results (typically filename from
       which structure is derived)
+    @param depth The lowest level of nodes to create, one of
+      ::FREESASA_OUTPUT_ATOM, ::FREESASA_OUTPUT_RESIDUE,
+      ::FREESASA_OUTPUT_CHAIN or ::FREESASA_OUTPUT_STRUCTURE (other
+      options are ignored, i.e. the same options as for
+      freesasa_tree_export() can be used). The areas of the nodes
+      that are created are the same as in a full tree, but are
+      summed directly from the result. If no depth is specified all
+      levels are created.
 
     @return The root node of the tree. `NULL` if memory allocation
       fails.
@@ -1290,7 +1762,8 @@ freesasa_tree_new(void);
 freesasa_node *
 freesasa_tree_init(const freesasa_result *result,
                    const freesasa_structure *structure,
-                   const char *name);
+                   const char *name,
+                   int depth);
 
 /**
     Add a new set of results to a tree.
@@ -1330,6 +1803,27 @@ int freesasa_tree_add_result(freesasa_node *tree,
 int freesasa_tree_join(freesasa_node *tree1,
                        freesasa_node **tree2);
 
+/**
+    Join several trees.
+
+    Equivalent to calling freesasa_tree_join() for each tree in
+    order, the results of the trees are appended to `tree`. The time
+    taken is linear in the number of trees, not in the number of
+    results already in `tree`.
+
+    @param tree Node of type ::FREESASA_NODE_ROOT. The joint tree
+      will be stored here.
+    @param trees Array of nodes of type ::FREESASA_NODE_ROOT. All are
+      added to tree, and then changed to `NULL`.
+    @param n Number of trees in the array.
+    @return ::FREESASA_SUCCESS.
+
+    @ingroup node
+ */
+int freesasa_tree_join_many(freesasa_node *tree,
+                            freesasa_node **trees,
+                            int n);
+
 /**
     Outputs result in format specified by options.
 
@@ -1346,6 +1840,133 @@ int freesasa_tree_export(FILE *output,
                          freesasa_node *root,
                          int options);
 
+/**
+   Width of the fixed-size name fields in binary output, including
+   the terminating `'\0'`.
+
+   @see freesasa_result_map()
+   @ingroup node
+ */
+#define FREESASA_MAPPED_NAME_SIZE 8
+
+/**
+   A structure in a mapped result file.
+
+   The layout is the same as in the file. Chain and atom indices refer
+   to the arrays in ::freesasa_mapped_result, which hold the chains
+   and atoms of all structures in the file in order.
+
+   @ingroup node
+ */
+struct freesasa_mapped_structure {
+    unsigned int first_chain;   /**< Index of the first chain. */
+    unsigned int n_chains;      /**< Number of chains. */
+    unsigned int first_atom;    /**< Index of the first atom. */
+    unsigned int n_atoms;       /**< Number of atoms. */
+    int model;                  /**< Model number. */
+    unsigned int name;          /**< Name of the input, as offset in freesasa_mapped_result::strings. */
+    unsigned int classified_by; /**< Name of the classifier, as offset in freesasa_mapped_result::strings. */
+    unsigned int algorithm;     /**< The ::freesasa_algorithm used. */
+    unsigned int resolution;    /**< Number of test points (S&R) or slices per atom (L&R). */
+    unsigned int reserved;      /**< Unused. */
+    double probe_radius;        /**< Probe radius. */
+    double total;               /**< Total SASA. */
+    double main_chain;          /**< Main-chain SASA. */
+    double side_chain;          /**< Side-chain SASA. */
+    double polar;               /**< Polar SASA. */
+    double apolar;              /**< Apolar SASA. */
+    double unknown;             /**< SASA of unknown class. */
+};
+
+#ifndef __cplusplus
+typedef struct freesasa_mapped_structure freesasa_mapped_structure;
+#endif
+
+/**
+   A result file written with ::FREESASA_BIN, mapped into memory by
+   freesasa_result_map().
+
+   All arrays point directly into the mapped file. The residues of
+   chain `i` are those from `chain_residues[i]` to
+   `chain_residues[i+1] - 1`, and the atoms of residue `j` those from
+   `residue_atoms[j]` to `residue_atoms[j+1] - 1`.
+
+   The area columns (`atom_radius`, `atom_area`, `residue_area` and
+   `chain_area`) are arrays of `float` or `double`, depending on
+   `area_size`, use freesasa_mapped_result_value() to read them. The
+   residue and chain columns have six values per residue or chain, in
+   the same order as in ::freesasa_nodearea: total, main-chain,
+   side-chain, polar, apolar and unknown.
+
+   @ingroup node
+ */
+struct freesasa_mapped_result {
+    int n_structures;                                        /**< Number of structures. */
+    int n_chains;                                            /**< Number of chains. */
+    int n_residues;                                          /**< Number of residues. */
+    int n_atoms;                                             /**< Number of atoms. */
+    int area_size;                                           /**< Size of area values, 4 or 8 bytes. */
+    const freesasa_mapped_structure *structure;              /**< The structures. */
+    const unsigned int *chain_residues;                      /**< First residue of each chain, `n_chains + 1` elements. */
+    const unsigned int *residue_atoms;                       /**< First atom of each residue, `n_residues + 1` elements. */
+    const char *chain_label;                                 /**< Label of each chain. */
+    const char (*residue_name)[FREESASA_MAPPED_NAME_SIZE];   /**< Name of each residue. */
+    const char (*residue_number)[FREESASA_MAPPED_NAME_SIZE]; /**< Number of each residue. */
+    const char (*atom_name)[FREESASA_MAPPED_NAME_SIZE];      /**< Name of each atom. */
+    const unsigned char *atom_class;                         /**< The ::freesasa_atom_class of each atom. */
+    const unsigned char *atom_mainchain;                     /**< 1 if an atom is in the main chain, 0 else. */
+    const void *atom_radius;                                 /**< Radius of each atom. */
+    const void *atom_area;                                   /**< SASA of each atom. */
+    const void *residue_area;                                /**< SASA of each residue, six values per residue. */
+    const void *chain_area;                                  /**< SASA of each chain, six values per chain. */
+    const char *strings;                                     /**< Names of inputs and classifiers. */
+};
+
+#ifndef __cplusplus
+typedef struct freesasa_mapped_result freesasa_mapped_result;
+#endif
+
+/**
+    Map a result file written with ::FREESASA_BIN into memory.
+
+    The file is memory-mapped, if the platform supports it, and
+    nothing is copied. If not, it is read into memory. The file is
+    little-endian, and can only be mapped on little-endian platforms.
+
+    Return value should be freed with freesasa_mapped_result_free().
+
+    @param filename The file.
+    @return The mapped file. `NULL` if the file can't be opened, if it
+      is not a valid result file, or if the platform is incompatible.
+
+    @ingroup node
+ */
+freesasa_mapped_result *
+freesasa_result_map(const char *filename);
+
+/**
+    Read a value from one of the area columns of a mapped result.
+
+    @param map The mapped result.
+    @param column One of the area columns of `map`.
+    @param i Index in the column.
+    @return The value.
+
+    @ingroup node
+ */
+double freesasa_mapped_result_value(const freesasa_mapped_result *map,
+                                    const void *column,
+                                    int i);
+
+/**
+    Unmap and free a mapped result.
+
+    @param map The mapped result. If `NULL`, nothing is done.
+
+    @ingroup node
+ */
+void freesasa_mapped_result_free(freesasa_mapped_result *map);
+
 /**
     Free tree.
 
@@ -1375,9 +1996,13 @@ freesasa_node_area(const freesasa_node *node);
 
     Use freesasa_node_next() to access next sibling.
 
+    For a residue the atom nodes are allocated the first time this is
+    called, i.e. the tree is modified.
+
     @param node The node.
     @return Pointer to the first child of a node. `NULL` if the node has no
-      children.
+      children, or if the atom nodes of a residue could not be
+      allocated (an error message is printed).
 
     @ingroup node
  */
@@ -1436,6 +2061,16 @@ freesasa_node_type(const freesasa_node *node);
 const char *
 freesasa_node_name(const freesasa_node *node);
 
+/**
+    The number of results in a tree.
+
+    @param node A node of type ::FREESASA_NODE_ROOT.
+    @return Number of results.
+
+    @ingroup node
+ */
+int freesasa_node_root_n_results(const freesasa_node *node);
+
 /**
     The name of the classifier used to generate the node.
 
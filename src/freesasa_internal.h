@@ -15,6 +15,7 @@ extern "C" {
 
 #include "coord.h"
 #include "freesasa.h"
+#include "nb.h"
 
 /** The name of the library, to be used in error messages and logging */
 extern const char *freesasa_name;
@@ -102,6 +103,137 @@ int freesasa_lee_richards(double *sasa,
                           const double *radii,
                           const freesasa_parameters *param);
 
+/** Buffers and threads of S&R calculations on a fixed set of atoms */
+typedef struct sr_workspace sr_workspace;
+
+/** Buffers and threads of L&R calculations on a fixed set of atoms */
+typedef struct lr_workspace lr_workspace;
+
+/**
+    Prepare repeated S&R calculations for a set of atoms.
+
+    Sets up the test points, the radii, all buffers and the threads
+    once, so that only the neighbor list has to be recalculated for
+    each new set of coordinates.
+
+    @param radii Array of radii for each sphere.
+    @param n_atoms Number of spheres, > 0.
+    @param param Parameters specifying resolution, probe radius and
+    number of threads. If NULL :.freesasa_default_parameters is used.
+    @return The workspace. NULL if parameters are invalid or if
+    memory allocation fails.
+ */
+sr_workspace *
+freesasa_sr_workspace_new(const double *radii,
+                          int n_atoms,
+                          const freesasa_parameters *param);
+
+/**
+    Calculate SASA using S&R algorithm, with a workspace.
+
+    @param ws The workspace.
+    @param sasa The results are written to this array, the user has to
+    make sure it is large enough.
+    @param c Coordinates, the number has to be the same as when the
+    workspace was created.
+    @return ::FREESASA_SUCCESS on success, ::FREESASA_FAIL if memory
+    allocation failure.
+ */
+int freesasa_sr_workspace_calc(sr_workspace *ws,
+                               double *sasa,
+                               const coord_t *c);
+
+/**
+    Calculate S&R SASA of some atoms with a given neighbor list.
+
+    Used when the neighbor list is maintained by the caller, for
+    example when atoms are moved or removed. The neighbor list has to
+    be created with the radii of the workspace plus the probe radius.
+
+    @param ws The workspace.
+    @param sasa Results, only the values of the listed atoms are
+    written.
+    @param xyz Coordinates of all atoms.
+    @param nb Neighbor list for xyz.
+    @param atoms Indices of the atoms to calculate, NULL for all.
+    @param n Number of atoms in the list.
+    @return ::FREESASA_SUCCESS.
+ */
+int freesasa_sr_workspace_calc_atoms(sr_workspace *ws,
+                                     double *sasa,
+                                     const coord_t *xyz,
+                                     const nb_list *nb,
+                                     const int *atoms,
+                                     int n);
+
+/**
+    Free S&R workspace.
+
+    @param ws The workspace.
+ */
+void freesasa_sr_workspace_free(sr_workspace *ws);
+
+/**
+    Prepare repeated L&R calculations for a set of atoms.
+
+    Same as freesasa_sr_workspace_new(), but for L&R.
+
+    @param radii Array of radii for each sphere.
+    @param n_atoms Number of spheres, > 0.
+    @param param Parameters specifying resolution, probe radius and
+    number of threads. If NULL :.freesasa_default_parameters is used.
+    @return The workspace. NULL if parameters are invalid or if
+    memory allocation fails.
+ */
+lr_workspace *
+freesasa_lr_workspace_new(const double *radii,
+                          int n_atoms,
+                          const freesasa_parameters *param);
+
+/**
+    Calculate SASA using L&R algorithm, with a workspace.
+
+    @param ws The workspace.
+    @param sasa The results are written to this array, the user has to
+    make sure it is large enough.
+    @param c Coordinates, the number has to be the same as when the
+    workspace was created.
+    @return ::FREESASA_SUCCESS on success, ::FREESASA_FAIL if memory
+    allocation failure.
+ */
+int freesasa_lr_workspace_calc(lr_workspace *ws,
+                               double *sasa,
+                               const coord_t *c);
+
+/**
+    Calculate L&R SASA of some atoms with a given neighbor list.
+
+    Same as freesasa_sr_workspace_calc_atoms(), but for L&R.
+
+    @param ws The workspace.
+    @param sasa Results, only the values of the listed atoms are
+    written.
+    @param xyz Coordinates of all atoms.
+    @param nb Neighbor list for xyz.
+    @param atoms Indices of the atoms to calculate, NULL for all.
+    @param n Number of atoms in the list.
+    @return ::FREESASA_SUCCESS on success, ::FREESASA_FAIL if memory
+    allocation failure.
+ */
+int freesasa_lr_workspace_calc_atoms(lr_workspace *ws,
+                                     double *sasa,
+                                     const coord_t *xyz,
+                                     const nb_list *nb,
+                                     const int *atoms,
+                                     int n);
+
+/**
+    Free L&R workspace.
+
+    @param ws The workspace.
+ */
+void freesasa_lr_workspace_free(lr_workspace *ws);
+
 /**
     Calculate SASA based on a coordinate object, radii and parameters
 
@@ -160,6 +292,50 @@ int freesasa_write_rsa(FILE *output,
 int freesasa_write_json(FILE *ouput,
                         freesasa_node *root,
                         int options);
+
+/**
+    A JSON document that results are added to one tree at a time, for
+    output that is written while later results are calculated.
+ */
+typedef struct freesasa_json_stream freesasa_json_stream;
+
+/**
+    Starts a JSON document, with the same layout as
+    freesasa_write_json().
+
+    Not thread-safe.
+
+    @param output Output-file.
+    @param options As for freesasa_write_json(), used for all trees
+      added to the document.
+    @return The document, or NULL if memory allocation failed. It is
+      freed by freesasa_json_stream_close().
+ */
+freesasa_json_stream *
+freesasa_json_stream_open(FILE *output,
+                          int options);
+
+/**
+    Adds the results of a tree to a JSON document, and flushes the
+    output.
+
+    @param stream The document.
+    @param root A tree with stored results.
+    @return ::FREESASA_SUCCESS on success, ::FREESASA_FAIL if problems
+      writing to file.
+ */
+int freesasa_json_stream_add(freesasa_json_stream *stream,
+                             freesasa_node *root);
+
+/**
+    Ends a JSON document and frees it.
+
+    @param stream The document.
+    @return ::FREESASA_SUCCESS on success, ::FREESASA_FAIL if problems
+      writing to file.
+ */
+int freesasa_json_stream_close(freesasa_json_stream *stream);
+
 /**
     Export to XML
 
@@ -180,6 +356,48 @@ int freesasa_write_xml(FILE *ouput,
                        freesasa_node *root,
                        int options);
 
+/**
+    An XML document that results are added to one tree at a time, see
+    ::freesasa_json_stream.
+ */
+typedef struct freesasa_xml_stream freesasa_xml_stream;
+
+/**
+    Starts an XML document, with the same layout as
+    freesasa_write_xml().
+
+    @param output Output-file.
+    @param options As for freesasa_write_xml(), used for all trees
+      added to the document.
+    @return The document, or NULL if it could not be started. It is
+      freed by freesasa_xml_stream_close().
+ */
+freesasa_xml_stream *
+freesasa_xml_stream_open(FILE *output,
+                         int options);
+
+/**
+    Adds the results of a tree to an XML document, and flushes the
+    output.
+
+    @param stream The document.
+    @param root A tree with stored results.
+    @return ::FREESASA_SUCCESS on success, ::FREESASA_FAIL if problems
+      writing to file.
+ */
+int freesasa_xml_stream_add(freesasa_xml_stream *stream,
+                            freesasa_node *root);
+
+/**
+    Ends an XML document and frees it.
+
+    @param stream The document.
+    @return ::FREESASA_SUCCESS on success, ::FREESASA_FAIL if problems
+      writing to file.
+ */
+int freesasa_xml_stream_close(freesasa_xml_stream *stream);
+
+
 /**
     Write SASA values and atomic radii to new PDB-file.
 
@@ -200,6 +418,22 @@ int freesasa_write_xml(FILE *ouput,
 int freesasa_write_pdb(FILE *output,
                        freesasa_node *structure);
 
+/**
+    Export to the binary format read by freesasa_result_map()
+
+    @param output Output-file, should be opened in binary mode.
+    @param root A tree with stored results, created down to the atom
+      level.
+    @param options Bitfield, if ::FREESASA_BIN_FLOAT is set the areas
+      and radii of atoms, residues and chains are stored as `float`,
+      otherwise as `double`.
+    @return ::FREESASA_SUCCESS on success, ::FREESASA_FAIL if the
+      tree has no atom data or if there were problems writing to file.
+ */
+int freesasa_write_bin(FILE *output,
+                       freesasa_node *root,
+                       int options);
+
 /**
     Write per-residue-type output
  */
@@ -218,6 +452,37 @@ int freesasa_write_seq(FILE *log,
 int freesasa_write_log(FILE *log,
                        freesasa_node *root);
 
+/**
+    Write the parameters section of the log message.
+
+    @param parameters The parameters, defaults are used if NULL.
+ */
+int freesasa_write_log_parameters(FILE *log,
+                                  const freesasa_parameters *parameters);
+
+/**
+    Write the results of the log message, without the parameters, so
+    that the results of several trees can be written one at a time.
+
+    @param separate If each result should be preceded by a separator,
+      as when a log message has more than one result.
+ */
+int freesasa_write_log_results(FILE *log,
+                               freesasa_node *root,
+                               int separate);
+
+/**
+    Write the results of a residue scan, one line per residue.
+
+    @param scan The results.
+    @param structure The structure that was scanned.
+    @param name Name of the input, or NULL.
+ */
+int freesasa_write_scan(FILE *log,
+                        const freesasa_scan_result *scan,
+                        const freesasa_structure *structure,
+                        const char *name);
+
 /**
     Clone results object
 */
@@ -275,6 +540,17 @@ freesasa_structure_residue_reference(const freesasa_structure *structure,
 int freesasa_structure_chain_index(const freesasa_structure *structure,
                                    char chain);
 
+/**
+    Release the classification memo of a structure.
+
+    Structures classify atoms through a memo while they are being
+    built, readers call this when all atoms have been added. The memo
+    is recreated if more atoms are added later.
+
+    @param structure A structure.
+ */
+void freesasa_structure_release_memo(freesasa_structure *structure);
+
 /**
     Extract area to provided ::freesasa_nodearea object
 
@@ -311,6 +587,48 @@ void freesasa_range_nodearea(freesasa_nodearea *area,
                              int first_atom,
                              int last_atom);
 
+/**
+    Index of the first atom of a residue in the structure (and in the
+    `sasa` array of its result).
+
+    @param node A node of type ::FREESASA_NODE_RESIDUE.
+    @return The index.
+ */
+int freesasa_node_residue_first_atom(const freesasa_node *node);
+
+/**
+    Properties of an atom in a structure node, read without creating
+    the atom nodes.
+
+    @param node A node of type ::FREESASA_NODE_STRUCTURE.
+    @param i Index of the atom.
+    @param name The atom name is stored here.
+    @param radius The atom radius is stored here.
+    @param the_class The class of the atom is stored here.
+    @param is_bb Set to 1 if the atom is in the main chain, 0 else.
+    @return ::FREESASA_SUCCESS. ::FREESASA_FAIL if the tree was created
+      without atoms.
+ */
+int freesasa_node_structure_atom(const freesasa_node *node,
+                                 int i,
+                                 const char **name,
+                                 double *radius,
+                                 freesasa_atom_class *the_class,
+                                 int *is_bb);
+
+/**
+    The PDB line of an atom in a structure node, read without creating
+    the atom nodes.
+
+    @param node A node of type ::FREESASA_NODE_STRUCTURE.
+    @param i Index of the atom.
+    @return The line. `NULL` if the structure was not read from a PDB
+      file or the tree was created without atoms.
+ */
+const char *
+freesasa_node_structure_atom_pdb_line(const freesasa_node *node,
+                                      int i);
+
 /**
     Calculate relative SASA values for a residue
 
@@ -352,6 +670,69 @@ struct file_range {
 struct file_range
 freesasa_whole_file(FILE *file);
 
+/**
+    Get the contents of a file, memory-mapped if possible.
+
+    The file is only mapped if it is a regular file and the current
+    position is at its beginning, otherwise the rest of the file is
+    read into memory.
+
+    @param input The file.
+    @param data The contents are stored here.
+    @param size The size of the contents is stored here.
+    @return 1 if the file was mapped, 0 if it was read into memory
+      and ::FREESASA_FAIL if reading failed.
+ */
+int freesasa_file_map(FILE *input,
+                      void **data,
+                      size_t *size);
+
+/**
+    Release file contents from freesasa_file_map().
+
+    @param data The contents.
+    @param size The size of the contents.
+    @param mapped The return value of freesasa_file_map().
+ */
+void freesasa_file_unmap(void *data,
+                         size_t size,
+                         int mapped);
+
+/**
+    Check if a file is gzip compressed, without consuming any input.
+
+    @param input The file.
+    @return 1 if the file starts like a gzip file, 0 else.
+ */
+int freesasa_is_gzip(FILE *input);
+
+/**
+    Decompress the rest of a gzip file to a temporary file.
+
+    The temporary file can be used with the functions that need to
+    seek, such as freesasa_structure_array(). It is deleted when
+    closed.
+
+    @param input The compressed file.
+    @return The decompressed file, positioned at its beginning. NULL
+      if the input is not valid gzip, or if FreeSASA was built without
+      zlib.
+ */
+FILE *
+freesasa_gunzip(FILE *input);
+
+/**
+    Compress the rest of a file to gzip format.
+
+    @param input The file to compress.
+    @param output The compressed output is written here.
+    @return ::FREESASA_SUCCESS on success, ::FREESASA_FAIL if there
+      were problems reading or writing, or if FreeSASA was built
+      without zlib.
+ */
+int freesasa_gzip(FILE *input,
+                  FILE *output);
+
 /**
     Algorithm name
 
@@ -361,6 +742,51 @@ freesasa_whole_file(FILE *file);
 const char *
 freesasa_alg_name(freesasa_algorithm algorithm);
 
+/** Buffer size that fits all fixed-precision numbers in the output */
+#define FREESASA_FIXED_BUFSIZE 32
+
+/**
+    Formats a double with fixed precision.
+
+    Gives the same result as `snprintf(buf, size, "%*.*f", width,
+    precision, value)`, but without parsing a format string and
+    without going through the general conversion in the C library
+    for the common case of moderately sized values and precision up
+    to 9 decimals. Used for all areas and radii written by the output
+    functions.
+
+    @param buf Output buffer
+    @param size Size of output buffer
+    @param value The value
+    @param width Minimum field width, padded with spaces on the left
+    @param precision Number of decimals
+    @return Number of characters written (excluding terminating
+      null), or that would have been written if `buf` had been large
+      enough, as for snprintf().
+ */
+int freesasa_format_fixed(char *buf,
+                          size_t size,
+                          double value,
+                          int width,
+                          int precision);
+
+/**
+    Writes a double with fixed precision to a file.
+
+    Equivalent to `fprintf(output, "%*.*f", width, precision, value)`,
+    see freesasa_format_fixed().
+
+    @param output Output file
+    @param value The value
+    @param width Minimum field width
+    @param precision Number of decimals
+    @return Number of characters written, negative on error.
+ */
+int freesasa_fput_fixed(FILE *output,
+                        double value,
+                        int width,
+                        int precision);
+
 /**
     Print failure message using format string and arguments.
 
@@ -402,6 +828,58 @@ int freesasa_mem_fail(const char *file,
 const char *
 freesasa_thread_error(int error_code);
 
+/**
+    Threads that are kept between calculations.
+
+    The threads wait for work between calls to
+    freesasa_thread_pool_run(), so that repeated calculations don't
+    pay for creating new threads each time.
+ */
+typedef struct freesasa_thread_pool freesasa_thread_pool;
+
+/**
+    Create a thread pool.
+
+    The calling thread is used as one of the threads, i.e. n_threads -
+    1 threads are created. If compiled without thread support a pool
+    with a single thread is returned.
+
+    @param n_threads Number of threads, > 0.
+    @return The pool, NULL if threads or memory could not be
+      allocated.
+ */
+freesasa_thread_pool *
+freesasa_thread_pool_new(int n_threads);
+
+/**
+    Number of threads of a pool (including the calling thread).
+
+    @param pool The pool
+    @return Number of threads.
+ */
+int freesasa_thread_pool_n(const freesasa_thread_pool *pool);
+
+/**
+    Call a function once in each thread of a pool, and wait for all
+    calls to return.
+
+    @param pool The pool
+    @param work The function, called with arg and the index of the
+      thread, from 0 to freesasa_thread_pool_n() - 1. Index 0 is the
+      calling thread.
+    @param arg Argument to pass to work.
+ */
+void freesasa_thread_pool_run(freesasa_thread_pool *pool,
+                              void (*work)(void *arg, int thread_index),
+                              void *arg);
+
+/**
+    Stop the threads of a pool and free it.
+
+    @param pool The pool
+ */
+void freesasa_thread_pool_free(freesasa_thread_pool *pool);
+
 /**
     Prints fail message with function name, file name, and line number.
 
@@ -3,6 +3,7 @@
 #endif
 
 #include <assert.h>
+#include <ctype.h>
 #include <errno.h>
 #include <json-c/json_object.h>
 #include <math.h>
@@ -182,6 +183,9 @@ freesasa_node2json(freesasa_node *node,
         if (!lowest) {
             array = json_object_new_array();
         }
+    } else if (type != FREESASA_NODE_ATOM) {
+        // tree was created without the lower levels
+        lowest = 1;
     }
 
     switch (type) {
@@ -217,70 +221,395 @@ freesasa_node2json(freesasa_node *node,
     return obj;
 }
 
-static json_object *
-parameters2json(const freesasa_parameters *p)
+/* Streaming writer. The output has the same layout as
+   json_object_to_json_string_ext() with JSON_C_TO_STRING_PRETTY would
+   give for the corresponding json_object tree, but is written while
+   traversing the result tree, without building the tree first. */
+
+#define JSON_MAX_DEPTH 16
+
+struct json_writer {
+    FILE *output;
+    int depth;
+    int has_members[JSON_MAX_DEPTH];
+};
+
+static void
+json_write_escaped(FILE *output, const char *str)
 {
-    json_object *obj = json_object_new_object(), *res;
+    const unsigned char *c;
+
+    fputc('"', output);
+    for (c = (const unsigned char *)str; *c; ++c) {
+        switch (*c) {
+        case '"':
+            fputs("\\\"", output);
+            break;
+        case '\\':
+            fputs("\\\\", output);
+            break;
+        case '/':
+            fputs("\\/", output);
+            break;
+        case '\b':
+            fputs("\\b", output);
+            break;
+        case '\f':
+            fputs("\\f", output);
+            break;
+        case '\n':
+            fputs("\\n", output);
+            break;
+        case '\r':
+            fputs("\\r", output);
+            break;
+        case '\t':
+            fputs("\\t", output);
+            break;
+        default:
+            if (*c < 0x20)
+                fprintf(output, "\\u%04x", *c);
+            else
+                fputc(*c, output);
+        }
+    }
+    fputc('"', output);
+}
 
-    json_object_object_add(obj, "algorithm", json_object_new_string(freesasa_alg_name(p->alg)));
-    json_object_object_add(obj, "probe-radius", json_object_new_double(p->probe_radius));
+/* Starts a member of the current object (or element of the current
+   array if key is NULL) */
+static void
+json_member(struct json_writer *w,
+            const char *key)
+{
+    if (w->depth > 0) {
+        if (w->has_members[w->depth]) fputs(",\n", w->output);
+        w->has_members[w->depth] = 1;
+        fprintf(w->output, "%*s", 2 * w->depth, "");
+    }
+    if (key != NULL) {
+        json_write_escaped(w->output, key);
+        fputc(':', w->output);
+    }
+}
 
-    switch (p->alg) {
-    case FREESASA_SHRAKE_RUPLEY:
-        res = json_object_new_int(p->shrake_rupley_n_points);
+static void
+json_begin(struct json_writer *w,
+           const char *key,
+           char bracket)
+{
+    assert(w->depth < JSON_MAX_DEPTH - 1);
+    json_member(w, key);
+    fprintf(w->output, "%c\n", bracket);
+    w->has_members[++w->depth] = 0;
+}
+
+static void
+json_end(struct json_writer *w,
+         char bracket)
+{
+    assert(w->depth > 0);
+    if (w->has_members[w->depth]) fputc('\n', w->output);
+    --w->depth;
+    fprintf(w->output, "%*s%c", 2 * w->depth, "", bracket);
+}
+
+static void
+json_string(struct json_writer *w,
+            const char *key,
+            const char *value)
+{
+    json_member(w, key);
+    json_write_escaped(w->output, value);
+}
+
+static void
+json_int(struct json_writer *w,
+         const char *key,
+         int value)
+{
+    json_member(w, key);
+    fprintf(w->output, "%d", value);
+}
+
+static void
+json_boolean(struct json_writer *w,
+             const char *key,
+             int value)
+{
+    json_member(w, key);
+    fputs(value ? "true" : "false", w->output);
+}
+
+static void
+json_double(struct json_writer *w,
+            const char *key,
+            double value)
+{
+    char buf[32];
+
+    json_member(w, key);
+
+    if (isnan(value)) {
+        fputs("NaN", w->output);
+    } else if (isinf(value)) {
+        fputs(value > 0 ? "Infinity" : "-Infinity", w->output);
+    } else {
+        snprintf(buf, sizeof buf, "%.17g", value);
+        fputs(buf, w->output);
+        // make sure the number is read back as a double
+        if (strpbrk(buf, ".e") == NULL) fputs(".0", w->output);
+    }
+}
+
+/* Writes a word without surrounding whitespace, such as atom names
+   and residue numbers */
+static void
+json_trimmed_string(struct json_writer *w,
+                    const char *key,
+                    const char *value)
+{
+    size_t len;
+
+    while (isspace((unsigned char)*value))
+        ++value;
+    for (len = 0; value[len] != '\0' && !isspace((unsigned char)value[len]); ++len)
+        ;
+
+    json_member(w, key);
+    fprintf(w->output, "\"%.*s\"", (int)len, value);
+}
+
+static void
+json_write_nodearea(struct json_writer *w,
+                    const char *key,
+                    const freesasa_nodearea *area)
+{
+    json_begin(w, key, '{');
+    if (isfinite(area->total)) json_double(w, "total", area->total);
+    if (isfinite(area->polar)) json_double(w, "polar", area->polar);
+    if (isfinite(area->apolar)) json_double(w, "apolar", area->apolar);
+    if (isfinite(area->main_chain)) json_double(w, "main-chain", area->main_chain);
+    if (isfinite(area->side_chain)) json_double(w, "side-chain", area->side_chain);
+    json_end(w, '}');
+}
+
+/* The atoms are read from the atom records of the structure node,
+   the atom nodes are never created, to keep memory use independent
+   of the size of the tree. */
+static void
+json_write_atoms(struct json_writer *w,
+                 freesasa_node *residue)
+{
+    freesasa_node *structure = freesasa_node_parent(freesasa_node_parent(residue));
+    const freesasa_result *result = freesasa_node_structure_result(structure);
+    const char *name;
+    double radius;
+    freesasa_atom_class the_class;
+    int i, is_bb, first = freesasa_node_residue_first_atom(residue),
+                  n = freesasa_node_residue_n_atoms(residue);
+
+    // tree was created without atoms
+    if (freesasa_node_structure_atom(structure, first, &name, &radius, &the_class, &is_bb)) {
+        return;
+    }
+
+    json_begin(w, "atoms", '[');
+    for (i = first; i < first + n; ++i) {
+        freesasa_node_structure_atom(structure, i, &name, &radius, &the_class, &is_bb);
+        json_begin(w, NULL, '{');
+        json_trimmed_string(w, "name", name);
+        json_double(w, "area", result->sasa[i]);
+        json_boolean(w, "is-polar", the_class == FREESASA_ATOM_POLAR);
+        json_boolean(w, "is-main-chain", is_bb);
+        json_double(w, "radius", radius);
+        json_end(w, '}');
+    }
+    json_end(w, ']');
+}
+
+static void
+json_write_node(struct json_writer *w,
+                freesasa_node *node,
+                int exclude_type,
+                int options);
+
+static void
+json_write_children(struct json_writer *w,
+                    const char *key,
+                    freesasa_node *child,
+                    int exclude_type,
+                    int options)
+{
+    json_begin(w, key, '[');
+    while (child) {
+        json_write_node(w, child, exclude_type, options);
+        child = freesasa_node_next(child);
+    }
+    json_end(w, ']');
+}
+
+static void
+json_write_node(struct json_writer *w,
+                freesasa_node *node,
+                int exclude_type,
+                int options)
+{
+    const freesasa_selection **selection;
+    const freesasa_nodearea *reference;
+    freesasa_nodearea rel;
+    freesasa_node *child = NULL;
+    int type = freesasa_node_type(node);
+
+    // children are one level further down in the hierarchy
+    if (type != FREESASA_NODE_RESIDUE && type - 1 != exclude_type) {
+        child = freesasa_node_children(node);
+    }
+
+    switch (type) {
+    case FREESASA_NODE_STRUCTURE:
+        json_begin(w, NULL, '{');
+        // the chain array takes the place of the chain labels
+        if (child)
+            json_write_children(w, "chains", child, exclude_type, options);
+        else
+            json_string(w, "chains", freesasa_node_structure_chain_labels(node));
+        json_int(w, "model", freesasa_node_structure_model(node));
+        json_write_nodearea(w, "area", freesasa_node_area(node));
+        selection = freesasa_node_structure_selections(node);
+        if (selection != NULL) {
+            json_begin(w, "selections", '[');
+            for (; *selection; ++selection) {
+                json_begin(w, NULL, '{');
+                json_string(w, "name", freesasa_selection_name(*selection));
+                json_double(w, "area", freesasa_selection_area(*selection));
+                json_end(w, '}');
+            }
+            json_end(w, ']');
+        }
+        json_end(w, '}');
         break;
-    case FREESASA_LEE_RICHARDS:
-        res = json_object_new_int(p->lee_richards_n_slices);
+    case FREESASA_NODE_CHAIN:
+        json_begin(w, NULL, '{');
+        json_string(w, "label", freesasa_node_name(node));
+        json_int(w, "n-residues", freesasa_node_chain_n_residues(node));
+        json_write_nodearea(w, "area", freesasa_node_area(node));
+        if (child) json_write_children(w, "residues", child, exclude_type, options);
+        json_end(w, '}');
         break;
-    default:
-        assert(0);
+    case FREESASA_NODE_RESIDUE:
+        json_begin(w, NULL, '{');
+        json_string(w, "name", freesasa_node_name(node));
+        json_trimmed_string(w, "number", freesasa_node_residue_number(node));
+        json_write_nodearea(w, "area", freesasa_node_area(node));
+        reference = freesasa_node_residue_reference(node);
+        if ((reference != NULL) && !(options & FREESASA_OUTPUT_SKIP_REL)) {
+            freesasa_residue_rel_nodearea(&rel, freesasa_node_area(node), reference);
+            json_write_nodearea(w, "relative-area", &rel);
+        }
+        json_int(w, "n-atoms", freesasa_node_residue_n_atoms(node));
+        if (exclude_type != FREESASA_NODE_ATOM) json_write_atoms(w, node);
+        json_end(w, '}');
         break;
+    case FREESASA_NODE_RESULT:
+    case FREESASA_NODE_ROOT:
+    default:
+        assert(0 && "Tree illegal");
     }
-    json_object_object_add(obj, "resolution", res);
-
-    return obj;
 }
 
-static json_object *
-json_result(freesasa_node *result,
-            int options)
+static void
+json_write_result(struct json_writer *w,
+                  freesasa_node *result,
+                  int options)
 {
-    json_object *obj = json_object_new_object();
     freesasa_nodetype exclude_type = FREESASA_NODE_NONE;
-    const freesasa_parameters *parameters = freesasa_node_result_parameters(result);
+    const freesasa_parameters *p = freesasa_node_result_parameters(result);
+
     if (options & FREESASA_OUTPUT_STRUCTURE) exclude_type = FREESASA_NODE_CHAIN;
     if (options & FREESASA_OUTPUT_CHAIN) exclude_type = FREESASA_NODE_RESIDUE;
     if (options & FREESASA_OUTPUT_RESIDUE) exclude_type = FREESASA_NODE_ATOM;
 
-    json_object_object_add(obj, "input", json_object_new_string(freesasa_node_name(result)));
-    json_object_object_add(obj, "classifier", json_object_new_string(freesasa_node_classified_by(result)));
-    json_object_object_add(obj, "parameters", parameters2json(parameters));
-    json_object_object_add(obj, "structure", freesasa_node2json(result, exclude_type, options));
+    json_begin(w, NULL, '{');
+    json_string(w, "input", freesasa_node_name(result));
+    json_string(w, "classifier", freesasa_node_classified_by(result));
 
-    return obj;
+    json_begin(w, "parameters", '{');
+    json_string(w, "algorithm", freesasa_alg_name(p->alg));
+    json_double(w, "probe-radius", p->probe_radius);
+    switch (p->alg) {
+    case FREESASA_SHRAKE_RUPLEY:
+        json_int(w, "resolution", p->shrake_rupley_n_points);
+        break;
+    case FREESASA_LEE_RICHARDS:
+        json_int(w, "resolution", p->lee_richards_n_slices);
+        break;
+    default:
+        assert(0);
+        break;
+    }
+    json_end(w, '}');
+
+    json_write_children(w, "structure", freesasa_node_children(result),
+                        exclude_type, options);
+    json_end(w, '}');
 }
 
-int freesasa_write_json(FILE *output,
-                        freesasa_node *root,
-                        int options)
+struct freesasa_json_stream {
+    struct json_writer w;
+    int options;
+};
 
+freesasa_json_stream *
+freesasa_json_stream_open(FILE *output,
+                          int options)
 {
-    assert(freesasa_node_type(root) == FREESASA_NODE_ROOT);
+    freesasa_json_stream *stream = malloc(sizeof(freesasa_json_stream));
 
-    json_object *results = json_object_new_array(),
-                *json_root = json_object_new_object();
+    if (stream == NULL) {
+        mem_fail();
+        return NULL;
+    }
+
+    stream->w.output = output;
+    stream->w.depth = 0;
+    stream->w.has_members[0] = 0;
+    stream->options = options;
+
+    json_begin(&stream->w, NULL, '{');
+    json_string(&stream->w, "source", freesasa_string);
+    json_string(&stream->w, "length-unit", "Ångström");
+    json_begin(&stream->w, "results", '[');
+
+    return stream;
+}
+
+int freesasa_json_stream_add(freesasa_json_stream *stream,
+                             freesasa_node *root)
+{
     freesasa_node *child = freesasa_node_children(root);
 
-    json_object_object_add(json_root, "source", json_object_new_string(freesasa_string));
-    json_object_object_add(json_root, "length-unit", json_object_new_string("Ångström"));
-    json_object_object_add(json_root, "results", results);
+    assert(freesasa_node_type(root) == FREESASA_NODE_ROOT);
+
     while (child) {
-        json_object_array_add(results, json_result(child, options));
+        json_write_result(&stream->w, child, stream->options);
         child = freesasa_node_next(child);
     }
 
-    fputs(json_object_to_json_string_ext(json_root, JSON_C_TO_STRING_PRETTY), output);
-    json_object_put(json_root);
+    fflush(stream->w.output);
+    if (ferror(stream->w.output)) {
+        return fail_msg(strerror(errno));
+    }
+    return FREESASA_SUCCESS;
+}
+
+int freesasa_json_stream_close(freesasa_json_stream *stream)
+{
+    FILE *output = stream->w.output;
+
+    json_end(&stream->w, ']');
+    json_end(&stream->w, '}');
+    free(stream);
 
     fflush(output);
     if (ferror(output)) {
@@ -288,3 +617,18 @@ int freesasa_write_json(FILE *output,
     }
     return FREESASA_SUCCESS;
 }
+
+int freesasa_write_json(FILE *output,
+                        freesasa_node *root,
+                        int options)
+{
+    freesasa_json_stream *stream = freesasa_json_stream_open(output, options);
+    int ret;
+
+    if (stream == NULL) return fail_msg("");
+
+    ret = freesasa_json_stream_add(stream, root);
+    if (freesasa_json_stream_close(stream) == FREESASA_FAIL) ret = FREESASA_FAIL;
+
+    return ret;
+}
@@ -370,7 +370,7 @@ static yyconst YY_CHAR yy_ec[256] =
         1,    1,    2,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    2,    3,    1,    1,    1,    1,    4,    5,    6,
-        7,    1,    8,    9,   10,    1,    1,   11,   11,   11,
+        7,    1,    8,    9,   10,   11,    1,   11,   11,   11,
        11,   11,   11,   11,   11,   11,   11,    1,    1,    1,
         1,    1,    1,    1,   12,   13,   14,   15,   16,   17,
        17,   18,   19,   17,   17,   20,   21,   22,   23,   17,
@@ -520,9 +520,10 @@ static yyconst flex_int16_t yy_chk[326] =
 #include "freesasa_internal.h"
 
 #include <stdio.h>
+#include <strings.h>
 
 #define YY_NO_UNISTD_H 1
-#line 526 "lexer.c"
+#line 527 "lexer.c"
 
 #define INITIAL 0
 
@@ -789,10 +790,10 @@ YY_DECL
 		}
 
 	{
-#line 32 "lexer.l"
+#line 33 "lexer.l"
 
 
-#line 796 "lexer.c"
+#line 797 "lexer.c"
 
 	while ( /*CONSTCOND*/1 )		/* loops until end-of-file is reached */
 		{
@@ -847,104 +848,108 @@ do_action:	/* This label is used only to access EOF actions. */
 
 case 1:
 YY_RULE_SETUP
-#line 34 "lexer.l"
+#line 35 "lexer.l"
 { return ','; }
 	YY_BREAK
 case 2:
 YY_RULE_SETUP
-#line 35 "lexer.l"
+#line 36 "lexer.l"
 { return '-'; }
 	YY_BREAK
 case 3:
 YY_RULE_SETUP
-#line 36 "lexer.l"
+#line 37 "lexer.l"
 { return '+'; }
 	YY_BREAK
 case 4:
 YY_RULE_SETUP
-#line 37 "lexer.l"
+#line 38 "lexer.l"
 { return '('; }
 	YY_BREAK
 case 5:
 YY_RULE_SETUP
-#line 38 "lexer.l"
+#line 39 "lexer.l"
 { return ')'; }
 	YY_BREAK
 case 6:
 YY_RULE_SETUP
-#line 40 "lexer.l"
+#line 41 "lexer.l"
 { return T_RESN; }
 	YY_BREAK
 case 7:
 YY_RULE_SETUP
-#line 41 "lexer.l"
+#line 42 "lexer.l"
 { return T_RESI; }
 	YY_BREAK
 case 8:
 YY_RULE_SETUP
-#line 42 "lexer.l"
+#line 43 "lexer.l"
 { return T_SYMBOL; }
 	YY_BREAK
 case 9:
 YY_RULE_SETUP
-#line 43 "lexer.l"
+#line 44 "lexer.l"
 { return T_NAME; }
 	YY_BREAK
 case 10:
 YY_RULE_SETUP
-#line 44 "lexer.l"
+#line 45 "lexer.l"
 { return T_CHAIN; }
 	YY_BREAK
 case 11:
 YY_RULE_SETUP
-#line 46 "lexer.l"
+#line 47 "lexer.l"
 { return T_AND; }
 	YY_BREAK
 case 12:
 YY_RULE_SETUP
-#line 47 "lexer.l"
+#line 48 "lexer.l"
 { return T_OR; }
 	YY_BREAK
 case 13:
 YY_RULE_SETUP
-#line 48 "lexer.l"
+#line 49 "lexer.l"
 { return T_NOT; }
 	YY_BREAK
 case 14:
 YY_RULE_SETUP
-#line 49 "lexer.l"
+#line 50 "lexer.l"
 { return T_MINUS; }
 	YY_BREAK
 case 15:
 /* rule 15 can match eol */
 YY_RULE_SETUP
-#line 51 "lexer.l"
+#line 52 "lexer.l"
 {}
 	YY_BREAK
 case 16:
 YY_RULE_SETUP
-#line 52 "lexer.l"
+#line 53 "lexer.l"
 { yylval->value = strdup(yytext); return T_NUMBER; }
 	YY_BREAK
 case 17:
 YY_RULE_SETUP
-#line 53 "lexer.l"
-{ yylval->value = strdup(yytext); return T_ID; }
+#line 54 "lexer.l"
+{ /* keywords of spatial selections */
+                if (strcasecmp(yytext, "within") == 0) return T_WITHIN;
+                if (strcasecmp(yytext, "around") == 0) return T_AROUND;
+                if (strcasecmp(yytext, "of") == 0) return T_OF;
+                yylval->value = strdup(yytext); return T_ID; }
 	YY_BREAK
 case 18:
 *yy_cp = yyg->yy_hold_char; /* undo effects of setting up yytext */
 yyg->yy_c_buf_p = yy_cp -= 1;
 YY_DO_BEFORE_ACTION; /* set up yytext again */
 YY_RULE_SETUP
-#line 54 "lexer.l"
+#line 59 "lexer.l"
 { yylval->value = strdup(yytext); return T_SELID; }
 	YY_BREAK
 case 19:
 YY_RULE_SETUP
-#line 55 "lexer.l"
+#line 60 "lexer.l"
 ECHO;
 	YY_BREAK
-#line 948 "lexer.c"
+#line 953 "lexer.c"
 case YY_STATE_EOF(INITIAL):
 	yyterminate();
 
@@ -2126,4 +2131,4 @@ void freesasa_yyfree (void * ptr , yyscan_t yyscanner)
 
 #define YYTABLES_NAME "yytables"
 
-#line 55 "lexer.l"
+#line 60 "lexer.l"
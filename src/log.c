@@ -109,9 +109,8 @@ write_selections(FILE *log,
     return FREESASA_SUCCESS;
 }
 
-static int
-write_parameters(FILE *log,
-                 const freesasa_parameters *parameters)
+int freesasa_write_log_parameters(FILE *log,
+                                  const freesasa_parameters *parameters)
 {
     const freesasa_parameters *p = parameters;
 
@@ -222,11 +221,12 @@ int freesasa_write_seq(FILE *log,
                 residue = freesasa_node_children(chain);
                 while (residue) {
                     assert(freesasa_node_type(residue) == FREESASA_NODE_RESIDUE);
-                    fprintf(log, "SEQ %s %s %s : %7.2f\n",
+                    fprintf(log, "SEQ %s %s %s : ",
                             freesasa_node_name(chain),
                             freesasa_node_residue_number(residue),
-                            freesasa_node_name(residue),
-                            freesasa_node_area(residue)->total);
+                            freesasa_node_name(residue));
+                    freesasa_fput_fixed(log, freesasa_node_area(residue)->total, 7, 2);
+                    fputc('\n', log);
                     residue = freesasa_node_next(residue);
                 }
                 chain = freesasa_node_next(chain);
@@ -245,21 +245,18 @@ int freesasa_write_seq(FILE *log,
     return FREESASA_SUCCESS;
 }
 
-int freesasa_write_log(FILE *log,
-                       freesasa_node *root)
+int freesasa_write_log_results(FILE *log,
+                               freesasa_node *root,
+                               int separate)
 {
     freesasa_node *result = freesasa_node_children(root);
-    int several = (freesasa_node_next(result) != NULL); /* are there more than one result */
     int err = 0;
 
     assert(log);
     assert(freesasa_node_type(root) == FREESASA_NODE_ROOT);
 
-    if (write_parameters(log, freesasa_node_result_parameters(result)) == FREESASA_FAIL)
-        ++err;
-
     while (result) {
-        if (several) fprintf(log, "\n\n####################\n");
+        if (separate) fprintf(log, "\n\n####################\n");
         if (write_result(log, result) == FREESASA_FAIL) ++err;
         if (write_selections(log, result) == FREESASA_FAIL) ++err;
         result = freesasa_node_next(result);
@@ -268,3 +265,65 @@ int freesasa_write_log(FILE *log,
 
     return FREESASA_SUCCESS;
 }
+
+int freesasa_write_log(FILE *log,
+                       freesasa_node *root)
+{
+    freesasa_node *result = freesasa_node_children(root);
+    int several = (freesasa_node_next(result) != NULL); /* are there more than one result */
+    int err = 0;
+
+    assert(log);
+    assert(freesasa_node_type(root) == FREESASA_NODE_ROOT);
+
+    if (freesasa_write_log_parameters(log, freesasa_node_result_parameters(result)) == FREESASA_FAIL)
+        ++err;
+    if (freesasa_write_log_results(log, root, several) == FREESASA_FAIL)
+        ++err;
+    if (err) return FREESASA_FAIL;
+
+    return FREESASA_SUCCESS;
+}
+
+int freesasa_write_scan(FILE *log,
+                        const freesasa_scan_result *scan,
+                        const freesasa_structure *structure,
+                        const char *name)
+{
+    const freesasa_scan_residue *res;
+    int r;
+
+    assert(log);
+    assert(scan);
+    assert(structure);
+    assert(scan->n_residues == freesasa_structure_n_residues(structure));
+
+    fprintf(log, "# Residue scan (%s) of %s\n",
+            scan->type == FREESASA_SCAN_ALANINE ? "alanine" : "delete",
+            name ? name : "unknown");
+    fprintf(log, "# Total SASA of wild type : ");
+    freesasa_fput_fixed(log, scan->total, 10, 2);
+    fprintf(log, "\n# Residue        : atoms  removed  exposed    delta\n");
+    for (r = 0; r < scan->n_residues; ++r) {
+        res = &scan->residue[r];
+        fprintf(log, "SCAN %c %s %s : %5d ",
+                freesasa_structure_residue_chain(structure, r),
+                freesasa_structure_residue_number(structure, r),
+                freesasa_structure_residue_name(structure, r),
+                res->n_removed);
+        freesasa_fput_fixed(log, res->removed, 8, 2);
+        fputc(' ', log);
+        freesasa_fput_fixed(log, res->exposed, 8, 2);
+        fputc(' ', log);
+        freesasa_fput_fixed(log, res->delta, 8, 2);
+        fputc('\n', log);
+    }
+    fprintf(log, "\n");
+
+    fflush(log);
+    if (ferror(log)) {
+        return fail_msg(strerror(errno));
+    }
+
+    return FREESASA_SUCCESS;
+}
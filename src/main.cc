@@ -1,16 +1,28 @@
 #if HAVE_CONFIG_H
 #include <config.h>
 #endif
+#include <algorithm>
 #include <assert.h>
+#include <atomic>
+#include <cmath>
+#include <condition_variable>
+#include <ctype.h>
+#include <deque>
 #include <errno.h>
 #include <getopt.h>
 #include <iostream>
+#include <mutex>
 #include <stdarg.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <string>
+#include <thread>
 #include <unistd.h>
+#include <vector>
 
+#include "bcif.hh"
 #include "cif.hh"
 #include "freesasa.h"
 
@@ -34,7 +46,7 @@ static const char *program_name = "freesasa";
 #define JSON_STRING ""
 #endif
 
-#define FORMAT_STRING "log|res|seq|pdb|rsa|cif" XML_STRING JSON_STRING
+#define FORMAT_STRING "log|res|seq|pdb|rsa|cif|bin|bin32" XML_STRING JSON_STRING
 
 enum { B_FILE,
        SELECT,
@@ -42,7 +54,14 @@ enum { B_FILE,
        RSA,
        RADII,
        DEPRECATED,
-       CIF };
+       CIF,
+       BCIF,
+       COMPILE_CONFIG,
+       STRUCTURE_CACHE,
+       BATCH,
+       PIPELINE,
+       STREAM_MODELS,
+       SCAN };
 
 static int option_flag;
 
@@ -68,11 +87,18 @@ static struct option long_options[] = {
     {"format", required_argument, 0, 'f'},
     {"depth", required_argument, 0, 'd'},
     {"cif", no_argument, &option_flag, CIF},
+    {"bcif", no_argument, &option_flag, BCIF},
     {"select", required_argument, &option_flag, SELECT},
     {"unknown", required_argument, &option_flag, UNKNOWN},
     {"rsa", no_argument, &option_flag, RSA},
     {"radii", required_argument, &option_flag, RADII},
     {"deprecated", no_argument, &option_flag, DEPRECATED},
+    {"compile-config", required_argument, &option_flag, COMPILE_CONFIG},
+    {"structure-cache", required_argument, &option_flag, STRUCTURE_CACHE},
+    {"batch", required_argument, &option_flag, BATCH},
+    {"pipeline", no_argument, &option_flag, PIPELINE},
+    {"stream-models", no_argument, &option_flag, STREAM_MODELS},
+    {"scan", required_argument, &option_flag, SCAN},
     /* Deprecated options */
     {"foreach-residue-type", no_argument, 0, 'r'},
     {"foreach-residue", no_argument, 0, 'R'},
@@ -93,18 +119,28 @@ struct cli_state {
     int structure_options;
     int static_classifier;
     int cif;
+    int bcif;
     int no_rel;
+    int pipeline;
+    int stream_models;
+    int scan;
+    freesasa_scan_type scan_type;
     /* chain groups */
     int n_chain_groups;
     char **chain_groups;
     /* selection commands */
     int n_select;
-    char **select_cmd;
+    freesasa_compiled_selection **select;
     /* output settings */
     int output_format, output_depth;
     /* Files */
     char *output_filename;
+    char *compile_filename;
+    char *cache_dir;
+    char *batch_filename;
+    uint64_t classifier_hash; /* identifies classifier read from file */
     FILE *input, *output, *errlog;
+    FILE *gzip_output; /* output is compressed to this file when done */
 };
 
 struct analysis_results {
@@ -123,16 +159,26 @@ init_state(struct cli_state *state)
     state->structure_options = 0;
     state->static_classifier = 0;
     state->no_rel = 0;
+    state->pipeline = 0;
+    state->stream_models = 0;
+    state->scan = 0;
+    state->scan_type = FREESASA_SCAN_DELETE;
     state->n_chain_groups = 0;
     state->chain_groups = NULL;
     state->n_select = 0;
-    state->select_cmd = 0;
+    state->select = NULL;
     state->output_format = 0;
     state->output_depth = FREESASA_OUTPUT_CHAIN;
     state->output_filename = NULL;
+    state->compile_filename = NULL;
+    state->cache_dir = NULL;
+    state->batch_filename = NULL;
+    state->classifier_hash = 0;
     state->output = NULL;
+    state->gzip_output = NULL;
     state->errlog = NULL;
     state->cif = 0;
+    state->bcif = 0;
 }
 
 static void
@@ -147,14 +193,19 @@ release_state(struct cli_state *state)
             free(state->chain_groups[i]);
         }
     }
-    if (state->select_cmd) {
+    if (state->select) {
         for (i = 0; i < state->n_select; ++i) {
-            free(state->select_cmd[i]);
+            freesasa_compiled_selection_free(state->select[i]);
         }
+        free(state->select);
     }
     if (state->errlog) fclose(state->errlog);
     if (state->output) fclose(state->output);
+    if (state->gzip_output) fclose(state->gzip_output);
     free(state->output_filename);
+    free(state->compile_filename);
+    free(state->cache_dir);
+    free(state->batch_filename);
 }
 
 static void
@@ -168,6 +219,7 @@ help(void)
 {
     printf("\nUsage: %s [options] pdb-file ...", program_name);
     printf("\n       %s [options] < pdb-file", program_name);
+    printf("\n       %s [--config-file=<FILE> | --radii=<protor|naccess>] --compile-config=<FILE>", program_name);
     printf("\n       %s (--help | --version | --deprecated)\n", program_name);
     printf("\n"
            "Options:\n"
@@ -177,10 +229,13 @@ help(void)
            "  --radius-from-occupancy | --config-file=<FILE> | --radii=<protor|naccess>\n"
            "  --hetatm --hydrogen\n"
            "  --unknown=<guess|skip|halt>\n"
-           "  --cif\n"
-           "  --separate-models | --join-models\n"
+           "  --cif | --bcif\n"
+           "  --separate-models | --join-models | --stream-models (PDB input only)\n"
            "  --separate-chains | --chain-groups=<LIST> ...\n"
            "  --select=<STRING> ...\n"
+           "  --structure-cache=<DIR>\n"
+           "  --batch=<FILE> | --pipeline (formats log|res|seq|json|xml)\n"
+           "  --scan=<delete|alanine>\n"
            "  --output=<FILE> --error-file=<FILE> --no-warnings\n"
            "  --format=<" FORMAT_STRING "> ... \n"
            "  --depth=<structure|chain|residue|atom>\n");
@@ -258,20 +313,51 @@ exit_with_help(void)
         exit_with_help();   \
     } while (0)
 
+static void
+free_structures(std::vector<freesasa_structure *> &structures)
+{
+    for (auto s : structures) freesasa_structure_free(s);
+    structures.clear();
+}
+
+/* Reads the structures of an input. If the input is invalid, the
+   returned vector is empty, *n is 0 and error describes the problem. */
 static std::vector<freesasa_structure *>
 get_structures(std::FILE *input,
                int *n,
-               const struct cli_state *state)
+               const struct cli_state *state,
+               std::string &error)
 {
     int i, j, n2;
     std::vector<freesasa_structure *> structures;
     freesasa_structure *tmp;
+    std::FILE *unzipped = NULL;
+    bool bcif;
 
     *n = 0;
+
+    /* decompress first, so that BinaryCIF can be recognized */
+    if (freesasa_is_gzip(input)) {
+        unzipped = freesasa_gunzip(input);
+        if (unzipped == NULL) {
+            error = "invalid input";
+            return structures;
+        }
+        input = unzipped;
+    }
+    bcif = state->bcif || freesasa_is_bcif(input);
+    if (bcif && (state->output_format & (FREESASA_CIF | FREESASA_PDB))) {
+        error = "CIF and PDB output can not be generated from BinaryCIF input";
+        goto cleanup;
+    }
+
     if ((state->structure_options & FREESASA_SEPARATE_CHAINS) ||
         (state->structure_options & FREESASA_SEPARATE_MODELS)) {
-        if (state->cif) {
-            structures = freesasa_cif_structure_array(input, n, state->classifier, state->structure_options);
+        if (bcif) {
+            structures = freesasa_bcif_structure_array(input, n, state->classifier, state->structure_options);
+        } else if (state->cif) {
+            structures = freesasa_cif_structure_array(input, n, state->classifier, state->structure_options,
+                                                      state->output_format & FREESASA_CIF);
         } else {
             // TODO this hack needed since PDB implementation is in C
             freesasa_structure **db_ptr_structs = freesasa_structure_array(input, n, state->classifier, state->structure_options);
@@ -282,13 +368,19 @@ get_structures(std::FILE *input,
         }
     } else {
         *n = 1;
-        if (state->cif) {
-            structures.emplace_back(freesasa_structure_from_cif(input, state->classifier, state->structure_options));
+        if (bcif) {
+            structures.emplace_back(freesasa_structure_from_bcif(input, state->classifier, state->structure_options));
+        } else if (state->cif) {
+            structures.emplace_back(freesasa_structure_from_cif(input, state->classifier, state->structure_options,
+                                                                state->output_format & FREESASA_CIF));
         } else {
             structures.emplace_back(freesasa_structure_from_pdb(input, state->classifier, state->structure_options));
         }
         if (structures[0] == NULL) {
-            abort_msg("invalid input");
+            structures.clear();
+            *n = 0;
+            error = "invalid input";
+            goto cleanup;
         }
     }
 
@@ -305,68 +397,392 @@ get_structures(std::FILE *input,
                     structures.reserve(n2);
                     structures.push_back(tmp);
                 } else {
-                    abort_msg("at least one of chain(s) '%s' not found", state->chain_groups[i]);
+                    error = std::string("at least one of chain(s) '") + state->chain_groups[i] + "' not found";
+                    free_structures(structures);
+                    *n = 0;
+                    goto cleanup;
                 }
             }
         }
         *n = n2;
     }
+
+cleanup:
+    if (unzipped) fclose(unzipped);
+
     return structures;
 }
 
-static freesasa_node *
-run_analysis(FILE *input,
-             const char *name,
-             const struct cli_state *state)
+/* FNV-1a */
+static uint64_t
+hash_bytes(uint64_t hash,
+           const void *data,
+           size_t size)
+{
+    const unsigned char *bytes = (const unsigned char *)data;
+    size_t i;
+
+    for (i = 0; i < size; ++i) {
+        hash ^= bytes[i];
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+/* Hashes the contents of a file from its start, and rewinds it.
+   Returns 0 if the file can't be rewound (a pipe for example). */
+static uint64_t
+hash_file(uint64_t hash,
+          std::FILE *file)
+{
+    char buf[1 << 16];
+    size_t n;
+
+    if (fseek(file, 0, SEEK_SET) != 0) return 0;
+    while ((n = fread(buf, 1, sizeof buf, file)) > 0) {
+        hash = hash_bytes(hash, buf, n);
+    }
+    if (ferror(file) || fseek(file, 0, SEEK_SET) != 0) return 0;
+
+    return hash;
+}
+
+/* Path of the cache file for an input, it depends on the contents of
+   the input, and on everything that affects how it is parsed and
+   classified. Empty string if the input can't be hashed. */
+static std::string
+cache_path(std::FILE *input,
+           const struct cli_state *state)
+{
+    const freesasa_classifier *classifier = state->classifier;
+    uint64_t hash = hash_file(14695981039346656037ULL, input);
+    char name[32];
+    int i;
+
+    if (hash == 0) return "";
+
+    if (classifier == NULL) classifier = &freesasa_default_classifier;
+    hash = hash_bytes(hash, PACKAGE_VERSION, strlen(PACKAGE_VERSION));
+    hash = hash_bytes(hash, freesasa_classifier_name(classifier),
+                      strlen(freesasa_classifier_name(classifier)));
+    hash = hash_bytes(hash, &state->classifier_hash, sizeof(state->classifier_hash));
+    hash = hash_bytes(hash, &state->structure_options, sizeof(state->structure_options));
+    hash = hash_bytes(hash, &state->cif, sizeof(state->cif));
+    hash = hash_bytes(hash, &state->bcif, sizeof(state->bcif));
+    for (i = 0; i < state->n_chain_groups; ++i) {
+        hash = hash_bytes(hash, state->chain_groups[i], strlen(state->chain_groups[i]) + 1);
+    }
+
+    snprintf(name, sizeof name, "/%016llx.fss", (unsigned long long)hash);
+
+    return std::string(state->cache_dir) + name;
+}
+
+/* Loads all structures in a cache file, returns false if any of them
+   couldn't be loaded */
+static bool
+load_cached_structures(std::FILE *cache,
+                       std::vector<freesasa_structure *> &structures)
+{
+    freesasa_structure *structure;
+    int c;
+
+    while ((c = getc(cache)) != EOF) {
+        ungetc(c, cache);
+        structure = freesasa_structure_load(cache);
+        if (structure == NULL) {
+            for (auto s : structures) freesasa_structure_free(s);
+            structures.clear();
+            return false;
+        }
+        structures.push_back(structure);
+    }
+    return !structures.empty();
+}
+
+/* Writes structures to a temporary file that is then moved in place,
+   so that concurrent runs never see a partial cache file */
+static void
+save_cached_structures(const std::string &path,
+                       const std::vector<freesasa_structure *> &structures)
+{
+    static std::atomic<unsigned> counter{0};
+    std::string tmp = path + "." + std::to_string(getpid()) + "." + std::to_string(++counter);
+    std::FILE *cache = fopen(tmp.c_str(), "wb");
+    int ret = FREESASA_SUCCESS;
+
+    if (cache == NULL) {
+        warn("could not write structure cache '%s': %s", tmp.c_str(), strerror(errno));
+        return;
+    }
+    for (auto s : structures) {
+        if (freesasa_structure_save(cache, s) == FREESASA_FAIL) ret = FREESASA_FAIL;
+    }
+    if (fclose(cache) != 0) ret = FREESASA_FAIL;
+
+    if (ret == FREESASA_FAIL || rename(tmp.c_str(), path.c_str()) != 0) {
+        warn("could not write structure cache '%s'", path.c_str());
+        remove(tmp.c_str());
+    }
+}
+
+/* Reads the structures of an input from the structure cache, if
+   there is one, and parses the input otherwise (and adds the
+   structures to the cache). Errors are reported as by
+   get_structures(). */
+static std::vector<freesasa_structure *>
+get_structures_cached(std::FILE *input,
+                      int *n,
+                      const struct cli_state *state,
+                      std::string &error)
 {
-    int name_len = strlen(name);
     std::vector<freesasa_structure *> structures;
-    freesasa_node *tree = freesasa_tree_new(), *tmp_tree, *structure_node;
-    const freesasa_result *result;
+    std::string path;
+    std::FILE *cache;
+    bool loaded = false;
+
+    if (state->cache_dir == NULL) return get_structures(input, n, state, error);
+
+    path = cache_path(input, state);
+    if (path.empty()) return get_structures(input, n, state, error);
+
+    cache = fopen(path.c_str(), "rb");
+    if (cache != NULL) {
+        loaded = load_cached_structures(cache, structures);
+        fclose(cache);
+        if (!loaded) warn("ignoring invalid structure cache '%s'", path.c_str());
+    }
+
+    if (loaded) {
+        *n = structures.size();
+    } else {
+        structures = get_structures(input, n, state, error);
+        if (*n > 0) save_cached_structures(path, structures);
+    }
+
+    return structures;
+}
+
+/* The lowest level of the result-tree any of the output formats
+   need, the depth options are ordered from atom to structure */
+static int
+tree_depth(const struct cli_state *state)
+{
+    int format = state->output_format, depth = FREESASA_OUTPUT_STRUCTURE;
+
+    if (format & FREESASA_LOG) depth = std::min(depth, (int)FREESASA_OUTPUT_CHAIN);
+    if (format & (FREESASA_JSON | FREESASA_XML)) depth = std::min(depth, state->output_depth);
+    if (format & (FREESASA_RSA | FREESASA_RES | FREESASA_SEQ)) depth = std::min(depth, (int)FREESASA_OUTPUT_RESIDUE);
+    if (format & (FREESASA_PDB | FREESASA_CIF | FREESASA_BIN)) depth = FREESASA_OUTPUT_ATOM;
+
+    return depth;
+}
+
+/* Calculates SASA for one structure and returns a tree with the
+   result. Returns NULL if the calculation fails, error then describes
+   the problem. If select_mutex is not NULL, it is held while
+   selections are evaluated. */
+static freesasa_node *
+calc_structure(const freesasa_structure *structure,
+               const char *name,
+               const struct cli_state *state,
+               const freesasa_parameters *parameters,
+               std::mutex *select_mutex,
+               std::string &error)
+{
+    freesasa_node *tree, *structure_node;
+    freesasa_result *result;
     freesasa_selection *sel;
-    int n = 0, i, c;
-    char *name_i = (char *)malloc(name_len + 10);
+    int c;
 
-    if (tree == NULL) abort_msg("failed to initialize result-tree");
-    if (name_i == NULL) abort_msg("memory failure");
+    result = freesasa_calc_structure(structure, parameters);
+    if (result == NULL) {
+        error = "can't calculate SASA";
+        return NULL;
+    }
 
-    /* read PDB file */
-    structures = get_structures(input, &n, state);
-    if (n == 0) abort_msg("invalid input");
+    tree = freesasa_tree_init(result, structure, name, tree_depth(state));
+    if (tree == NULL) {
+        freesasa_result_free(result);
+        error = "can't calculate SASA";
+        return NULL;
+    }
+
+    structure_node =
+        freesasa_node_children(freesasa_node_children(tree));
+
+    /* Calculate selections for each structure */
+    if (state->n_select > 0) {
+        if (select_mutex) select_mutex->lock();
+        for (c = 0; c < state->n_select; ++c) {
+            sel = freesasa_compiled_selection_eval(state->select[c], structure, result);
+            if (sel == NULL) break;
+            freesasa_node_structure_add_selection(structure_node, sel);
+            freesasa_selection_free(sel);
+        }
+        if (select_mutex) select_mutex->unlock();
+        if (c < state->n_select) {
+            error = "illegal selection";
+            freesasa_node_free(tree);
+            tree = NULL;
+        }
+    }
+    freesasa_result_free(result);
+
+    return tree;
+}
+
+/* Calculates SASA for the structures of an input, which are freed,
+   and returns the results joined in one tree. Returns NULL if the
+   calculation fails, error then describes the problem. */
+static freesasa_node *
+calc_structures(std::vector<freesasa_structure *> &structures,
+                const char *name,
+                const struct cli_state *state,
+                const freesasa_parameters *parameters,
+                std::mutex *select_mutex,
+                std::string &error)
+{
+    std::vector<freesasa_node *> trees;
+    std::string name_i;
+    freesasa_node *tree = NULL, *tmp_tree;
+    size_t i, n = structures.size();
 
     /* perform calculation on each structure */
     for (i = 0; i < n; ++i) {
-        strcpy(name_i, name);
+        name_i = name;
         if (n > 1 && (state->structure_options & FREESASA_SEPARATE_MODELS))
-            sprintf(name_i + strlen(name_i), ":%d", freesasa_structure_model(structures[i]));
+            name_i += ":" + std::to_string(freesasa_structure_model(structures[i]));
 
-        tmp_tree = freesasa_calc_tree(structures[i], &state->parameters, name_i);
-        if (tmp_tree == NULL) abort_msg("can't calculate SASA");
+        tmp_tree = calc_structure(structures[i], name_i.c_str(), state, parameters, select_mutex, error);
+        if (tmp_tree == NULL) goto cleanup;
+        trees.push_back(tmp_tree);
 
-        structure_node =
-            freesasa_node_children(freesasa_node_children(tmp_tree));
-        result = freesasa_node_structure_result(structure_node);
+        freesasa_structure_free(structures[i]);
+        structures[i] = NULL;
+    }
 
-        /* Calculate selections for each structure */
-        if (state->n_select > 0) {
-            for (c = 0; c < state->n_select; ++c) {
-                sel = freesasa_selection_new(state->select_cmd[c], structures[i], result);
-                if (sel != NULL) {
-                    freesasa_node_structure_add_selection(structure_node, sel);
-                } else {
-                    abort_msg("illegal selection");
-                }
-                freesasa_selection_free(sel);
-            }
-        }
+    tree = freesasa_tree_new();
+    if (tree == NULL) {
+        error = "failed to initialize result-tree";
+        goto cleanup;
+    }
+    freesasa_tree_join_many(tree, trees.data(), trees.size());
+    trees.clear();
 
-        if (freesasa_tree_join(tree, &tmp_tree) != FREESASA_SUCCESS) {
-            abort_msg("failed joining result-trees");
-        }
+cleanup:
+    for (auto t : trees) freesasa_node_free(t);
+    free_structures(structures);
 
-        freesasa_structure_free(structures[i]);
+    return tree;
+}
+
+/* The JSON or XML document that the trees of a --pipeline or
+   --stream-models run are added to. It is started with the first tree
+   and ended by result_stream_close(). */
+struct result_stream {
+    freesasa_json_stream *json;
+    freesasa_xml_stream *xml;
+};
+
+/* The formats that can be written one tree at a time */
+static bool
+is_partial_format(int format)
+{
+    return format == FREESASA_LOG || format == FREESASA_RES || format == FREESASA_SEQ ||
+           format == FREESASA_JSON || format == FREESASA_XML;
+}
+
+static int
+result_stream_add(const struct cli_state *state,
+                  struct result_stream *stream,
+                  freesasa_node *tree)
+{
+    int options = state->output_depth | (state->no_rel ? FREESASA_OUTPUT_SKIP_REL : 0);
+
+#if USE_JSON
+    if (state->output_format == FREESASA_JSON) {
+        if (stream->json == NULL) stream->json = freesasa_json_stream_open(state->output, options);
+        if (stream->json == NULL) return FREESASA_FAIL;
+        return freesasa_json_stream_add(stream->json, tree);
+    }
+#endif
+#if USE_XML
+    if (state->output_format == FREESASA_XML) {
+        if (stream->xml == NULL) stream->xml = freesasa_xml_stream_open(state->output, options);
+        if (stream->xml == NULL) return FREESASA_FAIL;
+        return freesasa_xml_stream_add(stream->xml, tree);
+    }
+#endif
+    return FREESASA_FAIL;
+}
+
+static int
+result_stream_close(struct result_stream *stream)
+{
+    int ret = FREESASA_SUCCESS;
+
+#if USE_JSON
+    if (stream->json && freesasa_json_stream_close(stream->json) == FREESASA_FAIL)
+        ret = FREESASA_FAIL;
+#endif
+#if USE_XML
+    if (stream->xml && freesasa_xml_stream_close(stream->xml) == FREESASA_FAIL)
+        ret = FREESASA_FAIL;
+#endif
+    stream->json = NULL;
+    stream->xml = NULL;
+
+    return ret;
+}
+
+/* Writes the results in a tree as part of the output of several
+   trees. The log format has its parameters and separators written as
+   if the results of all trees were in one, so that the output is the
+   same as when the trees are joined and written at once (the
+   parameters are those given, calculations that are run in parallel
+   use one thread each). JSON and XML results are added to a document
+   that holds all trees. */
+static int
+write_partial_output(const struct cli_state *state,
+                     freesasa_node *tree,
+                     bool first,
+                     bool several,
+                     struct result_stream *stream)
+{
+    int ret = FREESASA_SUCCESS;
+
+    if (state->output_format == FREESASA_JSON || state->output_format == FREESASA_XML) {
+        ret = result_stream_add(state, stream, tree);
+    } else if (state->output_format == FREESASA_LOG) {
+        if (first && freesasa_write_log_parameters(state->output, &state->parameters) == FREESASA_FAIL)
+            ret = FREESASA_FAIL;
+        if (freesasa_write_log_results(state->output, tree, several) == FREESASA_FAIL)
+            ret = FREESASA_FAIL;
+    } else {
+        ret = freesasa_tree_export(state->output, tree, state->output_format | state->output_depth);
     }
 
+    return ret;
+}
+
+static freesasa_node *
+run_analysis(FILE *input,
+             const char *name,
+             const struct cli_state *state)
+{
+    std::vector<freesasa_structure *> structures;
+    freesasa_node *tree;
+    std::string error = "invalid input";
+    int n = 0;
+
+    /* read PDB file */
+    structures = get_structures_cached(input, &n, state, error);
+    if (n == 0) abort_msg("%s", error.c_str());
+
+    tree = calc_structures(structures, name, state, &state->parameters, NULL, error);
+    if (tree == NULL) abort_msg("%s", error.c_str());
+
     return tree;
 }
 
@@ -383,6 +799,693 @@ fopen_werr(const char *filename,
     return f;
 }
 
+/** Batch mode **/
+
+/* Shared by the workers of a --batch run. The entries of the manifest
+   are handed out in order and each is written as soon as it is done,
+   so the records are in the order they complete. */
+struct batch {
+    const struct cli_state *state;
+    freesasa_parameters parameters;
+    std::vector<std::string> entries;
+    std::vector<char> done; /* by an earlier, interrupted, run */
+    std::atomic<size_t> next;
+    std::atomic<int> n_failed;
+    std::mutex select_mutex; /* compiled selections are not thread safe */
+    std::mutex output_mutex;
+    std::FILE *output;
+    std::FILE *checkpoint;
+};
+
+static void
+ndjson_string(std::string &record,
+              const char *str)
+{
+    const unsigned char *c;
+    char buf[8];
+
+    record += '"';
+    for (c = (const unsigned char *)str; *c; ++c) {
+        if (*c == '"' || *c == '\\') {
+            record += '\\';
+            record += *c;
+        } else if (*c < 0x20) {
+            snprintf(buf, sizeof buf, "\\u%04x", *c);
+            record += buf;
+        } else {
+            record += *c;
+        }
+    }
+    record += '"';
+}
+
+/* Same precision as --format=json */
+static void
+ndjson_number(std::string &record,
+              double value)
+{
+    char buf[32];
+
+    if (!std::isfinite(value)) {
+        record += "null";
+        return;
+    }
+    snprintf(buf, sizeof buf, "%.17g", value);
+    record += buf;
+}
+
+/* One line per structure, with the same keys as the structure level
+   of --format=json */
+static void
+ndjson_structure(std::string &record,
+                 const char *input,
+                 const freesasa_structure *structure,
+                 const freesasa_nodearea *area,
+                 const std::vector<freesasa_selection *> &selections)
+{
+    record += "{\"input\":";
+    ndjson_string(record, input);
+    record += ",\"chains\":";
+    ndjson_string(record, freesasa_structure_chain_labels(structure));
+    record += ",\"model\":" + std::to_string(freesasa_structure_model(structure));
+    record += ",\"n-atoms\":" + std::to_string(freesasa_structure_n(structure));
+    record += ",\"area\":{\"total\":";
+    ndjson_number(record, area->total);
+    record += ",\"polar\":";
+    ndjson_number(record, area->polar);
+    record += ",\"apolar\":";
+    ndjson_number(record, area->apolar);
+    record += ",\"main-chain\":";
+    ndjson_number(record, area->main_chain);
+    record += ",\"side-chain\":";
+    ndjson_number(record, area->side_chain);
+    record += "}";
+    if (!selections.empty()) {
+        record += ",\"selections\":[";
+        for (size_t i = 0; i < selections.size(); ++i) {
+            record += i > 0 ? ",{\"name\":" : "{\"name\":";
+            ndjson_string(record, freesasa_selection_name(selections[i]));
+            record += ",\"area\":";
+            ndjson_number(record, freesasa_selection_area(selections[i]));
+            record += "}";
+        }
+        record += "]";
+    }
+    record += "}\n";
+}
+
+static void
+ndjson_error(std::string &record,
+             const char *input,
+             const std::string &error)
+{
+    record += "{\"input\":";
+    ndjson_string(record, input);
+    record += ",\"error\":";
+    ndjson_string(record, error.c_str());
+    record += "}\n";
+}
+
+/* Calculates the SASA of the structures in one input of the manifest
+   and stores their records. Returns false if the input failed, the
+   record then describes the error instead. */
+static bool
+batch_entry(struct batch *batch,
+            const char *entry,
+            std::string &record)
+{
+    const struct cli_state *state = batch->state;
+    std::vector<freesasa_structure *> structures;
+    std::vector<freesasa_selection *> selections;
+    std::string error = "invalid input";
+    freesasa_result *result;
+    freesasa_selection *sel;
+    freesasa_nodearea area;
+    std::FILE *input;
+    int n = 0, i, c;
+    bool ok = true;
+
+    input = fopen(entry, "r");
+    if (input == NULL) {
+        ndjson_error(record, entry, std::string("could not open file: ") + strerror(errno));
+        return false;
+    }
+    structures = get_structures_cached(input, &n, state, error);
+    fclose(input);
+
+    for (i = 0; i < n && ok; ++i) {
+        if (freesasa_structure_n(structures[i]) == 0) {
+            error = "no atoms";
+            ok = false;
+            break;
+        }
+        result = freesasa_calc_structure(structures[i], &batch->parameters);
+        if (result == NULL) {
+            error = "can't calculate SASA";
+            ok = false;
+            break;
+        }
+        area = freesasa_result_classes(structures[i], result);
+
+        {
+            std::lock_guard<std::mutex> lock(batch->select_mutex);
+            for (c = 0; c < state->n_select && ok; ++c) {
+                sel = freesasa_compiled_selection_eval(state->select[c], structures[i], result);
+                if (sel == NULL) {
+                    error = "illegal selection";
+                    ok = false;
+                } else {
+                    selections.push_back(sel);
+                }
+            }
+        }
+
+        if (ok) ndjson_structure(record, entry, structures[i], &area, selections);
+
+        for (auto s : selections) freesasa_selection_free(s);
+        selections.clear();
+        freesasa_result_free(result);
+    }
+    free_structures(structures);
+
+    if (n == 0 || !ok) {
+        record.clear();
+        ndjson_error(record, entry, error);
+        return false;
+    }
+    return true;
+}
+
+/* Writes the records of an entry, and then marks the entry as done in
+   the checkpoint, together with the size of the output so far and
+   whether it failed. If the run is interrupted, the output can then be
+   cut at the last record that was marked as done. */
+static void
+batch_write(struct batch *batch,
+            size_t entry,
+            const std::string &record,
+            bool failed)
+{
+    std::lock_guard<std::mutex> lock(batch->output_mutex);
+
+    fwrite(record.data(), 1, record.size(), batch->output);
+    if (fflush(batch->output) != 0) {
+        error("can't write output: %s", strerror(errno));
+        exit(EXIT_FAILURE);
+    }
+    if (batch->checkpoint) {
+        fprintf(batch->checkpoint, "%zu %ld %d\n", entry, ftell(batch->output), failed ? 1 : 0);
+        if (fflush(batch->checkpoint) != 0) {
+            error("can't write checkpoint: %s", strerror(errno));
+            exit(EXIT_FAILURE);
+        }
+    }
+}
+
+static void
+batch_worker(struct batch *batch)
+{
+    std::string record;
+    size_t i;
+    bool ok;
+
+    while ((i = batch->next++) < batch->entries.size()) {
+        if (batch->done[i]) continue;
+        record.clear();
+        ok = batch_entry(batch, batch->entries[i].c_str(), record);
+        if (!ok) ++batch->n_failed;
+        batch_write(batch, i, record, !ok);
+    }
+}
+
+/* One input file per line, empty lines and lines starting with '#'
+   are skipped */
+static std::vector<std::string>
+read_manifest(const char *filename)
+{
+    std::vector<std::string> entries;
+    std::FILE *manifest = fopen_werr(filename, "r");
+    char *line = NULL;
+    size_t size = 0, begin, end;
+    ssize_t len;
+
+    while ((len = getline(&line, &size, manifest)) > 0) {
+        for (begin = 0; begin < (size_t)len && isspace((unsigned char)line[begin]); ++begin)
+            ;
+        for (end = len; end > begin && isspace((unsigned char)line[end - 1]); --end)
+            ;
+        if (end == begin || line[begin] == '#') continue;
+        entries.emplace_back(line + begin, end - begin);
+    }
+    free(line);
+    fclose(manifest);
+
+    return entries;
+}
+
+/* The first line of a checkpoint identifies the manifest: the number
+   of entries, a hash of them and the path of the manifest */
+static std::string
+checkpoint_header(const char *manifest,
+                  const std::vector<std::string> &entries)
+{
+    uint64_t hash = 14695981039346656037ULL;
+    char buf[64];
+
+    for (const auto &entry : entries) {
+        hash = hash_bytes(hash, entry.c_str(), entry.size());
+        hash = hash_bytes(hash, "\n", 1);
+    }
+    snprintf(buf, sizeof buf, "%zu %016llx ", entries.size(), (unsigned long long)hash);
+
+    return buf + std::string(manifest) + "\n";
+}
+
+/* Marks the entries an interrupted run finished as done (1) or failed
+   (2), and returns the size of the output when the last of them was
+   written, or -1 if there is no checkpoint */
+static long
+read_checkpoint(const std::string &path,
+                const std::string &header,
+                std::vector<char> &done)
+{
+    std::FILE *checkpoint = fopen(path.c_str(), "r");
+    char *line = NULL;
+    size_t size = 0;
+    ssize_t len;
+    unsigned long entry;
+    long offset = 0, entry_offset;
+    int failed;
+
+    if (checkpoint == NULL) return -1;
+
+    len = getline(&line, &size, checkpoint);
+    if (len <= 0 || header != line) {
+        abort_msg("checkpoint '%s' doesn't match the manifest", path.c_str());
+    }
+
+    while ((len = getline(&line, &size, checkpoint)) > 0) {
+        // the run may have been stopped in the middle of a line
+        if (line[len - 1] != '\n') break;
+        if (sscanf(line, "%lu %ld %d", &entry, &entry_offset, &failed) != 3 ||
+            entry >= done.size()) {
+            abort_msg("checkpoint '%s' doesn't match the manifest", path.c_str());
+        }
+        done[entry] = failed ? 2 : 1;
+        offset = std::max(offset, entry_offset);
+    }
+    free(line);
+    fclose(checkpoint);
+
+    return offset;
+}
+
+/* Opens the output and checkpoint of a batch run. If there is a
+   checkpoint from an interrupted run, its output is truncated after
+   the last complete entry, and the run continues from there. Entries
+   that failed in the earlier run are counted as failed in this one. */
+static void
+batch_open(struct batch *batch,
+           const char *output_filename)
+{
+    std::string path = std::string(output_filename) + ".checkpoint",
+                tmp = path + ".tmp",
+                header = checkpoint_header(batch->state->batch_filename, batch->entries);
+    long offset = read_checkpoint(path, header, batch->done);
+    size_t i;
+
+    if (offset < 0) {
+        batch->output = fopen_werr(output_filename, "w");
+    } else {
+        batch->output = fopen_werr(output_filename, "r+");
+        if (ftruncate(fileno(batch->output), offset) != 0 ||
+            fseek(batch->output, offset, SEEK_SET) != 0) {
+            abort_msg("can't resume output '%s': %s", output_filename, strerror(errno));
+        }
+    }
+
+    /* Rewrite the checkpoint, to get rid of an incomplete last line,
+       and move it in place when it's complete */
+    batch->checkpoint = fopen_werr(tmp.c_str(), "w");
+    fputs(header.c_str(), batch->checkpoint);
+    for (i = 0; i < batch->done.size(); ++i) {
+        if (batch->done[i]) {
+            fprintf(batch->checkpoint, "%zu %ld %d\n", i, offset, batch->done[i] == 2 ? 1 : 0);
+        }
+        if (batch->done[i] == 2) ++batch->n_failed;
+    }
+    if (fflush(batch->checkpoint) != 0 || rename(tmp.c_str(), path.c_str()) != 0) {
+        abort_msg("can't write checkpoint '%s': %s", path.c_str(), strerror(errno));
+    }
+}
+
+/* Calculates SASA for all inputs in the manifest, on a pool of
+   -t workers, writing one NDJSON record per structure */
+static int
+run_batch(struct cli_state *state)
+{
+    struct batch batch;
+    std::vector<std::thread> workers;
+    int i, n_workers = 1;
+
+    batch.state = state;
+    batch.parameters = state->parameters;
+    batch.parameters.n_threads = 1; // the inputs are run in parallel instead
+    batch.entries = read_manifest(state->batch_filename);
+    batch.done.assign(batch.entries.size(), 0);
+    batch.next = 0;
+    batch.n_failed = 0;
+    batch.output = stdout;
+    batch.checkpoint = NULL;
+
+    if (state->output_filename) batch_open(&batch, state->output_filename);
+    state->output = batch.output;
+
+#if USE_THREADS
+    n_workers = state->parameters.n_threads;
+    for (i = 1; i < n_workers; ++i) {
+        workers.emplace_back(batch_worker, &batch);
+    }
+#endif
+    batch_worker(&batch);
+    for (auto &worker : workers) {
+        worker.join();
+    }
+
+    if (batch.checkpoint) {
+        fclose(batch.checkpoint);
+        remove((std::string(state->output_filename) + ".checkpoint").c_str());
+    }
+    if (batch.n_failed > 0) {
+        error("%d of %zu inputs in '%s' failed", (int)batch.n_failed,
+              batch.entries.size(), state->batch_filename);
+        return FREESASA_FAIL;
+    }
+    return FREESASA_SUCCESS;
+}
+
+/** Pipelined mode **/
+
+/* An input on its way through the pipeline */
+struct pipeline_item {
+    const char *name;
+    std::vector<freesasa_structure *> structures;
+    freesasa_node *tree;
+    std::string error; /* the run stops when a failed input is reached */
+};
+
+/* Shared by the stages of a --pipeline run. A reader thread parses
+   the inputs in order, a pool of -t workers calculates SASA, and the
+   main thread writes the results in input order as soon as they are
+   ready. At most depth inputs are held between being read and
+   written, which bounds both queues. */
+struct pipeline {
+    const struct cli_state *state;
+    freesasa_parameters parameters;
+    std::vector<pipeline_item> items;
+    bool use_stdin;
+    size_t depth;
+    std::mutex mutex;
+    std::condition_variable cond;
+    std::deque<pipeline_item *> parsed; /* waiting for a worker */
+    std::vector<char> done;             /* waiting for the writer */
+    size_t n_in_flight;
+    bool read_all;
+    bool stop;
+    std::mutex select_mutex; /* compiled selections are not thread safe */
+    struct result_stream stream;
+};
+
+static void
+pipeline_read(struct pipeline *p,
+              pipeline_item *item)
+{
+    std::FILE *input;
+    int n = 0;
+
+    item->error = "invalid input";
+    if (p->use_stdin) {
+        input = stdin;
+    } else {
+        input = fopen(item->name, "r");
+        if (input == NULL) {
+            item->error = std::string("could not open file '") + item->name + "'; " + strerror(errno);
+            return;
+        }
+    }
+    item->structures = get_structures_cached(input, &n, p->state, item->error);
+    if (input != stdin) fclose(input);
+    if (n > 0) item->error.clear();
+}
+
+static void
+pipeline_calc(struct pipeline *p,
+              pipeline_item *item)
+{
+    if (!item->error.empty()) return;
+    item->tree = calc_structures(item->structures, item->name, p->state,
+                                 &p->parameters, &p->select_mutex, item->error);
+}
+
+/* Writes the results of one input, see write_partial_output() */
+static int
+pipeline_write(struct pipeline *p,
+               size_t index)
+{
+    freesasa_node *tree = p->items[index].tree;
+    bool several = p->items.size() > 1 ||
+                   freesasa_node_next(freesasa_node_children(tree)) != NULL;
+    int ret = write_partial_output(p->state, tree, index == 0, several, &p->stream);
+
+    freesasa_node_free(tree);
+    p->items[index].tree = NULL;
+
+    return ret;
+}
+
+static void
+pipeline_reader(struct pipeline *p)
+{
+    size_t i;
+
+    for (i = 0; i < p->items.size(); ++i) {
+        {
+            std::unique_lock<std::mutex> lock(p->mutex);
+            p->cond.wait(lock, [p] { return p->n_in_flight < p->depth || p->stop; });
+            if (p->stop) break;
+            ++p->n_in_flight;
+        }
+        pipeline_read(p, &p->items[i]);
+        {
+            std::lock_guard<std::mutex> lock(p->mutex);
+            p->parsed.push_back(&p->items[i]);
+        }
+        p->cond.notify_all();
+    }
+    {
+        std::lock_guard<std::mutex> lock(p->mutex);
+        p->read_all = true;
+    }
+    p->cond.notify_all();
+}
+
+static void
+pipeline_worker(struct pipeline *p)
+{
+    pipeline_item *item;
+
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(p->mutex);
+            p->cond.wait(lock, [p] { return !p->parsed.empty() || p->read_all || p->stop; });
+            if (p->parsed.empty() || p->stop) break;
+            item = p->parsed.front();
+            p->parsed.pop_front();
+        }
+        pipeline_calc(p, item);
+        {
+            std::lock_guard<std::mutex> lock(p->mutex);
+            p->done[item - p->items.data()] = 1;
+        }
+        p->cond.notify_all();
+    }
+}
+
+/* Calculates SASA for the inputs, or stdin if there are none, with
+   reading, calculation and output overlapping. If an input fails, the
+   run is aborted after the output of the inputs before it. */
+static int
+run_pipeline(const struct cli_state *state,
+             std::vector<const char *> inputs)
+{
+    struct pipeline p;
+    std::vector<std::thread> threads;
+    std::string error;
+    size_t i, n_workers = 1;
+    int ret = FREESASA_SUCCESS;
+
+    p.state = state;
+    p.parameters = state->parameters;
+    p.parameters.n_threads = 1; // the inputs are run in parallel instead
+    p.use_stdin = inputs.empty();
+    if (p.use_stdin) inputs.push_back("stdin");
+    p.items.resize(inputs.size());
+    for (i = 0; i < inputs.size(); ++i) {
+        p.items[i].name = inputs[i];
+        p.items[i].tree = NULL;
+    }
+    p.done.assign(inputs.size(), 0);
+    p.n_in_flight = 0;
+    p.read_all = false;
+    p.stop = false;
+    p.depth = 1;
+    p.stream = {NULL, NULL};
+
+#if USE_THREADS
+    n_workers = state->parameters.n_threads;
+    p.depth = n_workers + 2; // one being read, one per worker and one being written
+    threads.emplace_back(pipeline_reader, &p);
+    for (i = 0; i < n_workers; ++i) {
+        threads.emplace_back(pipeline_worker, &p);
+    }
+#endif
+
+    for (i = 0; i < inputs.size() && error.empty(); ++i) {
+        if (threads.empty()) {
+            pipeline_read(&p, &p.items[i]);
+            pipeline_calc(&p, &p.items[i]);
+        } else {
+            std::unique_lock<std::mutex> lock(p.mutex);
+            p.cond.wait(lock, [&p, i] { return p.done[i] != 0; });
+        }
+        if (!p.items[i].error.empty()) {
+            error = p.items[i].error;
+        } else if (pipeline_write(&p, i) == FREESASA_FAIL) {
+            ret = FREESASA_FAIL;
+        }
+        if (!threads.empty()) {
+            {
+                std::lock_guard<std::mutex> lock(p.mutex);
+                --p.n_in_flight;
+                if (!error.empty()) p.stop = true;
+            }
+            p.cond.notify_all();
+        }
+    }
+
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    for (auto &item : p.items) {
+        free_structures(item.structures);
+        freesasa_node_free(item.tree);
+    }
+    /* end the document with the inputs written before a failure */
+    if (result_stream_close(&p.stream) == FREESASA_FAIL) ret = FREESASA_FAIL;
+    if (!error.empty()) abort_msg("%s", error.c_str());
+
+    return ret;
+}
+
+/** Streaming models **/
+
+/* Calculates SASA for the models of the inputs, or stdin if there are
+   none, one model at a time. The results of each model are written
+   before the next is read, so memory use doesn't depend on the number
+   of models. */
+static int
+run_stream_models(const struct cli_state *state,
+                  std::vector<const char *> inputs)
+{
+    freesasa_model_iter *iter;
+    const freesasa_structure *structure;
+    freesasa_node *tree;
+    std::FILE *input;
+    std::string name, error;
+    struct result_stream stream = {NULL, NULL};
+    bool use_stdin = inputs.empty(), first = true, several;
+    int ret = FREESASA_SUCCESS;
+
+    if (use_stdin) inputs.push_back("stdin");
+
+    for (auto input_name : inputs) {
+        input = use_stdin ? stdin : fopen_werr(input_name, "r");
+        iter = freesasa_model_iter_new(input, state->classifier, state->structure_options);
+        if (iter == NULL) abort_msg("invalid input");
+
+        while ((structure = freesasa_model_iter_next(iter)) != NULL) {
+            /* same names and separators as when all models are read at once */
+            several = freesasa_structure_model(structure) > 1 || freesasa_model_iter_has_next(iter);
+            name = input_name;
+            if (several) name += ":" + std::to_string(freesasa_structure_model(structure));
+
+            tree = calc_structure(structure, name.c_str(), state, &state->parameters, NULL, error);
+            if (tree == NULL) abort_msg("%s", error.c_str());
+            if (write_partial_output(state, tree, first, several || inputs.size() > 1, &stream) == FREESASA_FAIL)
+                ret = FREESASA_FAIL;
+            freesasa_node_free(tree);
+            first = false;
+        }
+        if (freesasa_model_iter_has_next(iter)) abort_msg("invalid input");
+
+        freesasa_model_iter_free(iter);
+        if (!use_stdin) fclose(input);
+    }
+    if (result_stream_close(&stream) == FREESASA_FAIL) ret = FREESASA_FAIL;
+
+    return ret;
+}
+
+/** Residue scan **/
+
+/* Writes a table of the change in SASA when each residue is removed,
+   for each structure of the inputs, or stdin if there are none. */
+static int
+run_scan(const struct cli_state *state,
+         std::vector<const char *> inputs)
+{
+    std::vector<freesasa_structure *> structures;
+    freesasa_scan_result *scan;
+    std::FILE *input;
+    std::string name, error;
+    bool use_stdin = inputs.empty();
+    int n = 0, ret = FREESASA_SUCCESS;
+
+    if (use_stdin) inputs.push_back("stdin");
+
+    for (auto input_name : inputs) {
+        error = "invalid input";
+        input = use_stdin ? stdin : fopen_werr(input_name, "r");
+        structures = get_structures_cached(input, &n, state, error);
+        if (n == 0) abort_msg("%s", error.c_str());
+        if (!use_stdin) fclose(input);
+
+        for (auto structure : structures) {
+            name = input_name;
+            if (n > 1 && (state->structure_options & FREESASA_SEPARATE_MODELS))
+                name += ":" + std::to_string(freesasa_structure_model(structure));
+
+            scan = freesasa_residue_scan(structure, &state->parameters, state->scan_type);
+            if (scan == NULL) abort_msg("can't calculate SASA");
+            if (freesasa_write_scan(state->output, scan, structure, name.c_str()) == FREESASA_FAIL)
+                ret = FREESASA_FAIL;
+            freesasa_scan_result_free(scan);
+        }
+        free_structures(structures);
+    }
+
+    return ret;
+}
+
+/* Output to files ending with .gz is compressed */
+static bool
+is_gzip_filename(const char *filename)
+{
+    size_t len = strlen(filename);
+
+    return len > 3 && strcmp(filename + len - 3, ".gz") == 0;
+}
+
 static void
 state_add_chain_groups(const char *cmd, struct cli_state *state)
 {
@@ -428,13 +1531,14 @@ static void
 state_add_select(const char *cmd, struct cli_state *state)
 {
     ++state->n_select;
-    state->select_cmd = (char **)realloc(state->select_cmd, sizeof(char *) * state->n_select);
-    if (state->select_cmd == NULL) {
+    state->select = (freesasa_compiled_selection **)realloc(state->select, sizeof(freesasa_compiled_selection *) * state->n_select);
+    if (state->select == NULL) {
         abort_msg("out of memory");
     }
-    state->select_cmd[state->n_select - 1] = strdup(cmd);
-    if (state->select_cmd[state->n_select - 1] == NULL) {
-        abort_msg("out of memory");
+    /* parse once, evaluate for each structure */
+    state->select[state->n_select - 1] = freesasa_selection_compile(cmd);
+    if (state->select[state->n_select - 1] == NULL) {
+        abort_msg("illegal selection");
     }
 }
 
@@ -490,10 +1594,31 @@ parse_output_format(const char *optarg)
     if (strcmp(optarg, "cif") == 0) {
         return FREESASA_CIF;
     }
+    if (strcmp(optarg, "bin") == 0) {
+        return FREESASA_BIN;
+    }
+    if (strcmp(optarg, "bin32") == 0) {
+        return FREESASA_BIN | FREESASA_BIN_FLOAT;
+    }
     abort_msg("unknown output format: '%s'", optarg);
     return FREESASA_FAIL; /* to avoid compiler warnings */
 }
 
+static freesasa_scan_type
+parse_scan_type(const char *optarg)
+{
+    if (strcmp("delete", optarg) == 0) {
+        return FREESASA_SCAN_DELETE;
+    }
+    if (strcmp("alanine", optarg) == 0) {
+        return FREESASA_SCAN_ALANINE;
+    }
+    abort_msg("scan '%s' not allowed, "
+              "can only be 'delete' or 'alanine'",
+              optarg);
+    return FREESASA_SCAN_DELETE; /* to avoid compiler warnings */
+}
+
 static int
 parse_output_depth(const char *optarg)
 {
@@ -530,6 +1655,29 @@ state_set_static_classifier(const char *optarg, struct cli_state *state)
     state->static_classifier = 1;
 }
 
+/* Writes the selected classifier in compiled form and exits */
+static void
+compile_config(struct cli_state *state)
+{
+    const freesasa_classifier *classifier = state->classifier;
+    FILE *out;
+    int ret;
+
+    if (classifier == NULL) classifier = &freesasa_default_classifier;
+
+    out = fopen_werr(state->compile_filename, "wb");
+    ret = freesasa_classifier_write_compiled(out, classifier);
+    fclose(out);
+
+    if (ret == FREESASA_FAIL) {
+        error("failed writing compiled configuration to '%s'", state->compile_filename);
+        exit(EXIT_FAILURE);
+    }
+
+    release_state(state);
+    exit(EXIT_SUCCESS);
+}
+
 /* Parse command line arguments and transform state
    accordingly. Parameter state assumed to be initialized to default. */
 static int
@@ -577,6 +1725,38 @@ parse_arg(int argc, char **argv, struct cli_state *state)
             case CIF:
                 state->cif = 1;
                 break;
+            case BCIF:
+                state->bcif = 1;
+                break;
+            case COMPILE_CONFIG:
+                if (state->compile_filename != NULL) {
+                    abort_msg("option --compile-config can only be set once");
+                }
+                state->compile_filename = strdup(optarg);
+                break;
+            case STRUCTURE_CACHE:
+                if (state->cache_dir != NULL) {
+                    abort_msg("option --structure-cache can only be set once");
+                }
+                state->cache_dir = strdup(optarg);
+                break;
+            case BATCH:
+                if (state->batch_filename != NULL) {
+                    abort_msg("option --batch can only be set once");
+                }
+                state->batch_filename = strdup(optarg);
+                break;
+            case PIPELINE:
+                state->pipeline = 1;
+                break;
+            case STREAM_MODELS:
+                state->stream_models = 1;
+                state->structure_options |= FREESASA_SEPARATE_MODELS;
+                break;
+            case SCAN:
+                state->scan = 1;
+                state->scan_type = parse_scan_type(optarg);
+                break;
             default:
                 abort(); /* what does this even mean? */
             }
@@ -610,6 +1790,8 @@ parse_arg(int argc, char **argv, struct cli_state *state)
             cf = fopen_werr(optarg, "r");
             state->classifier = state->classifier_from_file = freesasa_classifier_from_file(cf);
             if (state->classifier_from_file == NULL) abort_msg("can't read file '%s'", optarg);
+            state->classifier_hash = hash_file(14695981039346656037ULL, cf);
+            fclose(cf);
             state->no_rel = 1;
             break;
         }
@@ -693,14 +1875,58 @@ parse_arg(int argc, char **argv, struct cli_state *state)
         }
     }
 
-    if (state->output_filename) {
+    if (state->compile_filename) {
+        if (opt_set['O']) abort_msg("the options -O and --compile-config can't be combined");
+        if (optind < argc) abort_msg("input files can not be given together with --compile-config");
+        compile_config(state);
+    }
+
+    if (state->batch_filename) {
+        /* the output is opened by run_batch() */
+        if (state->output_format != 0) abort_msg("--batch writes NDJSON and can not be combined with --format");
+        if (optind < argc) abort_msg("input files can not be given together with --batch");
+        if (state->output_filename && is_gzip_filename(state->output_filename))
+            abort_msg("the output of --batch can not be compressed");
+    } else if (state->output_filename && is_gzip_filename(state->output_filename)) {
+#if !USE_ZLIB
+        abort_msg("can't write compressed output '%s', %s was built without zlib",
+                  state->output_filename, program_name);
+#endif
+        state->gzip_output = fopen_werr(state->output_filename, "wb");
+        state->output = tmpfile();
+        if (state->output == NULL) abort_msg("can't create temporary file: %s", strerror(errno));
+    } else if (state->output_filename) {
         state->output = fopen_werr(state->output_filename, "w");
     } else {
         state->output = stdout;
     }
 
     if (alg_set > 1) abort_msg("multiple algorithms specified");
-    if (state->output_format == 0) state->output_format = FREESASA_LOG;
+    if (state->scan) {
+        /* the scan has its own output, checked before the default format is set */
+        if (state->batch_filename || state->pipeline || state->stream_models)
+            abort_msg("the option --scan can't be combined with --batch, --pipeline or --stream-models");
+        if (state->output_format != 0) abort_msg("the option --scan can't be combined with --format");
+        if (state->n_select > 0) abort_msg("the option --scan can't be combined with --select");
+    }
+    if (state->output_format == 0 && !state->batch_filename && !state->scan) state->output_format = FREESASA_LOG;
+    if (state->pipeline) {
+        if (state->batch_filename) abort_msg("the options --pipeline and --batch can't be combined");
+        if (!is_partial_format(state->output_format))
+            abort_msg("--pipeline writes the results of each input when it's done, "
+                      "and only supports one of the formats log, res, seq, json and xml");
+    }
+    if (state->stream_models) {
+        if (state->batch_filename || state->pipeline)
+            abort_msg("the option --stream-models can't be combined with --batch or --pipeline");
+        if (state->cif || state->bcif) abort_msg("the option --stream-models only supports PDB input");
+        if (opt_set['m'] || opt_set['C'] || opt_set['g'])
+            abort_msg("the option --stream-models can't be combined with -m, -C or -g");
+        if (state->cache_dir) abort_msg("the option --stream-models can't be combined with --structure-cache");
+        if (!is_partial_format(state->output_format))
+            abort_msg("--stream-models writes the results of each model when it's done, "
+                      "and only supports one of the formats log, res, seq, json and xml");
+    }
     if (opt_set['m'] && opt_set['M']) abort_msg("the options -m and -M can't be combined");
     if (opt_set['g'] && opt_set['C']) abort_msg("the options -g and -C can't be combined");
     if (opt_set['c'] && state->static_classifier) abort_msg("the options -c and --radii cannot be combined");
@@ -713,10 +1939,18 @@ parse_arg(int argc, char **argv, struct cli_state *state)
         abort_msg("the RSA format can not be used with the options -C or -M, "
                   "it does not support several results in one file");
 
+    if ((state->output_format & FREESASA_BIN) &&
+        (state->output_format & ~(FREESASA_BIN | FREESASA_BIN_FLOAT)))
+        abort_msg("binary output can not be combined with other formats");
+    if ((state->output_format & FREESASA_CIF) && state->cache_dir)
+        abort_msg("CIF output can not be combined with --structure-cache");
+
     if (state->output_format & FREESASA_LOG) {
         fprintf(state->output, "## %s ##\n", PACKAGE_STRING);
     }
 
+    if ((state->output_format & (FREESASA_CIF | FREESASA_PDB)) && state->bcif)
+        abort_msg("CIF and PDB output can not be generated from BinaryCIF input");
     if (state->output_format == FREESASA_CIF && state->cif != 1) abort_msg("CIF output can not be generated from .pdb input");
     if (state->output_format == FREESASA_PDB && state->cif == 1) abort_msg("PDB output can not be generated from .cif input.");
     if ((state->output_format == FREESASA_CIF || state->output_format == FREESASA_PDB) &&
@@ -732,7 +1966,8 @@ int main(int argc,
 {
     struct cli_state state;
     FILE *input = NULL;
-    int optind = 0, i, ret;
+    int optind = 0, i, ret = FREESASA_SUCCESS;
+    std::vector<freesasa_node *> trees;
 
     freesasa_node *tree = freesasa_tree_new(), *tmp;
     if (tree == NULL) abort_msg("error initializing calculation");
@@ -741,13 +1976,28 @@ int main(int argc,
 
     optind = parse_arg(argc, argv, &state);
 
-    if (argc > optind) {
+    if (state.batch_filename) {
+        ret = run_batch(&state);
+        freesasa_node_free(tree);
+        release_state(&state);
+        return ret != FREESASA_FAIL ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+    if (state.pipeline || state.stream_models || state.scan) {
+        if (argc == optind && isatty(STDIN_FILENO)) abort_msg("no input", program_name);
+        if (state.pipeline)
+            ret = run_pipeline(&state, std::vector<const char *>(argv + optind, argv + argc));
+        else if (state.stream_models)
+            ret = run_stream_models(&state, std::vector<const char *>(argv + optind, argv + argc));
+        else
+            ret = run_scan(&state, std::vector<const char *>(argv + optind, argv + argc));
+    } else if (argc > optind) {
         for (i = optind; i < argc; ++i) {
             input = fopen_werr(argv[i], "r");
-            tmp = run_analysis(input, argv[i], &state);
-            freesasa_tree_join(tree, &tmp);
+            trees.push_back(run_analysis(input, argv[i], &state));
             fclose(input);
         }
+        freesasa_tree_join_many(tree, trees.data(), trees.size());
     } else {
         if (!isatty(STDIN_FILENO)) {
             tmp = run_analysis(stdin, "stdin", &state);
@@ -756,11 +2006,17 @@ int main(int argc,
             abort_msg("no input", program_name);
     }
 
-    if (state.output_format & FREESASA_CIF) {
-        ret = freesasa_export_tree_to_cif(state.output_filename, tree);
+    if (state.pipeline || state.stream_models || state.scan) {
+        /* the results have already been written */
+    } else if (state.output_format & FREESASA_CIF) {
+        ret = freesasa_export_tree_to_cif(state.output, tree);
     } else {
         ret = freesasa_tree_export(state.output, tree, state.output_format | state.output_depth | (state.no_rel ? FREESASA_OUTPUT_SKIP_REL : 0));
     }
+    if (ret != FREESASA_FAIL && state.gzip_output) {
+        rewind(state.output);
+        ret = freesasa_gzip(state.output, state.gzip_output);
+    }
     freesasa_node_free(tree);
 
     release_state(&state);
@@ -12,24 +12,33 @@
 #define FREESASA_NB_CHUNK 128
 #endif
 
+/* Smallest cell size used by freesasa_nb_within() */
+#define FREESASA_NB_MIN_CELL 1.0
+
+/* Maximum number of cells per atom in freesasa_nb_within() */
+#define FREESASA_NB_CELLS_PER_ATOM 4
+
 typedef struct cell cell;
 struct cell {
     cell *nb[17]; /** includes self, only forward neighbors */
     int *atom;    /** indices of the atoms/coordinates in a cell */
     int n_nb;     /** number of neighbors to cell */
     int n_atoms;  /** number of atoms in cell */
+    int capacity; /** size of the atom array */
 };
 
 static cell empty_cell = {{NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL,
                            NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL},
                           NULL,
                           0,
+                          0,
                           0};
 
 /** cell lists, divide space into boxes */
 typedef struct cell_list {
     cell *cell;     /** the cells */
     int n;          /** number of cells */
+    int n_alloc;    /** number of allocated cells, can be larger than n */
     int nx, ny, nz; /** number of cells along each axis */
     double d;       /** cell size */
     double x_max, x_min;
@@ -37,7 +46,7 @@ typedef struct cell_list {
     double z_max, z_min;
 } cell_list;
 
-static struct cell_list empty_cell_list = {NULL, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+static struct cell_list empty_cell_list = {NULL, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
 
 /** Finds the bounds of the cell list and writes them to the provided cell list */
 static void
@@ -142,17 +151,51 @@ coord2cell_index(const cell_list *c,
     return cell_index(c, ix, iy, iz);
 }
 
+/** Adds atom i to a cell, growing its atom array geometrically */
+static int
+cell_add(cell *cell,
+         int i)
+{
+    int capacity, *a;
+
+    if (cell->n_atoms == cell->capacity) {
+        capacity = cell->capacity ? 2 * cell->capacity : 4;
+        a = realloc(cell->atom, sizeof(int) * capacity);
+        if (!a) return mem_fail();
+        cell->atom = a;
+        cell->capacity = capacity;
+    }
+    cell->atom[cell->n_atoms++] = i;
+
+    return FREESASA_SUCCESS;
+}
+
+/** Removes atom i from a cell, the order of the other atoms is not kept */
+static void
+cell_remove(cell *cell,
+            int i)
+{
+    int k;
+
+    for (k = 0; k < cell->n_atoms; ++k) {
+        if (cell->atom[k] == i) {
+            cell->atom[k] = cell->atom[--cell->n_atoms];
+            return;
+        }
+    }
+    assert(0 && "atom not in cell");
+}
+
 /**
-   Assigns cells to each coordinate. Returns FREESASA_FAIL if realloc
-   fails, FREESASA_SUCCESS else.
+   Assigns cells to each coordinate. The atom arrays of the cells are
+   kept between calls and grown when needed. Returns FREESASA_FAIL if
+   realloc fails, FREESASA_SUCCESS else.
  */
 static int
 fill_cells(cell_list *c,
            const coord_t *coord)
 {
     int i;
-    cell *cell;
-    int *a;
     const double *restrict v;
 
     for (i = 0; i < c->n; ++i) {
@@ -161,15 +204,8 @@ fill_cells(cell_list *c,
 
     for (i = 0; i < freesasa_coord_n(coord); ++i) {
         v = freesasa_coord_i(coord, i);
-        cell = &c->cell[coord2cell_index(c, v)];
-        ++cell->n_atoms;
-        a = cell->atom;
-        cell->atom = realloc(cell->atom, sizeof(int) * cell->n_atoms);
-        if (!cell->atom) {
-            cell->atom = a;
+        if (cell_add(&c->cell[coord2cell_index(c, v)], i))
             return mem_fail();
-        }
-        cell->atom[cell->n_atoms - 1] = i;
     }
     return FREESASA_SUCCESS;
 }
@@ -182,7 +218,7 @@ cell_list_free(cell_list *c)
 
     if (c) {
         if (c->cell) {
-            for (i = 0; i < c->n; ++i)
+            for (i = 0; i < c->n_alloc; ++i)
                 free(c->cell[i].atom);
         }
         free(c->cell);
@@ -190,6 +226,38 @@ cell_list_free(cell_list *c)
     }
 }
 
+/**
+    Calculates the bounds of the cell list for the given coordinates
+    and assigns them to cells. Memory of cells from earlier calls is
+    reused, so that a cell list can be refilled when the coordinates
+    change.
+
+    Returns FREESASA_FAIL if there are malloc fails.
+ */
+static int
+cell_list_fill(cell_list *c,
+               const coord_t *coord)
+{
+    int i;
+    cell *cells;
+
+    cell_list_bounds(c, coord);
+
+    if (c->n > c->n_alloc) {
+        cells = realloc(c->cell, sizeof(cell) * c->n);
+        if (!cells) return mem_fail();
+        c->cell = cells;
+        for (i = c->n_alloc; i < c->n; ++i)
+            c->cell[i] = empty_cell;
+        c->n_alloc = c->n;
+    }
+
+    if (fill_cells(c, coord)) return mem_fail();
+
+    get_nb(c);
+    return FREESASA_SUCCESS;
+}
+
 /**
     Creates a cell list with provided cell-size assigning cells to
     each of the provided coordinates. The created cell list should be
@@ -201,7 +269,6 @@ static cell_list *
 cell_list_new(double cell_size,
               const coord_t *coord)
 {
-    int i;
     cell_list *c;
 
     assert(cell_size > 0);
@@ -216,25 +283,13 @@ cell_list_new(double cell_size,
     *c = empty_cell_list;
 
     c->d = cell_size;
-    cell_list_bounds(c, coord);
-
-    c->cell = malloc(sizeof(cell) * c->n);
-    if (!c->cell) {
-        cell_list_free(c);
-        mem_fail();
-        return NULL;
-    }
-
-    for (i = 0; i < c->n; ++i)
-        c->cell[i] = empty_cell;
 
-    if (fill_cells(c, coord)) {
+    if (cell_list_fill(c, coord)) {
         cell_list_free(c);
         mem_fail();
         return NULL;
     }
 
-    get_nb(c);
     return c;
 }
 
@@ -278,6 +333,7 @@ freesasa_nb_alloc(int n)
     nb->nb = NULL;
     nb->capacity = NULL;
     nb->xyd = nb->xd = nb->yd = NULL;
+    nb->cells = NULL;
 
     nb->nn = malloc(sizeof(int) * n);
     nb->nb = malloc(sizeof(int *) * n);
@@ -344,6 +400,7 @@ void freesasa_nb_free(nb_list *nb)
         free(nb->xyd);
         free(nb->xd);
         free(nb->yd);
+        cell_list_free(nb->cells);
         free(nb);
     }
 }
@@ -450,6 +507,31 @@ nb_add_pair(nb_list *nb_list,
     return FREESASA_SUCCESS;
 }
 
+/**
+    Removes j from the nb list of i (but not i from the list of j).
+    The order of the other neighbors of i is not kept.
+ */
+static void
+nb_remove(nb_list *nb_list,
+          int i,
+          int j)
+{
+    int k, last = nb_list->nn[i] - 1;
+    int *nbi = nb_list->nb[i];
+
+    for (k = 0; k <= last; ++k) {
+        if (nbi[k] == j) {
+            nbi[k] = nbi[last];
+            nb_list->xyd[i][k] = nb_list->xyd[i][last];
+            nb_list->xd[i][k] = nb_list->xd[i][last];
+            nb_list->yd[i][k] = nb_list->yd[i][last];
+            --nb_list->nn[i];
+            return;
+        }
+    }
+    assert(0 && "element not in neighbor list");
+}
+
 /**
     Fills the nb list for all contacts between coordinates
     belonging to the cells ci and cj. Handles the case ci == cj
@@ -525,35 +607,358 @@ nb_list *
 freesasa_nb_new(const coord_t *coord,
                 const double *radii)
 {
-    double cell_size;
-    cell_list *c;
-    int n;
     nb_list *nb;
 
     if (coord == NULL || radii == NULL) return NULL;
 
-    n = freesasa_coord_n(coord);
-    nb = freesasa_nb_alloc(n);
+    nb = freesasa_nb_alloc(freesasa_coord_n(coord));
 
     if (!nb) {
         mem_fail();
         return NULL;
     }
 
-    cell_size = 2 * max_array(radii, n);
-    assert(cell_size > 0);
-    c = cell_list_new(cell_size, coord);
-    if (c == NULL ||
-        nb_fill_list(nb, c, coord, radii)) {
+    if (freesasa_nb_update(nb, coord, radii)) {
         mem_fail();
         freesasa_nb_free(nb);
         nb = NULL;
     }
 
-    /* the cell lists are only a tool to generate the neighbor lists */
+    return nb;
+}
+
+int freesasa_nb_update(nb_list *nb,
+                       const coord_t *coord,
+                       const double *radii)
+{
+    double cell_size;
+    int i;
+
+    assert(nb);
+    assert(coord);
+    assert(radii);
+    assert(freesasa_coord_n(coord) == nb->n);
+
+    cell_size = 2 * max_array(radii, nb->n);
+    assert(cell_size > 0);
+
+    /* the cell list is kept with the neighbor list, so that its
+       memory can be reused when the coordinates change */
+    if (nb->cells == NULL) {
+        nb->cells = cell_list_new(cell_size, coord);
+        if (nb->cells == NULL) return mem_fail();
+    } else {
+        nb->cells->d = cell_size;
+        if (cell_list_fill(nb->cells, coord)) return mem_fail();
+    }
+
+    for (i = 0; i < nb->n; ++i)
+        nb->nn[i] = 0;
+
+    return nb_fill_list(nb, nb->cells, coord, radii);
+}
+
+/** Checks if a coordinate is inside the bounds of a cell list */
+static int
+cell_list_contains(const cell_list *c,
+                   const double *xyz)
+{
+    const double d = c->d;
+
+    return xyz[0] >= c->x_min && xyz[1] >= c->y_min && xyz[2] >= c->z_min &&
+           (int)((xyz[0] - c->x_min) / d) < c->nx &&
+           (int)((xyz[1] - c->y_min) / d) < c->ny &&
+           (int)((xyz[2] - c->z_min) / d) < c->nz;
+}
+
+/**
+    Finds the neighbors of coordinate i, which is not in any cell, by
+    searching its own and all the surrounding cells, and then adds it
+    to its cell.
+ */
+static int
+nb_insert(nb_list *nb_list,
+          cell_list *c,
+          const coord_t *coord,
+          const double *radii,
+          int i)
+{
+    const double *restrict v = freesasa_coord_all(coord);
+    const double d = c->d, ri = radii[i];
+    const double xi = v[3 * i], yi = v[3 * i + 1], zi = v[3 * i + 2];
+    int ix = (int)((xi - c->x_min) / d);
+    int iy = (int)((yi - c->y_min) / d);
+    int iz = (int)((zi - c->z_min) / d);
+    int jx, jy, jz, k, ja;
+    double dx, dy, dz, cut2;
+    const cell *cj;
+
+    for (jx = ix > 0 ? ix - 1 : 0; jx <= ix + 1 && jx < c->nx; ++jx) {
+        for (jy = iy > 0 ? iy - 1 : 0; jy <= iy + 1 && jy < c->ny; ++jy) {
+            for (jz = iz > 0 ? iz - 1 : 0; jz <= iz + 1 && jz < c->nz; ++jz) {
+                cj = &c->cell[cell_index(c, jx, jy, jz)];
+                for (k = 0; k < cj->n_atoms; ++k) {
+                    ja = cj->atom[k];
+                    /* same expressions as in nb_calc_cell_pair(), so
+                       that the results are identical */
+                    cut2 = (ri + radii[ja]) * (ri + radii[ja]);
+                    dx = v[ja * 3] - xi;
+                    dy = v[ja * 3 + 1] - yi;
+                    dz = v[ja * 3 + 2] - zi;
+                    if (dx * dx + dy * dy + dz * dz < cut2) {
+                        if (nb_add_pair(nb_list, i, ja, dx, dy))
+                            return mem_fail();
+                    }
+                }
+            }
+        }
+    }
+
+    return cell_add(&c->cell[cell_index(c, ix, iy, iz)], i);
+}
+
+void freesasa_nb_remove(nb_list *nb,
+                        const coord_t *coord,
+                        const int *elements,
+                        int n,
+                        char *changed)
+{
+    cell_list *c = nb->cells;
+    int i, k, m;
+
+    assert(nb);
+    assert(coord);
+    assert(elements || n == 0);
+    assert(c);
+
+    for (i = 0; i < n; ++i) {
+        m = elements[i];
+        assert(m >= 0 && m < nb->n);
+        if (changed) {
+            changed[m] = 1;
+            for (k = 0; k < nb->nn[m]; ++k)
+                changed[nb->nb[m][k]] = 1;
+        }
+        cell_remove(&c->cell[coord2cell_index(c, freesasa_coord_i(coord, m))], m);
+        for (k = 0; k < nb->nn[m]; ++k)
+            nb_remove(nb, nb->nb[m][k], m);
+        nb->nn[m] = 0;
+    }
+}
+
+int freesasa_nb_insert(nb_list *nb,
+                       const coord_t *coord,
+                       const double *radii,
+                       const int *elements,
+                       int n,
+                       char *changed)
+{
+    int i, k, m;
+
+    assert(nb);
+    assert(coord);
+    assert(radii);
+    assert(elements || n == 0);
+    assert(nb->cells);
+
+    /* one at a time, so that contacts between inserted elements are
+       only added once */
+    for (i = 0; i < n; ++i) {
+        m = elements[i];
+        assert(cell_list_contains(nb->cells, freesasa_coord_i(coord, m)));
+        if (nb_insert(nb, nb->cells, coord, radii, m))
+            return mem_fail();
+    }
+
+    if (changed) {
+        for (i = 0; i < n; ++i) {
+            m = elements[i];
+            changed[m] = 1;
+            for (k = 0; k < nb->nn[m]; ++k)
+                changed[nb->nb[m][k]] = 1;
+        }
+    }
+
+    return FREESASA_SUCCESS;
+}
+
+int freesasa_nb_move(nb_list *nb,
+                     coord_t *coord,
+                     const double *radii,
+                     const int *moved,
+                     int n_moved,
+                     const double *xyz,
+                     char *changed)
+{
+    int i, k, m, inside = 1;
+
+    assert(nb);
+    assert(coord);
+    assert(radii);
+    assert(moved || n_moved == 0);
+    assert(xyz || n_moved == 0);
+    assert(changed);
+    assert(freesasa_coord_n(coord) == nb->n);
+    assert(nb->cells);
+
+    for (i = 0; i < n_moved; ++i) {
+        if (!cell_list_contains(nb->cells, xyz + 3 * i)) inside = 0;
+    }
+
+    if (inside) {
+        freesasa_nb_remove(nb, coord, moved, n_moved, changed);
+        for (i = 0; i < n_moved; ++i)
+            freesasa_coord_set_i(coord, moved[i], xyz + 3 * i);
+        return freesasa_nb_insert(nb, coord, radii, moved, n_moved, changed);
+    }
+
+    /* the cell list doesn't cover the new positions, recalculate the
+       whole list */
+    for (i = 0; i < n_moved; ++i) {
+        m = moved[i];
+        changed[m] = 1;
+        for (k = 0; k < nb->nn[m]; ++k)
+            changed[nb->nb[m][k]] = 1;
+        freesasa_coord_set_i(coord, m, xyz + 3 * i);
+    }
+    if (freesasa_nb_update(nb, coord, radii))
+        return fail_msg("");
+    for (i = 0; i < n_moved; ++i) {
+        m = moved[i];
+        for (k = 0; k < nb->nn[m]; ++k)
+            changed[nb->nb[m][k]] = 1;
+    }
+
+    return FREESASA_SUCCESS;
+}
+
+/**
+    Marks the coordinates in cj that are within the cutoff of a
+    source coordinate in ci and vice versa. Handles the case ci == cj
+    correctly.
+ */
+static void
+within_cell_pair(const coord_t *coord,
+                 double cut2,
+                 const char *source,
+                 char *target,
+                 const cell *ci,
+                 const cell *cj)
+{
+    const double *restrict v = freesasa_coord_all(coord);
+    double xi, yi, zi, dx, dy, dz;
+    int i, j, ia, ja;
+
+    for (i = 0; i < ci->n_atoms; ++i) {
+        ia = ci->atom[i];
+        xi = v[ia * 3];
+        yi = v[ia * 3 + 1];
+        zi = v[ia * 3 + 2];
+        for (j = (ci == cj) ? i + 1 : 0; j < cj->n_atoms; ++j) {
+            ja = cj->atom[j];
+            if (!source[ia] && !source[ja]) continue;
+            if (target[ia] && target[ja]) continue;
+            dx = v[ja * 3] - xi;
+            dy = v[ja * 3 + 1] - yi;
+            dz = v[ja * 3 + 2] - zi;
+            if (dx * dx + dy * dy + dz * dz <= cut2) {
+                if (source[ia]) target[ja] = 1;
+                if (source[ja]) target[ia] = 1;
+            }
+        }
+    }
+}
+
+/**
+    Cell size for freesasa_nb_within(). Cells can't be smaller than the
+    cutoff, and are made larger when needed so that there are at most
+    FREESASA_NB_CELLS_PER_ATOM cells per atom. Otherwise a small cutoff
+    in a large, sparse structure would give a huge number of cells,
+    which all have to be allocated and visited.
+ */
+static double
+within_cell_size(const coord_t *coord,
+                 double cutoff)
+{
+    const int n = freesasa_coord_n(coord);
+    const double max_cells = (double)FREESASA_NB_CELLS_PER_ATOM * n;
+    const double *v = freesasa_coord_i(coord, 0);
+    double lo[3], hi[3], len[3], d;
+    int i, k;
+
+    for (k = 0; k < 3; ++k)
+        lo[k] = hi[k] = v[k];
+    for (i = 1; i < n; ++i) {
+        v = freesasa_coord_i(coord, i);
+        for (k = 0; k < 3; ++k) {
+            lo[k] = fmin(v[k], lo[k]);
+            hi[k] = fmax(v[k], hi[k]);
+        }
+    }
+    for (k = 0; k < 3; ++k)
+        len[k] = hi[k] - lo[k];
+
+    /* start from the size that would give max_cells for the bounding
+       box, and grow until the padding of the bounds (see
+       cell_list_bounds()) is accounted for as well */
+    d = fmax(cutoff, FREESASA_NB_MIN_CELL);
+    d = fmax(d, cbrt(len[0] * len[1] * len[2] / max_cells));
+    while ((len[0] / d + 2) * (len[1] / d + 2) * (len[2] / d + 2) > max_cells &&
+           d < len[0] + len[1] + len[2]) {
+        d *= 1.25;
+    }
+
+    return d;
+}
+
+int freesasa_nb_within(const coord_t *coord,
+                       double cutoff,
+                       const char *source,
+                       char *target)
+{
+    const int n = freesasa_coord_n(coord);
+    cell_list *c;
+    cell *ci;
+    int *n_source, i, ic, jc;
+
+    assert(coord);
+    assert(source);
+    assert(target);
+    assert(cutoff >= 0);
+
+    for (i = 0; i < n; ++i)
+        target[i] = source[i];
+
+    if (n == 0) return FREESASA_SUCCESS;
+
+    c = cell_list_new(within_cell_size(coord, cutoff), coord);
+    if (c == NULL) return fail_msg("");
+
+    n_source = calloc(c->n, sizeof(int));
+    if (n_source == NULL) {
+        cell_list_free(c);
+        return mem_fail();
+    }
+    for (ic = 0; ic < c->n; ++ic) {
+        ci = &c->cell[ic];
+        for (i = 0; i < ci->n_atoms; ++i)
+            n_source[ic] += source[ci->atom[i]];
+    }
+
+    /* only cell pairs where at least one of the cells has sources
+       need to be checked */
+    for (ic = 0; ic < c->n; ++ic) {
+        ci = &c->cell[ic];
+        for (jc = 0; jc < ci->n_nb; ++jc) {
+            if (n_source[ic] > 0 || n_source[ci->nb[jc] - c->cell] > 0)
+                within_cell_pair(coord, cutoff * cutoff, source, target, ci, ci->nb[jc]);
+        }
+    }
+
+    free(n_source);
     cell_list_free(c);
 
-    return nb;
+    return FREESASA_SUCCESS;
 }
 
 int freesasa_nb_contact(const nb_list *nb,
@@ -630,11 +1035,31 @@ START_TEST(test_cell)
 }
 END_TEST
 
+/* a small cutoff in a sparse structure */
+START_TEST(test_within_cell_size)
+{
+    static const double v[] = {0, 0, 0, 0.3, 0, 0, 300, 300, 300, 300, 0, 300};
+    coord_t *coord = freesasa_coord_new();
+    cell_list *c;
+
+    freesasa_coord_append(coord, v, 4);
+    ck_assert(within_cell_size(coord, 0.5) >= 0.5);
+    ck_assert(within_cell_size(coord, 500) >= 500);
+    c = cell_list_new(within_cell_size(coord, 0.5), coord);
+    ck_assert(c != NULL);
+    ck_assert(c->n <= 27 * FREESASA_NB_CELLS_PER_ATOM);
+    cell_list_free(c);
+
+    freesasa_coord_free(coord);
+}
+END_TEST
+
 TCase *
 test_nb_static()
 {
     TCase *tc = tcase_create("nb.c static");
     tcase_add_test(tc, test_cell);
+    tcase_add_test(tc, test_within_cell_size);
 
     return tc;
 }
@@ -15,6 +15,8 @@
    demonstrated in sasa_lr.c and sasa_sr.c).
  */
 
+struct cell_list;
+
 /** Neighbor list */
 typedef struct {
     int n;         /**< number of elements */
@@ -24,6 +26,7 @@ typedef struct {
     double **xd;   /**< signed distance between neighbors along x-axis */
     double **yd;   /**< signed distance between neighbors along y-axis */
     int *capacity; /**< keeps track of memory chunks (don't change this) */
+    struct cell_list *cells; /**< cell list used to find neighbors (don't change this) */
 } nb_list;
 
 /**
@@ -45,6 +48,99 @@ nb_list *
 freesasa_nb_new(const coord_t *coord,
                 const double *radii);
 
+/**
+    Recalculates a neigbor list for new coordinates.
+
+    The number of coordinates has to be the same as when the list was
+    created. The memory of the list and of its cell list is reused,
+    and only grown when an element gets more neighbors than before.
+
+    @param nb The neigbor list
+    @param coord the new coordinates
+    @param radii radii for the coordinates
+    @return ::FREESASA_SUCCESS, ::FREESASA_FAIL if memory allocation
+      failed.
+ */
+int freesasa_nb_update(nb_list *nb,
+                       const coord_t *coord,
+                       const double *radii);
+
+/**
+    Removes all contacts of some of the coordinates of a neigbor list.
+
+    The coordinates are treated as if they were absent, until they are
+    added back with freesasa_nb_insert().
+
+    @param nb The neigbor list, created for coord
+    @param coord The coordinates
+    @param elements Indices of the coordinates to remove, no index may
+      occur twice.
+    @param n Number of coordinates to remove
+    @param changed If not NULL, set to 1 for the removed coordinates
+      and their neighbors. Other elements are not changed.
+ */
+void freesasa_nb_remove(nb_list *nb,
+                        const coord_t *coord,
+                        const int *elements,
+                        int n,
+                        char *changed);
+
+/**
+    Adds coordinates that were removed with freesasa_nb_remove() back
+    to a neighbor list, finding their contacts at their current
+    positions.
+
+    The positions have to be within the bounds of the coordinates the
+    neighbor list was created or last updated for.
+
+    @param nb The neigbor list
+    @param coord The coordinates
+    @param radii radii for the coordinates
+    @param elements Indices of the coordinates to insert.
+    @param n Number of coordinates to insert
+    @param changed If not NULL, set to 1 for the inserted coordinates
+      and their new neighbors. Other elements are not changed.
+    @return ::FREESASA_SUCCESS, ::FREESASA_FAIL if memory allocation
+      failed.
+ */
+int freesasa_nb_insert(nb_list *nb,
+                       const coord_t *coord,
+                       const double *radii,
+                       const int *elements,
+                       int n,
+                       char *changed);
+
+/**
+    Moves some of the coordinates of a neigbor list and updates the
+    list.
+
+    Only the contacts of the moved coordinates are recalculated, as
+    long as the new positions are within the bounds of the cell list
+    of the neighbor list. Otherwise the whole list is recalculated. The
+    contacts are the same as those of a new list for the new
+    coordinates, but their order may differ.
+
+    @param nb The neigbor list, created for coord
+    @param coord The coordinates, the moved coordinates are updated
+    @param radii radii for the coordinates
+    @param moved Indices of the moved coordinates, no index may occur
+      twice.
+    @param n_moved Number of moved coordinates
+    @param xyz New positions of the moved coordinates, 3*n_moved values
+    @param changed Array of the same size as coord, set to 1 for the
+      moved coordinates and for all coordinates that were or are
+      their neighbors. Other elements are not changed.
+    @return ::FREESASA_SUCCESS, ::FREESASA_FAIL if memory allocation
+      failed.
+ */
+int freesasa_nb_move(nb_list *nb,
+                     coord_t *coord,
+                     const double *radii,
+                     const int *moved,
+                     int n_moved,
+                     const double *xyz,
+                     char *changed);
+
 /**
     Frees a neigbor list created by freesasa_nb_new().
 
@@ -52,6 +148,28 @@ freesasa_nb_new(const coord_t *coord,
  */
 void freesasa_nb_free(nb_list *nb);
 
+/**
+    Finds the coordinates that are within a given distance of a set
+    of source coordinates.
+
+    Uses the same cell lists as freesasa_nb_new(), but without
+    storing the contacts, giving O(N) performance.
+
+    @param coord a set of coordinates
+    @param cutoff the distance (inclusive)
+    @param source array of the same size as coord, non-zero for
+      source coordinates
+    @param target array of the same size as coord, set to 1 for
+      coordinates within cutoff of a source (including the sources
+      themselves), 0 else.
+    @return ::FREESASA_SUCCESS, ::FREESASA_FAIL if memory allocation
+      failed.
+ */
+int freesasa_nb_within(const coord_t *coord,
+                       double cutoff,
+                       const char *source,
+                       char *target);
+
 /**
     Checks if two atoms are in contact. Only included for reference.
 
@@ -5,6 +5,9 @@
 #include <assert.h>
 #include <stdlib.h>
 #include <string.h>
+#if USE_THREADS
+#include <pthread.h>
+#endif
 
 #include "classifier.h"
 #include "freesasa_internal.h"
@@ -21,6 +24,7 @@ struct atom_properties {
 
 struct residue_properties {
     int n_atoms;
+    int first_atom;
     char *number;
     freesasa_nodearea *reference;
 };
@@ -29,6 +33,25 @@ struct chain_properties {
     int n_residues;
 };
 
+/* Everything needed to create an atom node, the nodes themselves are
+   only created when the atoms of a residue are navigated to */
+struct atom_record {
+    char *name;
+    char *pdb_line;
+    double radius;
+    freesasa_atom_class the_class;
+    int is_bb;
+};
+
+/* Bump allocator, the chain, residue and atom nodes of a structure
+   (and their strings and areas) all live in the same arena, which is
+   released in one go with the structure node. */
+struct arena_chunk {
+    struct arena_chunk *next;
+    size_t size;
+    size_t used;
+};
+
 struct structure_properties {
     int n_chains;
     int n_atoms;
@@ -36,6 +59,8 @@ struct structure_properties {
     char *chain_labels;
     freesasa_result *result;
     freesasa_selection **selection; // NULL terminated array
+    struct atom_record *atom;
+    struct arena_chunk *arena;
 };
 
 struct result_properties {
@@ -44,6 +69,12 @@ struct result_properties {
     int n_structures;
 };
 
+/* The last child is kept track of to make joins O(1) */
+struct root_properties {
+    int n_results;
+    freesasa_node *last_result;
+};
+
 struct freesasa_node {
     char *name;
     freesasa_nodetype type;
@@ -53,6 +84,7 @@ struct freesasa_node {
         struct chain_properties chain;
         struct structure_properties structure;
         struct result_properties result;
+        struct root_properties root;
     } properties;
     freesasa_nodearea *area;
     freesasa_node *parent;
@@ -62,6 +94,12 @@ struct freesasa_node {
 
 const freesasa_nodearea freesasa_nodearea_null = {NULL, 0, 0, 0, 0, 0, 0};
 
+#if USE_THREADS
+/* Atom nodes are added to the tree while it is being traversed, the
+   lock makes it safe to do that from several threads. */
+static pthread_mutex_t atom_nodes_mutex = PTHREAD_MUTEX_INITIALIZER;
+#endif
+
 static freesasa_node *
 node_new(const char *name)
 {
@@ -72,7 +110,7 @@ node_new(const char *name)
     }
 
     node->name = NULL;
-    node->type = FREESASA_NODE_ATOM;
+    node->type = FREESASA_NODE_ROOT;
     node->area = NULL;
     node->parent = NULL;
     node->children = NULL;
@@ -92,6 +130,69 @@ memerr:
     return NULL;
 }
 
+#define ARENA_ALIGN 16
+#define ARENA_HEADER ((sizeof(struct arena_chunk) + ARENA_ALIGN - 1) / ARENA_ALIGN * ARENA_ALIGN)
+#define ARENA_CHUNK_SIZE 65536
+
+static void *
+arena_alloc(struct arena_chunk **arena, size_t size)
+{
+    struct arena_chunk *chunk = *arena;
+    size_t capacity;
+    void *ptr;
+
+    size = (size + ARENA_ALIGN - 1) / ARENA_ALIGN * ARENA_ALIGN;
+
+    if (chunk == NULL || chunk->used + size > chunk->size) {
+        capacity = size > ARENA_CHUNK_SIZE ? size : ARENA_CHUNK_SIZE;
+        chunk = malloc(ARENA_HEADER + capacity);
+        if (chunk == NULL) {
+            mem_fail();
+            return NULL;
+        }
+        chunk->size = capacity;
+        chunk->used = 0;
+        // keep filling the current chunk if this one is already full
+        if (*arena != NULL && size == capacity) {
+            chunk->next = (*arena)->next;
+            (*arena)->next = chunk;
+        } else {
+            chunk->next = *arena;
+            *arena = chunk;
+        }
+    }
+
+    ptr = (char *)chunk + ARENA_HEADER + chunk->used;
+    chunk->used += size;
+
+    return ptr;
+}
+
+static char *
+arena_strdup(struct arena_chunk **arena, const char *str)
+{
+    size_t len = strlen(str) + 1;
+    char *copy = arena_alloc(arena, len);
+
+    if (copy != NULL) {
+        memcpy(copy, str, len);
+    }
+
+    return copy;
+}
+
+static void
+arena_free(struct arena_chunk *arena)
+{
+    struct arena_chunk *next;
+
+    while (arena) {
+        next = arena->next;
+        free(arena);
+        arena = next;
+    }
+}
+
 static void
 node_free(freesasa_node *node)
 {
@@ -99,25 +200,23 @@ node_free(freesasa_node *node)
     freesasa_selection **sel = NULL;
 
     if (node != NULL) {
-        current = node->children;
-        while (current) {
-            next = current->next;
-            node_free(current);
-            current = next;
+        // nodes below the structure level are owned by its arena
+        assert(node->type != FREESASA_NODE_ATOM &&
+               node->type != FREESASA_NODE_RESIDUE &&
+               node->type != FREESASA_NODE_CHAIN);
+
+        if (node->type != FREESASA_NODE_STRUCTURE) {
+            current = node->children;
+            while (current) {
+                next = current->next;
+                node_free(current);
+                current = next;
+            }
         }
         free(node->name);
         free(node->area);
 
         switch (node->type) {
-        case FREESASA_NODE_ATOM:
-            free(node->properties.atom.pdb_line);
-            free(node->properties.atom.res_name);
-            free(node->properties.atom.res_number);
-            break;
-        case FREESASA_NODE_RESIDUE:
-            free(node->properties.residue.reference);
-            free(node->properties.residue.number);
-            break;
         case FREESASA_NODE_STRUCTURE:
             free(node->properties.structure.chain_labels);
             freesasa_result_free(node->properties.structure.result);
@@ -129,6 +228,7 @@ node_free(freesasa_node *node)
                 }
             }
             free(node->properties.structure.selection);
+            arena_free(node->properties.structure.arena);
             break;
         case FREESASA_NODE_RESULT:
             free(node->properties.result.classified_by);
@@ -140,227 +240,269 @@ node_free(freesasa_node *node)
     }
 }
 
-typedef freesasa_node *(*node_generator)(const freesasa_structure *,
-                                         const freesasa_result *,
-                                         int index);
-
-static int
-node_add_area(freesasa_node *node,
-              const freesasa_structure *structure,
-              const freesasa_result *result)
+static void
+atom_record_area(freesasa_nodearea *area,
+                 const struct atom_record *atom,
+                 double sasa)
 {
-    freesasa_node *child = NULL;
-
-    if (node->type == FREESASA_NODE_RESULT || node->type == FREESASA_NODE_ATOM) {
-        return FREESASA_SUCCESS;
-    }
+    *area = freesasa_nodearea_null;
 
-    node->area = malloc(sizeof(freesasa_nodearea));
-    if (node->area == NULL) {
-        return mem_fail();
-    }
+    area->name = atom->name;
+    area->total = sasa;
 
-    *node->area = freesasa_nodearea_null;
-    node->area->name = node->name;
+    if (atom->is_bb)
+        area->main_chain = sasa;
+    else
+        area->side_chain = sasa;
 
-    child = node->children;
-    while (child) {
-        freesasa_add_nodearea(node->area, child->area);
-        child = child->next;
+    switch (atom->the_class) {
+    case FREESASA_ATOM_APOLAR:
+        area->apolar = sasa;
+        break;
+    case FREESASA_ATOM_POLAR:
+        area->polar = sasa;
+        break;
+    case FREESASA_ATOM_UNKNOWN:
+        area->unknown = sasa;
+        break;
     }
-
-    return FREESASA_SUCCESS;
 }
 
-static freesasa_node *
-node_gen_children(freesasa_node *parent,
-                  const freesasa_structure *structure,
-                  const freesasa_result *result,
-                  int first,
-                  int last,
-                  node_generator ng)
+/**
+    Creates the atom nodes of a residue. This is done the first time
+    the residue's children are requested, the output formats read the
+    atoms straight from the atom records and never create them.
+ */
+static int
+node_residue_atoms(freesasa_node *residue)
 {
-    int i;
-    freesasa_node *child, *first_child;
+    freesasa_node *chain = residue->parent, *structure = chain->parent;
+    struct structure_properties *sp = &structure->properties.structure;
+    const struct atom_record *record;
+    freesasa_node *atom;
+    freesasa_nodearea *area;
+    int i, first = residue->properties.residue.first_atom,
+           n = residue->properties.residue.n_atoms;
 
-    first_child = ng(structure, result, first);
+    assert(residue->type == FREESASA_NODE_RESIDUE);
+    assert(n > 0);
 
-    if (first_child == NULL) {
-        fail_msg("");
-        return NULL;
-    }
+    // tree was created without atoms
+    if (sp->atom == NULL) return FREESASA_SUCCESS;
 
-    first_child->parent = parent;
-    child = parent->children = first_child;
+    atom = arena_alloc(&sp->arena, sizeof(freesasa_node) * n);
+    area = arena_alloc(&sp->arena, sizeof(freesasa_nodearea) * n);
+    if (atom == NULL || area == NULL) {
+        return fail_msg("");
+    }
 
-    for (i = first + 1; i <= last; ++i) {
-        child->next = ng(structure, result, i);
-        if (child->next == NULL) {
-            fail_msg("");
-            return NULL;
-        }
-        child = child->next;
-        child->parent = parent;
+    for (i = 0; i < n; ++i) {
+        record = &sp->atom[first + i];
+        atom_record_area(&area[i], record, sp->result->sasa[first + i]);
+
+        atom[i].name = record->name;
+        atom[i].type = FREESASA_NODE_ATOM;
+        atom[i].properties.atom.is_polar = record->the_class == FREESASA_ATOM_POLAR;
+        atom[i].properties.atom.is_bb = record->is_bb;
+        atom[i].properties.atom.radius = record->radius;
+        atom[i].properties.atom.pdb_line = record->pdb_line;
+        atom[i].properties.atom.chain = chain->name[0];
+        atom[i].properties.atom.res_number = residue->properties.residue.number;
+        atom[i].properties.atom.res_name = residue->name;
+        atom[i].area = &area[i];
+        atom[i].parent = residue;
+        atom[i].children = NULL;
+        atom[i].next = i < n - 1 ? &atom[i + 1] : NULL;
     }
-    child->next = NULL;
 
-    node_add_area(parent, structure, result);
+    residue->children = atom;
 
-    return first_child;
+    return FREESASA_SUCCESS;
 }
 
-static freesasa_node *
-node_atom(const freesasa_structure *structure,
-          const freesasa_result *result,
-          int atom_index)
+static int
+node_atom_records(freesasa_node *node,
+                  const freesasa_structure *structure)
 {
-    freesasa_node *atom =
-        node_new(freesasa_structure_atom_name(structure, atom_index));
+    struct structure_properties *sp = &node->properties.structure;
+    struct atom_record *atom;
     const char *line;
+    int i;
 
+    sp->atom = atom = arena_alloc(&sp->arena, sizeof(struct atom_record) * sp->n_atoms);
     if (atom == NULL) {
-        fail_msg("");
-        return NULL;
-    }
-
-    atom->type = FREESASA_NODE_ATOM;
-    atom->properties.atom.pdb_line = NULL;
-    atom->properties.atom.res_number = NULL;
-    atom->properties.atom.res_name = NULL;
-    atom->properties.atom.is_polar = freesasa_structure_atom_class(structure, atom_index) == FREESASA_ATOM_POLAR;
-    atom->properties.atom.is_bb = freesasa_atom_is_backbone(atom->name);
-    atom->properties.atom.radius = freesasa_structure_atom_radius(structure, atom_index);
-    atom->properties.atom.chain = freesasa_structure_atom_chain(structure, atom_index);
-
-    atom->properties.atom.res_number = strdup(freesasa_structure_atom_res_number(structure, atom_index));
-    if (atom->properties.atom.res_number == NULL) {
-        mem_fail();
-        goto cleanup;
+        return fail_msg("");
     }
 
-    atom->properties.atom.res_name = strdup(freesasa_structure_atom_res_name(structure, atom_index));
-    if (atom->properties.atom.res_name == NULL) {
-        mem_fail();
-        goto cleanup;
-    }
+    for (i = 0; i < sp->n_atoms; ++i) {
+        atom[i].name = arena_strdup(&sp->arena, freesasa_structure_atom_name(structure, i));
+        if (atom[i].name == NULL) {
+            return fail_msg("");
+        }
 
-    line = freesasa_structure_atom_pdb_line(structure, atom_index);
-    if (line != NULL) {
-        atom->properties.atom.pdb_line = strdup(line);
-        if (atom->properties.atom.pdb_line == NULL) {
-            mem_fail();
-            goto cleanup;
+        atom[i].pdb_line = NULL;
+        line = freesasa_structure_atom_pdb_line(structure, i);
+        if (line != NULL) {
+            atom[i].pdb_line = arena_strdup(&sp->arena, line);
+            if (atom[i].pdb_line == NULL) {
+                return fail_msg("");
+            }
         }
-    }
 
-    atom->area = malloc(sizeof(freesasa_nodearea));
-    if (atom->area == NULL) {
-        mem_fail();
-        goto cleanup;
+        atom[i].radius = freesasa_structure_atom_radius(structure, i);
+        atom[i].the_class = freesasa_structure_atom_class(structure, i);
+        atom[i].is_bb = freesasa_atom_is_backbone(atom[i].name);
     }
 
-    atom->area->name = atom->name;
-    freesasa_atom_nodearea(atom->area, structure, result, atom_index);
+    return FREESASA_SUCCESS;
+}
 
-    return atom;
+/* Sums the areas of a range of residues, adding up atoms, residues
+   and chains in the same order as when the nodes are created */
+static void
+residues_area(freesasa_nodearea *area,
+              const freesasa_structure *structure,
+              const freesasa_result *result,
+              int first_residue,
+              int last_residue)
+{
+    freesasa_nodearea term;
+    int i, first, last;
 
-cleanup:
-    node_free(atom);
-    return NULL;
+    for (i = first_residue; i <= last_residue; ++i) {
+        term = freesasa_nodearea_null;
+        freesasa_structure_residue_atoms(structure, i, &first, &last);
+        freesasa_range_nodearea(&term, structure, result, first, last);
+        freesasa_add_nodearea(area, &term);
+    }
 }
 
-static freesasa_node *
-node_residue(const freesasa_structure *structure,
-             const freesasa_result *result,
-             int residue_index)
+static int
+node_residues(freesasa_node *chain,
+              const freesasa_structure *structure,
+              struct arena_chunk **arena,
+              const freesasa_result *result,
+              int first_residue,
+              int last_residue)
 {
-    freesasa_node *residue = NULL;
+    int n = last_residue - first_residue + 1, i, first, last;
+    freesasa_node *residue;
+    freesasa_nodearea *area;
     const freesasa_nodearea *ref;
-    int first, last;
 
-    residue = node_new(freesasa_structure_residue_name(structure, residue_index));
-
-    if (residue == NULL) {
-        fail_msg("");
-        return NULL;
+    residue = arena_alloc(arena, sizeof(freesasa_node) * n);
+    area = arena_alloc(arena, sizeof(freesasa_nodearea) * n);
+    if (residue == NULL || area == NULL) {
+        return fail_msg("");
     }
 
-    residue->type = FREESASA_NODE_RESIDUE;
+    for (i = 0; i < n; ++i) {
+        residue[i].type = FREESASA_NODE_RESIDUE;
+        residue[i].name = arena_strdup(arena, freesasa_structure_residue_name(structure, first_residue + i));
+        residue[i].properties.residue.number =
+            arena_strdup(arena, freesasa_structure_residue_number(structure, first_residue + i));
+        if (residue[i].name == NULL || residue[i].properties.residue.number == NULL) {
+            return fail_msg("");
+        }
 
-    freesasa_structure_residue_atoms(structure, residue_index, &first, &last);
-    residue->properties.residue.n_atoms = last - first + 1;
-    residue->properties.residue.reference = NULL;
+        residue[i].properties.residue.reference = NULL;
+        ref = freesasa_structure_residue_reference(structure, first_residue + i);
+        if (ref != NULL) {
+            residue[i].properties.residue.reference = arena_alloc(arena, sizeof(freesasa_nodearea));
+            if (residue[i].properties.residue.reference == NULL) {
+                return fail_msg("");
+            }
+            // TODO copy name string too
+            *residue[i].properties.residue.reference = *ref;
+        }
 
-    residue->properties.residue.number = strdup(freesasa_structure_residue_number(structure, residue_index));
-    if (residue->properties.residue.number == NULL) {
-        mem_fail();
-        goto cleanup;
-    }
+        freesasa_structure_residue_atoms(structure, first_residue + i, &first, &last);
+        residue[i].properties.residue.first_atom = first;
+        residue[i].properties.residue.n_atoms = last - first + 1;
 
-    ref = freesasa_structure_residue_reference(structure, residue_index);
-    if (ref != NULL) {
-        residue->properties.residue.reference = malloc(sizeof(freesasa_nodearea));
-        if (residue->properties.residue.reference == NULL) {
-            mem_fail();
-            goto cleanup;
-        }
-        // TODO copy name string too
-        *residue->properties.residue.reference = *ref;
-    }
+        area[i] = freesasa_nodearea_null;
+        area[i].name = residue[i].name;
+        freesasa_range_nodearea(&area[i], structure, result, first, last);
 
-    if (node_gen_children(residue, structure, result, first,
-                          last, node_atom) == NULL) {
-        goto cleanup;
+        residue[i].area = &area[i];
+        residue[i].parent = chain;
+        residue[i].children = NULL;
+        residue[i].next = i < n - 1 ? &residue[i + 1] : NULL;
+        freesasa_add_nodearea(chain->area, &area[i]);
     }
 
-    return residue;
+    chain->children = residue;
 
-cleanup:
-    node_free(residue);
-    return NULL;
+    return FREESASA_SUCCESS;
 }
 
-static freesasa_node *
-node_chain(const freesasa_structure *structure,
-           const freesasa_result *result,
-           int chain_index)
+static int
+node_chains(freesasa_node *node,
+            const freesasa_structure *structure,
+            const freesasa_result *result,
+            freesasa_nodetype exclude_type)
 {
-    const char *chains = freesasa_structure_chain_labels(structure);
-    char name[2] = {chains[chain_index], '\0'};
-    freesasa_node *chain = NULL;
-    int first_atom, last_atom, first_residue, last_residue;
-
-    assert(strlen(chains) > chain_index);
-
-    freesasa_structure_chain_atoms(structure, chains[chain_index],
-                                   &first_atom, &last_atom);
+    struct structure_properties *sp = &node->properties.structure;
+    int n = sp->n_chains, i, first_residue, last_residue;
+    freesasa_node *chain;
+    freesasa_nodearea *area, term;
+    char name[2] = {'\0', '\0'};
+
+    if (exclude_type == FREESASA_NODE_CHAIN) {
+        for (i = 0; i < n; ++i) {
+            term = freesasa_nodearea_null;
+            freesasa_structure_chain_residues(structure, sp->chain_labels[i],
+                                              &first_residue, &last_residue);
+            residues_area(&term, structure, result, first_residue, last_residue);
+            freesasa_add_nodearea(node->area, &term);
+        }
+        return FREESASA_SUCCESS;
+    }
 
-    chain = node_new(name);
-    if (chain == NULL) {
-        fail_msg("");
-        return NULL;
+    chain = arena_alloc(&sp->arena, sizeof(freesasa_node) * n);
+    area = arena_alloc(&sp->arena, sizeof(freesasa_nodearea) * n);
+    if (chain == NULL || area == NULL) {
+        return fail_msg("");
     }
 
-    chain->type = FREESASA_NODE_CHAIN;
-    freesasa_structure_chain_residues(structure, name[0],
-                                      &first_residue, &last_residue);
-    chain->properties.chain.n_residues = last_residue - first_residue + 1;
+    for (i = 0; i < n; ++i) {
+        name[0] = sp->chain_labels[i];
+        chain[i].type = FREESASA_NODE_CHAIN;
+        chain[i].name = arena_strdup(&sp->arena, name);
+        if (chain[i].name == NULL) {
+            return fail_msg("");
+        }
 
-    if (node_gen_children(chain, structure, result,
-                          first_residue, last_residue,
-                          node_residue) == NULL) {
-        fail_msg("");
-        node_free(chain);
-        return NULL;
+        area[i] = freesasa_nodearea_null;
+        area[i].name = chain[i].name;
+        chain[i].area = &area[i];
+        chain[i].parent = node;
+        chain[i].children = NULL;
+        chain[i].next = i < n - 1 ? &chain[i + 1] : NULL;
+
+        freesasa_structure_chain_residues(structure, name[0],
+                                          &first_residue, &last_residue);
+        chain[i].properties.chain.n_residues = last_residue - first_residue + 1;
+
+        if (exclude_type == FREESASA_NODE_RESIDUE) {
+            residues_area(&area[i], structure, result, first_residue, last_residue);
+        } else if (node_residues(&chain[i], structure, &sp->arena, result,
+                                 first_residue, last_residue)) {
+            return fail_msg("");
+        }
+
+        freesasa_add_nodearea(node->area, &area[i]);
     }
 
-    return chain;
+    node->children = chain;
+
+    return FREESASA_SUCCESS;
 }
 
 static freesasa_node *
 node_structure(const freesasa_structure *structure,
                const freesasa_result *result,
-               int dummy_index)
+               freesasa_nodetype exclude_type)
 {
     freesasa_node *node = NULL;
     node = node_new(freesasa_structure_chain_labels(structure));
@@ -375,6 +517,8 @@ node_structure(const freesasa_structure *structure,
     node->properties.structure.n_atoms = freesasa_structure_n(structure);
     node->properties.structure.result = NULL;
     node->properties.structure.selection = NULL;
+    node->properties.structure.atom = NULL;
+    node->properties.structure.arena = NULL;
     node->properties.structure.chain_labels = strdup(freesasa_structure_chain_labels(structure));
     node->properties.structure.model = freesasa_structure_model(structure);
 
@@ -390,9 +534,21 @@ node_structure(const freesasa_structure *structure,
         goto cleanup;
     }
 
-    if (node_gen_children(node, structure, result, 0,
-                          freesasa_structure_n_chains(structure) - 1,
-                          node_chain) == NULL) {
+    node->area = malloc(sizeof(freesasa_nodearea));
+    if (node->area == NULL) {
+        mem_fail();
+        goto cleanup;
+    }
+    *node->area = freesasa_nodearea_null;
+    node->area->name = node->name;
+
+    if (exclude_type == FREESASA_NODE_NONE &&
+        node_atom_records(node, structure)) {
+        fail_msg("");
+        goto cleanup;
+    }
+
+    if (node_chains(node, structure, result, exclude_type)) {
         fail_msg("");
         goto cleanup;
     }
@@ -403,42 +559,29 @@ cleanup:
     return NULL;
 }
 
-freesasa_node *
-freesasa_tree_new(void)
+/* Translates output depth options to the first level of nodes that
+   are not created */
+static freesasa_nodetype
+depth_exclude_type(int options)
 {
-    freesasa_node *tree = node_new(NULL);
-    if (tree != NULL) {
-        tree->type = FREESASA_NODE_ROOT;
-    }
-    return tree;
-}
-
-freesasa_node *
-freesasa_tree_init(const freesasa_result *result,
-                   const freesasa_structure *structure,
-                   const char *name)
-{
-    freesasa_node *tree = node_new(NULL);
-
-    tree->type = FREESASA_NODE_ROOT;
+    freesasa_nodetype exclude_type = FREESASA_NODE_NONE;
 
-    if (tree == NULL) {
-        fail_msg("");
-    } else if (freesasa_tree_add_result(tree, result, structure, name) == FREESASA_FAIL) {
-        fail_msg("");
-        freesasa_node_free(tree);
-        tree = NULL;
-    }
+    if (options & FREESASA_OUTPUT_STRUCTURE) exclude_type = FREESASA_NODE_CHAIN;
+    if (options & FREESASA_OUTPUT_CHAIN) exclude_type = FREESASA_NODE_RESIDUE;
+    if (options & FREESASA_OUTPUT_RESIDUE) exclude_type = FREESASA_NODE_ATOM;
+    if (options & FREESASA_OUTPUT_ATOM) exclude_type = FREESASA_NODE_NONE;
 
-    return tree;
+    return exclude_type;
 }
 
-int freesasa_tree_add_result(freesasa_node *tree,
-                             const freesasa_result *result,
-                             const freesasa_structure *structure,
-                             const char *name)
+static int
+tree_add_result(freesasa_node *tree,
+                const freesasa_result *result,
+                const freesasa_structure *structure,
+                const char *name,
+                freesasa_nodetype exclude_type)
 {
-    freesasa_node *node = node_new(name);
+    freesasa_node *node = node_new(name), *structure_node;
 
     if (node == NULL) {
         goto cleanup;
@@ -454,13 +597,19 @@ int freesasa_tree_add_result(freesasa_node *tree,
         goto cleanup;
     }
 
-    if (node_gen_children(node, structure, result, 0, 0,
-                          node_structure) == NULL) {
+    structure_node = node_structure(structure, result, exclude_type);
+    if (structure_node == NULL) {
         goto cleanup;
     }
+    structure_node->parent = node;
+    node->children = structure_node;
 
     node->next = tree->children;
     tree->children = node;
+    if (tree->properties.root.last_result == NULL) {
+        tree->properties.root.last_result = node;
+    }
+    ++tree->properties.root.n_results;
 
     return FREESASA_SUCCESS;
 
@@ -470,29 +619,88 @@ cleanup:
     return FREESASA_FAIL;
 }
 
+static freesasa_node *
+root_new(void)
+{
+    freesasa_node *tree = node_new(NULL);
+    if (tree != NULL) {
+        tree->type = FREESASA_NODE_ROOT;
+        tree->properties.root.n_results = 0;
+        tree->properties.root.last_result = NULL;
+    }
+    return tree;
+}
+
+freesasa_node *
+freesasa_tree_new(void)
+{
+    return root_new();
+}
+
+freesasa_node *
+freesasa_tree_init(const freesasa_result *result,
+                   const freesasa_structure *structure,
+                   const char *name,
+                   int depth)
+{
+    freesasa_node *tree = root_new();
+
+    if (tree == NULL) {
+        fail_msg("");
+    } else if (tree_add_result(tree, result, structure, name,
+                               depth_exclude_type(depth)) == FREESASA_FAIL) {
+        fail_msg("");
+        freesasa_node_free(tree);
+        tree = NULL;
+    }
+
+    return tree;
+}
+
+int freesasa_tree_add_result(freesasa_node *tree,
+                             const freesasa_result *result,
+                             const freesasa_structure *structure,
+                             const char *name)
+{
+    return tree_add_result(tree, result, structure, name, FREESASA_NODE_NONE);
+}
+
 int freesasa_tree_join(freesasa_node *tree1,
                        freesasa_node **tree2)
 {
-    freesasa_node *child;
+    return freesasa_tree_join_many(tree1, tree2, 1);
+}
+
+int freesasa_tree_join_many(freesasa_node *tree,
+                            freesasa_node **trees,
+                            int n)
+{
+    struct root_properties *root;
+    int i;
+
+    assert(tree);
+    assert(trees);
+    assert(tree->type == FREESASA_NODE_ROOT);
 
-    assert(tree1);
-    assert(tree2);
-    assert(*tree2);
-    assert(tree1->type == FREESASA_NODE_ROOT);
-    assert((*tree2)->type == FREESASA_NODE_ROOT);
+    root = &tree->properties.root;
 
-    child = tree1->children;
+    for (i = 0; i < n; ++i) {
+        assert(trees[i]);
+        assert(trees[i]->type == FREESASA_NODE_ROOT);
 
-    if (child != NULL) {
-        while (child->next)
-            child = child->next;
-        child->next = (*tree2)->children;
-    } else {
-        tree1->children = (*tree2)->children;
+        if (trees[i]->children != NULL) {
+            if (root->last_result != NULL) {
+                root->last_result->next = trees[i]->children;
+            } else {
+                tree->children = trees[i]->children;
+            }
+            root->last_result = trees[i]->properties.root.last_result;
+            root->n_results += trees[i]->properties.root.n_results;
+        }
+        // tree takes over ownership, trees[i] is invalidated.
+        free(trees[i]);
+        trees[i] = NULL;
     }
-    // tree1 takes over ownership, tree2 is invalidated.
-    free(*tree2);
-    *tree2 = NULL;
 
     return FREESASA_SUCCESS;
 }
@@ -517,7 +725,22 @@ freesasa_node_area(const freesasa_node *node)
 freesasa_node *
 freesasa_node_children(freesasa_node *node)
 {
-    return node->children;
+    freesasa_node *children;
+
+    if (node->type != FREESASA_NODE_RESIDUE) return node->children;
+
+#if USE_THREADS
+    pthread_mutex_lock(&atom_nodes_mutex);
+#endif
+    if (node->children == NULL && node_residue_atoms(node)) {
+        fail_msg("");
+    }
+    children = node->children;
+#if USE_THREADS
+    pthread_mutex_unlock(&atom_nodes_mutex);
+#endif
+
+    return children;
 }
 
 freesasa_node *
@@ -544,6 +767,12 @@ freesasa_node_name(const freesasa_node *node)
     return node->name;
 }
 
+int freesasa_node_root_n_results(const freesasa_node *node)
+{
+    assert(node->type == FREESASA_NODE_ROOT);
+    return node->properties.root.n_results;
+}
+
 const char *
 freesasa_node_classified_by(const freesasa_node *node)
 {
@@ -610,6 +839,12 @@ freesasa_node_residue_number(const freesasa_node *node)
     return node->properties.residue.number;
 }
 
+int freesasa_node_residue_first_atom(const freesasa_node *node)
+{
+    assert(node->type == FREESASA_NODE_RESIDUE);
+    return node->properties.residue.first_atom;
+}
+
 const freesasa_nodearea *
 freesasa_node_residue_reference(const freesasa_node *node)
 {
@@ -655,6 +890,42 @@ freesasa_node_structure_result(const freesasa_node *node)
     return node->properties.structure.result;
 }
 
+int freesasa_node_structure_atom(const freesasa_node *node,
+                                 int i,
+                                 const char **name,
+                                 double *radius,
+                                 freesasa_atom_class *the_class,
+                                 int *is_bb)
+{
+    const struct structure_properties *sp = &node->properties.structure;
+
+    assert(node->type == FREESASA_NODE_STRUCTURE);
+    assert(i >= 0 && i < sp->n_atoms);
+
+    if (sp->atom == NULL) return FREESASA_FAIL;
+
+    *name = sp->atom[i].name;
+    *radius = sp->atom[i].radius;
+    *the_class = sp->atom[i].the_class;
+    *is_bb = sp->atom[i].is_bb;
+
+    return FREESASA_SUCCESS;
+}
+
+const char *
+freesasa_node_structure_atom_pdb_line(const freesasa_node *node,
+                                      int i)
+{
+    const struct structure_properties *sp = &node->properties.structure;
+
+    assert(node->type == FREESASA_NODE_STRUCTURE);
+    assert(i >= 0 && i < sp->n_atoms);
+
+    if (sp->atom == NULL) return NULL;
+
+    return sp->atom[i].pdb_line;
+}
+
 int freesasa_node_structure_add_selection(freesasa_node *node,
                                           const freesasa_selection *selection)
 {
@@ -138,7 +138,10 @@ extern int freesasa_yydebug;
     T_NAME = 267,
     T_CHAIN = 268,
     T_MINUS = 269,
-    ATOM = 270
+    T_WITHIN = 270,
+    T_AROUND = 271,
+    T_OF = 272,
+    ATOM = 273
   };
 #endif
 
@@ -152,7 +155,7 @@ union YYSTYPE
     const char *value;
     expression *expression;
 
-#line 156 "parser.c" /* yacc.c:355  */
+#line 159 "parser.c" /* yacc.c:355  */
 };
 
 typedef union YYSTYPE YYSTYPE;
@@ -168,7 +171,7 @@ int freesasa_yyparse (expression **expression, freesasa_yyscan_t scanner);
 
 /* Copy the second part of user declarations.  */
 
-#line 172 "parser.c" /* yacc.c:358  */
+#line 175 "parser.c" /* yacc.c:358  */
 
 #ifdef short
 # undef short
@@ -410,21 +413,21 @@ union yyalloc
 /* YYFINAL -- State number of the termination state.  */
 #define YYFINAL  4
 /* YYLAST -- Last index in YYTABLE.  */
-#define YYLAST   45
+#define YYLAST   52
 
 /* YYNTOKENS -- Number of terminals.  */
-#define YYNTOKENS  21
+#define YYNTOKENS  24
 /* YYNNTS -- Number of nonterminals.  */
 #define YYNNTS  7
 /* YYNRULES -- Number of rules.  */
-#define YYNRULES  24
+#define YYNRULES  26
 /* YYNSTATES -- Number of states.  */
-#define YYNSTATES  44
+#define YYNSTATES  52
 
 /* YYTRANSLATE[YYX] -- Symbol number corresponding to YYX as returned
    by yylex, with out-of-bounds checking.  */
 #define YYUNDEFTOK  2
-#define YYMAXUTOK   270
+#define YYMAXUTOK   273
 
 #define YYTRANSLATE(YYX)                                                \
   ((unsigned int) (YYX) <= YYMAXUTOK ? yytranslate[YYX] : YYUNDEFTOK)
@@ -437,7 +440,7 @@ static const yytype_uint8 yytranslate[] =
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-      19,    20,     2,    16,    18,    17,     2,     2,     2,     2,
+      22,    23,     2,    19,    21,    20,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
@@ -460,16 +463,16 @@ static const yytype_uint8 yytranslate[] =
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     1,     2,     3,     4,
        5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
-      15
+      15,    16,    17,    18
 };
 
 #if YYDEBUG
   /* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
 static const yytype_uint8 yyrline[] =
 {
-       0,    68,    68,    72,    73,    74,    75,    76,    77,    78,
-      79,    80,    84,    85,    89,    90,    91,    92,    93,    97,
-      98,    99,   103,   104,   105
+       0,    72,    72,    76,    77,    78,    79,    80,    81,    82,
+      83,    84,    85,    87,    92,    93,    97,    98,    99,   100,
+     101,   105,   106,   107,   111,   112,   113
 };
 #endif
 
@@ -480,8 +483,9 @@ static const char *const yytname[] =
 {
   "$end", "error", "$undefined", "T_NUMBER", "T_ID", "T_SELID", "T_AND",
   "T_OR", "T_NOT", "T_RESN", "T_RESI", "T_SYMBOL", "T_NAME", "T_CHAIN",
-  "T_MINUS", "ATOM", "'+'", "'-'", "','", "'('", "')'", "$accept", "stmt",
-  "expr", "list", "r_range", "c_range", "id", YY_NULLPTR
+  "T_MINUS", "T_WITHIN", "T_AROUND", "T_OF", "ATOM", "'+'", "'-'", "','",
+  "'('", "')'", "$accept", "stmt", "expr", "list", "r_range", "c_range",
+  "id", YY_NULLPTR
 };
 #endif
 
@@ -491,15 +495,15 @@ static const char *const yytname[] =
 static const yytype_uint16 yytoknum[] =
 {
        0,   256,   257,   258,   259,   260,   261,   262,   263,   264,
-     265,   266,   267,   268,   269,   270,    43,    45,    44,    40,
-      41
+     265,   266,   267,   268,   269,   270,   271,   272,   273,    43,
+      45,    44,    40,    41
 };
 # endif
 
-#define YYPACT_NINF -20
+#define YYPACT_NINF -17
 
 #define yypact_value_is_default(Yystate) \
-  (!!((Yystate) == (-20)))
+  (!!((Yystate) == (-17)))
 
 #define YYTABLE_NINF -1
 
@@ -510,11 +514,12 @@ static const yytype_uint16 yytoknum[] =
      STATE-NUM.  */
 static const yytype_int8 yypact[] =
 {
-      -3,   -12,    14,    26,   -20,    26,     7,     1,     7,     7,
-       7,    26,    10,   -20,   -20,   -20,    19,   -20,    15,     7,
-      16,    12,   -20,   -20,    24,    25,    13,    26,    26,   -20,
-       7,   -20,     1,     7,     7,     7,   -20,   -20,    35,   -20,
-     -20,   -20,   -20,   -20
+       9,   -16,    18,    30,   -17,    30,     6,    -1,     6,     6,
+       6,    19,    21,    30,    10,   -17,   -17,   -17,    22,   -17,
+       2,     6,    15,     8,   -17,   -17,    25,    27,    12,    31,
+       0,    30,    30,   -17,     6,   -17,    -1,     6,     6,     6,
+      30,    30,   -17,   -17,    43,   -17,   -17,   -17,   -17,   -17,
+     -17,   -17
 };
 
   /* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
@@ -523,22 +528,23 @@ static const yytype_int8 yypact[] =
 static const yytype_uint8 yydefact[] =
 {
        0,     0,     0,     0,     1,     0,     0,     0,     0,     0,
-       0,     0,     2,     6,    22,    23,     0,     7,    12,     0,
-       8,    14,     9,    10,    11,    19,     0,     0,     0,    24,
-       0,    17,     0,    18,     0,     0,     3,     4,     5,    13,
-      15,    16,    20,    21
+       0,     0,     0,     0,     2,     6,    24,    25,     0,     7,
+      14,     0,     8,    16,     9,    10,    11,    21,     0,     0,
+       0,     0,     0,    26,     0,    19,     0,    20,     0,     0,
+       0,     0,     3,     4,     5,    15,    17,    18,    22,    23,
+      12,    13
 };
 
   /* YYPGOTO[NTERM-NUM].  */
 static const yytype_int8 yypgoto[] =
 {
-     -20,   -20,    -4,     0,   -19,     9,    -7
+     -17,   -17,    -5,     3,    14,    13,    -6
 };
 
   /* YYDEFGOTO[NTERM-NUM].  */
 static const yytype_int8 yydefgoto[] =
 {
-      -1,     2,    12,    17,    20,    24,    18
+      -1,     2,    14,    19,    22,    26,    20
 };
 
   /* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
@@ -546,47 +552,50 @@ static const yytype_int8 yydefgoto[] =
      number is the opposite.  If YYTABLE_NINF, syntax error.  */
 static const yytype_uint8 yytable[] =
 {
-      21,    13,     1,    25,    14,    15,     3,    26,    22,    23,
-      14,    15,    31,    40,     4,    16,    27,    28,    19,    27,
-      28,    16,    29,    37,    38,    21,    41,    25,    43,    33,
-      39,    30,    32,    36,     5,     6,     7,     8,     9,    10,
-      34,    27,    35,    42,     0,    11
+      15,    23,    16,    17,    27,     3,    31,    32,    30,    16,
+      17,    24,    25,    18,     1,    35,    31,    32,     4,    21,
+      18,    34,    28,    42,    29,    33,    43,    44,    37,    40,
+      23,    47,    27,    49,    36,    50,    51,    45,     5,     6,
+       7,     8,     9,    10,    38,    11,    12,    39,    41,    31,
+      46,    48,    13
 };
 
-static const yytype_int8 yycheck[] =
+static const yytype_uint8 yycheck[] =
 {
-       7,     5,     5,    10,     3,     4,    18,    11,     8,     9,
-       3,     4,    19,    32,     0,    14,     6,     7,    17,     6,
-       7,    14,     3,    27,    28,    32,    33,    34,    35,    17,
-      30,    16,    16,    20,     8,     9,    10,    11,    12,    13,
-      16,     6,    17,    34,    -1,    19
+       5,     7,     3,     4,    10,    21,     6,     7,    13,     3,
+       4,     8,     9,    14,     5,    21,     6,     7,     0,    20,
+      14,    19,     3,    23,     3,     3,    31,    32,    20,    17,
+      36,    37,    38,    39,    19,    40,    41,    34,     8,     9,
+      10,    11,    12,    13,    19,    15,    16,    20,    17,     6,
+      36,    38,    22
 };
 
   /* YYSTOS[STATE-NUM] -- The (internal number of the) accessing
      symbol of state STATE-NUM.  */
 static const yytype_uint8 yystos[] =
 {
-       0,     5,    22,    18,     0,     8,     9,    10,    11,    12,
-      13,    19,    23,    23,     3,     4,    14,    24,    27,    17,
-      25,    27,    24,    24,    26,    27,    23,     6,     7,     3,
-      16,    27,    16,    17,    16,    17,    20,    23,    23,    24,
-      25,    27,    26,    27
+       0,     5,    25,    21,     0,     8,     9,    10,    11,    12,
+      13,    15,    16,    22,    26,    26,     3,     4,    14,    27,
+      30,    20,    28,    30,    27,    27,    29,    30,     3,     3,
+      26,     6,     7,     3,    19,    30,    19,    20,    19,    20,
+      17,    17,    23,    26,    26,    27,    28,    30,    29,    30,
+      26,    26
 };
 
   /* YYR1[YYN] -- Symbol number of symbol that rule YYN derives.  */
 static const yytype_uint8 yyr1[] =
 {
-       0,    21,    22,    23,    23,    23,    23,    23,    23,    23,
-      23,    23,    24,    24,    25,    25,    25,    25,    25,    26,
-      26,    26,    27,    27,    27
+       0,    24,    25,    26,    26,    26,    26,    26,    26,    26,
+      26,    26,    26,    26,    27,    27,    28,    28,    28,    28,
+      28,    29,    29,    29,    30,    30,    30
 };
 
   /* YYR2[YYN] -- Number of symbols on the right hand side of rule YYN.  */
 static const yytype_uint8 yyr2[] =
 {
        0,     2,     3,     3,     3,     3,     2,     2,     2,     2,
-       2,     2,     1,     3,     1,     3,     3,     2,     2,     1,
-       3,     3,     1,     1,     2
+       2,     2,     4,     4,     1,     3,     1,     3,     3,     2,
+       2,     1,     3,     3,     1,     1,     2
 };
 
 
@@ -1271,145 +1280,157 @@ yyreduce:
   switch (yyn)
     {
         case 2:
-#line 68 "parser.y" /* yacc.c:1646  */
+#line 72 "parser.y" /* yacc.c:1646  */
     { *expression = freesasa_selection_create((yyvsp[0].expression), (yyvsp[-2].value)); }
-#line 1277 "parser.c" /* yacc.c:1646  */
+#line 1286 "parser.c" /* yacc.c:1646  */
     break;
 
   case 3:
-#line 72 "parser.y" /* yacc.c:1646  */
+#line 76 "parser.y" /* yacc.c:1646  */
     { (yyval.expression) = (yyvsp[-1].expression); }
-#line 1283 "parser.c" /* yacc.c:1646  */
+#line 1292 "parser.c" /* yacc.c:1646  */
     break;
 
   case 4:
-#line 73 "parser.y" /* yacc.c:1646  */
+#line 77 "parser.y" /* yacc.c:1646  */
     { (yyval.expression) = freesasa_selection_operation(E_AND, (yyvsp[-2].expression), (yyvsp[0].expression)); }
-#line 1289 "parser.c" /* yacc.c:1646  */
+#line 1298 "parser.c" /* yacc.c:1646  */
     break;
 
   case 5:
-#line 74 "parser.y" /* yacc.c:1646  */
+#line 78 "parser.y" /* yacc.c:1646  */
     { (yyval.expression) = freesasa_selection_operation(E_OR, (yyvsp[-2].expression), (yyvsp[0].expression)); }
-#line 1295 "parser.c" /* yacc.c:1646  */
+#line 1304 "parser.c" /* yacc.c:1646  */
     break;
 
   case 6:
-#line 75 "parser.y" /* yacc.c:1646  */
+#line 79 "parser.y" /* yacc.c:1646  */
     { (yyval.expression) = freesasa_selection_operation(E_NOT, NULL, (yyvsp[0].expression)); }
-#line 1301 "parser.c" /* yacc.c:1646  */
+#line 1310 "parser.c" /* yacc.c:1646  */
     break;
 
   case 7:
-#line 76 "parser.y" /* yacc.c:1646  */
+#line 80 "parser.y" /* yacc.c:1646  */
     { (yyval.expression) = freesasa_selection_selector(E_RESN, (yyvsp[0].expression)); }
-#line 1307 "parser.c" /* yacc.c:1646  */
+#line 1316 "parser.c" /* yacc.c:1646  */
     break;
 
   case 8:
-#line 77 "parser.y" /* yacc.c:1646  */
+#line 81 "parser.y" /* yacc.c:1646  */
     { (yyval.expression) = freesasa_selection_selector(E_RESI, (yyvsp[0].expression)); }
-#line 1313 "parser.c" /* yacc.c:1646  */
+#line 1322 "parser.c" /* yacc.c:1646  */
     break;
 
   case 9:
-#line 78 "parser.y" /* yacc.c:1646  */
+#line 82 "parser.y" /* yacc.c:1646  */
     { (yyval.expression) = freesasa_selection_selector(E_SYMBOL, (yyvsp[0].expression)); }
-#line 1319 "parser.c" /* yacc.c:1646  */
+#line 1328 "parser.c" /* yacc.c:1646  */
     break;
 
   case 10:
-#line 79 "parser.y" /* yacc.c:1646  */
+#line 83 "parser.y" /* yacc.c:1646  */
     { (yyval.expression) = freesasa_selection_selector(E_NAME, (yyvsp[0].expression)); }
-#line 1325 "parser.c" /* yacc.c:1646  */
+#line 1334 "parser.c" /* yacc.c:1646  */
     break;
 
   case 11:
-#line 80 "parser.y" /* yacc.c:1646  */
+#line 84 "parser.y" /* yacc.c:1646  */
     { (yyval.expression) = freesasa_selection_selector(E_CHAIN, (yyvsp[0].expression)); }
-#line 1331 "parser.c" /* yacc.c:1646  */
+#line 1340 "parser.c" /* yacc.c:1646  */
     break;
 
   case 12:
-#line 84 "parser.y" /* yacc.c:1646  */
-    { (yyval.expression) = (yyvsp[0].expression); }
-#line 1337 "parser.c" /* yacc.c:1646  */
+#line 86 "parser.y" /* yacc.c:1646  */
+    { (yyval.expression) = freesasa_selection_operation(E_WITHIN, freesasa_selection_atom(E_NUMBER, (yyvsp[-2].value)), (yyvsp[0].expression)); }
+#line 1346 "parser.c" /* yacc.c:1646  */
     break;
 
   case 13:
-#line 85 "parser.y" /* yacc.c:1646  */
-    { (yyval.expression) = freesasa_selection_operation(E_PLUS, (yyvsp[-2].expression), (yyvsp[0].expression)); }
-#line 1343 "parser.c" /* yacc.c:1646  */
+#line 88 "parser.y" /* yacc.c:1646  */
+    { (yyval.expression) = freesasa_selection_operation(E_AROUND, freesasa_selection_atom(E_NUMBER, (yyvsp[-2].value)), (yyvsp[0].expression)); }
+#line 1352 "parser.c" /* yacc.c:1646  */
     break;
 
   case 14:
-#line 89 "parser.y" /* yacc.c:1646  */
+#line 92 "parser.y" /* yacc.c:1646  */
     { (yyval.expression) = (yyvsp[0].expression); }
-#line 1349 "parser.c" /* yacc.c:1646  */
+#line 1358 "parser.c" /* yacc.c:1646  */
     break;
 
   case 15:
-#line 90 "parser.y" /* yacc.c:1646  */
+#line 93 "parser.y" /* yacc.c:1646  */
     { (yyval.expression) = freesasa_selection_operation(E_PLUS, (yyvsp[-2].expression), (yyvsp[0].expression)); }
-#line 1355 "parser.c" /* yacc.c:1646  */
+#line 1364 "parser.c" /* yacc.c:1646  */
     break;
 
   case 16:
-#line 91 "parser.y" /* yacc.c:1646  */
-    { (yyval.expression) = freesasa_selection_operation(E_RANGE, (yyvsp[-2].expression), (yyvsp[0].expression)); }
-#line 1361 "parser.c" /* yacc.c:1646  */
+#line 97 "parser.y" /* yacc.c:1646  */
+    { (yyval.expression) = (yyvsp[0].expression); }
+#line 1370 "parser.c" /* yacc.c:1646  */
     break;
 
   case 17:
-#line 92 "parser.y" /* yacc.c:1646  */
-    { (yyval.expression) = freesasa_selection_operation(E_RANGE_OPEN_L, NULL, (yyvsp[0].expression)); }
-#line 1367 "parser.c" /* yacc.c:1646  */
+#line 98 "parser.y" /* yacc.c:1646  */
+    { (yyval.expression) = freesasa_selection_operation(E_PLUS, (yyvsp[-2].expression), (yyvsp[0].expression)); }
+#line 1376 "parser.c" /* yacc.c:1646  */
     break;
 
   case 18:
-#line 93 "parser.y" /* yacc.c:1646  */
-    { (yyval.expression) = freesasa_selection_operation(E_RANGE_OPEN_R, (yyvsp[-1].expression), NULL); }
-#line 1373 "parser.c" /* yacc.c:1646  */
+#line 99 "parser.y" /* yacc.c:1646  */
+    { (yyval.expression) = freesasa_selection_operation(E_RANGE, (yyvsp[-2].expression), (yyvsp[0].expression)); }
+#line 1382 "parser.c" /* yacc.c:1646  */
     break;
 
   case 19:
-#line 97 "parser.y" /* yacc.c:1646  */
-    { (yyval.expression) = (yyvsp[0].expression); }
-#line 1379 "parser.c" /* yacc.c:1646  */
+#line 100 "parser.y" /* yacc.c:1646  */
+    { (yyval.expression) = freesasa_selection_operation(E_RANGE_OPEN_L, NULL, (yyvsp[0].expression)); }
+#line 1388 "parser.c" /* yacc.c:1646  */
     break;
 
   case 20:
-#line 98 "parser.y" /* yacc.c:1646  */
-    { (yyval.expression) = freesasa_selection_operation(E_PLUS, (yyvsp[-2].expression), (yyvsp[0].expression)); }
-#line 1385 "parser.c" /* yacc.c:1646  */
+#line 101 "parser.y" /* yacc.c:1646  */
+    { (yyval.expression) = freesasa_selection_operation(E_RANGE_OPEN_R, (yyvsp[-1].expression), NULL); }
+#line 1394 "parser.c" /* yacc.c:1646  */
     break;
 
   case 21:
-#line 99 "parser.y" /* yacc.c:1646  */
-    { (yyval.expression) = freesasa_selection_operation(E_RANGE, (yyvsp[-2].expression), (yyvsp[0].expression)); }
-#line 1391 "parser.c" /* yacc.c:1646  */
+#line 105 "parser.y" /* yacc.c:1646  */
+    { (yyval.expression) = (yyvsp[0].expression); }
+#line 1400 "parser.c" /* yacc.c:1646  */
     break;
 
   case 22:
-#line 103 "parser.y" /* yacc.c:1646  */
-    { (yyval.expression) = freesasa_selection_atom(E_NUMBER, (yyvsp[0].value)); }
-#line 1397 "parser.c" /* yacc.c:1646  */
+#line 106 "parser.y" /* yacc.c:1646  */
+    { (yyval.expression) = freesasa_selection_operation(E_PLUS, (yyvsp[-2].expression), (yyvsp[0].expression)); }
+#line 1406 "parser.c" /* yacc.c:1646  */
     break;
 
   case 23:
-#line 104 "parser.y" /* yacc.c:1646  */
-    { (yyval.expression) = freesasa_selection_atom(E_ID, (yyvsp[0].value)); }
-#line 1403 "parser.c" /* yacc.c:1646  */
+#line 107 "parser.y" /* yacc.c:1646  */
+    { (yyval.expression) = freesasa_selection_operation(E_RANGE, (yyvsp[-2].expression), (yyvsp[0].expression)); }
+#line 1412 "parser.c" /* yacc.c:1646  */
     break;
 
   case 24:
-#line 105 "parser.y" /* yacc.c:1646  */
+#line 111 "parser.y" /* yacc.c:1646  */
+    { (yyval.expression) = freesasa_selection_atom(E_NUMBER, (yyvsp[0].value)); }
+#line 1418 "parser.c" /* yacc.c:1646  */
+    break;
+
+  case 25:
+#line 112 "parser.y" /* yacc.c:1646  */
+    { (yyval.expression) = freesasa_selection_atom(E_ID, (yyvsp[0].value)); }
+#line 1424 "parser.c" /* yacc.c:1646  */
+    break;
+
+  case 26:
+#line 113 "parser.y" /* yacc.c:1646  */
     { (yyval.expression) = freesasa_selection_atom(E_NEGNUM, (yyvsp[0].value)); }
-#line 1409 "parser.c" /* yacc.c:1646  */
+#line 1430 "parser.c" /* yacc.c:1646  */
     break;
 
 
-#line 1413 "parser.c" /* yacc.c:1646  */
+#line 1434 "parser.c" /* yacc.c:1646  */
       default: break;
     }
   /* User semantic actions sometimes alter yychar, and that requires
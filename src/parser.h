@@ -68,7 +68,10 @@ extern int freesasa_yydebug;
     T_NAME = 267,
     T_CHAIN = 268,
     T_MINUS = 269,
-    ATOM = 270
+    T_WITHIN = 270,
+    T_AROUND = 271,
+    T_OF = 272,
+    ATOM = 273
   };
 #endif
 
@@ -82,7 +85,7 @@ union YYSTYPE
     const char *value;
     expression *expression;
 
-#line 86 "parser.h" /* yacc.c:1909  */
+#line 89 "parser.h" /* yacc.c:1909  */
 };
 
 typedef union YYSTYPE YYSTYPE;
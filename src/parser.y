@@ -47,6 +47,10 @@
 %token T_CHAIN
 %token T_MINUS
 
+%token T_WITHIN
+%token T_AROUND
+%token T_OF
+
 %precedence ATOM
 %left T_OR
 %left T_AND
@@ -78,6 +82,10 @@ expr:
 | T_SYMBOL list          { $$ = freesasa_selection_selector(E_SYMBOL, $list); }
 | T_NAME list            { $$ = freesasa_selection_selector(E_NAME, $list); }
 | T_CHAIN c_range        { $$ = freesasa_selection_selector(E_CHAIN, $c_range); }
+| T_WITHIN T_NUMBER T_OF expr %prec T_NOT
+                         { $$ = freesasa_selection_operation(E_WITHIN, freesasa_selection_atom(E_NUMBER, $2), $4); }
+| T_AROUND T_NUMBER T_OF expr %prec T_NOT
+                         { $$ = freesasa_selection_operation(E_AROUND, freesasa_selection_atom(E_NUMBER, $2), $4); }
 ;
 
 list:
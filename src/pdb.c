@@ -285,11 +285,12 @@ write_pdb_impl(FILE *output,
                freesasa_node *structure)
 {
     char buf[PDB_LINE_STRL + 1], buf2[6];
-    int model;
+    int model, len, i, first, n, is_bb;
     double radius;
-    const char *line = NULL;
-    freesasa_node *chain = NULL, *residue = NULL, *atom = NULL;
-    const freesasa_nodearea *area = NULL;
+    const char *line = NULL, *name = NULL;
+    freesasa_node *chain = NULL, *residue = NULL;
+    freesasa_atom_class the_class;
+    const freesasa_result *result = NULL;
     const char *last_res_name = NULL, *last_res_number = NULL, *last_chain = NULL;
 
     assert(freesasa_node_type(structure) == FREESASA_NODE_STRUCTURE);
@@ -300,27 +301,33 @@ write_pdb_impl(FILE *output,
     else
         fprintf(output, "MODEL        1\n");
 
+    result = freesasa_node_structure_result(structure);
     chain = freesasa_node_children(structure);
 
-    /* Write ATOM entries */
+    /* Write ATOM entries, the atoms are read from the structure node
+       without creating the atom nodes */
     while (chain) {
         residue = freesasa_node_children(chain);
         while (residue) {
-            atom = freesasa_node_children(residue);
-            while (atom) {
-                line = freesasa_node_atom_pdb_line(atom);
-                area = freesasa_node_area(atom);
-                radius = freesasa_node_atom_radius(atom);
-
-                if (line == NULL) {
+            first = freesasa_node_residue_first_atom(residue);
+            n = freesasa_node_residue_n_atoms(residue);
+            for (i = first; i < first + n; ++i) {
+                line = freesasa_node_structure_atom_pdb_line(structure, i);
+
+                if (line == NULL ||
+                    freesasa_node_structure_atom(structure, i, &name, &radius,
+                                                 &the_class, &is_bb)) {
                     return fail_msg("PDB input not valid or not present");
                 }
 
                 strncpy(buf, line, PDB_LINE_STRL);
-                sprintf(&buf[54], "%6.2f%6.2f", radius, area->total);
-                fprintf(output, "%s\n", buf);
-
-                atom = freesasa_node_next(atom);
+                len = 54;
+                len += freesasa_format_fixed(&buf[len], sizeof buf - len, radius, 6, 2);
+                if (len < (int)sizeof buf) {
+                    freesasa_format_fixed(&buf[len], sizeof buf - len, result->sasa[i], 6, 2);
+                }
+                fputs(buf, output);
+                fputc('\n', output);
             }
             last_res_name = freesasa_node_name(residue);
             last_res_number = freesasa_node_residue_number(residue);
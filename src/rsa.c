@@ -59,19 +59,19 @@ rsa_print_abs_rel(FILE *output,
                   double abs,
                   double rel)
 {
-    fprintf(output, "%7.2f", abs);
+    freesasa_fput_fixed(output, abs, 7, 2);
     if (isfinite(rel))
-        fprintf(output, "%6.1f", rel);
+        freesasa_fput_fixed(output, rel, 6, 1);
     else
-        fprintf(output, "   N/A");
+        fputs("   N/A", output);
 }
 
 static inline void
 rsa_print_abs_only(FILE *output,
                    double abs)
 {
-    fprintf(output, "%7.2f", abs);
-    fprintf(output, "   N/A");
+    freesasa_fput_fixed(output, abs, 7, 2);
+    fputs("   N/A", output);
 }
 
 static int
@@ -101,7 +101,7 @@ rsa_print_residue(FILE *output,
         rsa_print_abs_only(output, abs->apolar);
         rsa_print_abs_only(output, abs->polar);
     }
-    fprintf(output, "\n");
+    fputc('\n', output);
     return FREESASA_SUCCESS;
 }
 
@@ -13,7 +13,6 @@
 #include <math.h>
 
 #if USE_THREADS
-#include <pthread.h>
 #define MAX_LR_THREADS 16
 #else
 #define MAX_LR_THREADS 1
@@ -24,101 +23,134 @@
 
 const double TWOPI = 2 * M_PI;
 
-/* calculation parameters and data (results stored in *sasa) */
-typedef struct {
+/* calculation parameters and buffers, kept between calculations on
+   the same atoms (results stored in *sasa) */
+struct lr_workspace {
     int n_atoms;
     double *radii; /* including probe */
     const coord_t *xyz;
-    nb_list *adj;
+    const nb_list *adj; /* neighbor list of the current calculation */
+    nb_list *own_adj;   /* used by freesasa_lr_workspace_calc() */
     int n_slices_per_atom;
     double *sasa; /* results */
     double *arc[MAX_LR_THREADS], *z_nb[MAX_LR_THREADS], *R_nb[MAX_LR_THREADS];
+    int max_nni; /* size of the arrays arc, z_nb and R_nb */
     int n_threads;
-} lr_data;
+    freesasa_thread_pool *pool;
+    const int *atoms; /* atoms to calculate, all if NULL */
+    int n_calc;       /* number of atoms to calculate */
+};
 
-typedef struct {
-    int first_atom;
-    int last_atom;
-    int thread_id;
-    lr_data *lr;
-} lr_thread_interval;
-
-#if USE_THREADS
-static int lr_do_threads(int n_threads, lr_data *);
-static void *lr_thread(void *arg);
-#endif
+static void lr_thread(void *arg, int thread_index);
 
 /** Returns the are of atom i */
 static double
-atom_area(lr_data *lr, int i, int thread_id);
+atom_area(lr_workspace *lr, int i, int thread_id);
 
 /** Sum of exposed arcs based on buried arc intervals arc, assumes no
     intervals cross zero */
 static double
 exposed_arc_length(double *restrict arc, int n);
 
-/** Release contenst of lr_data pointer*/
-static void
-release_lr(lr_data *lr)
+void freesasa_lr_workspace_free(lr_workspace *lr)
 {
     int i;
 
+    if (lr == NULL) return;
+
+    freesasa_thread_pool_free(lr->pool);
     free(lr->radii);
-    freesasa_nb_free(lr->adj);
-    lr->radii = NULL;
-    lr->adj = NULL;
+    freesasa_nb_free(lr->own_adj);
 
     for (i = 0; i < lr->n_threads; ++i) {
         free(lr->arc[i]);
         free(lr->z_nb[i]);
         free(lr->R_nb[i]);
     }
+    free(lr);
 }
 
-/* Allocate some helper arrays in area calculation that need to be pre-allocated */
+/* Allocate some helper arrays in area calculation that need to be
+   pre-allocated, only grown if the neighbor lists are longer than in
+   earlier calculations */
 static int
-alloc_lr_calc_arrays(lr_data *lr, int n_threads)
+alloc_lr_calc_arrays(lr_workspace *lr, const int *atoms, int n)
 {
-    int max_nni = 0, i, nni;
-    const int n_atoms = lr->n_atoms;
+    int max_nni = 0, i, k, nni;
+    double *arc, *z_nb, *R_nb;
 
-    for (i = 0; i < n_atoms; ++i) {
+    for (k = 0; k < n; ++k) {
+        i = atoms ? atoms[k] : k;
         nni = lr->adj->nn[i];
         max_nni = max_nni < nni ? nni : max_nni;
     }
 
-    for (i = 0; i < n_threads; ++i) {
-        lr->arc[i] = malloc(sizeof(double) * 4 * max_nni);
-        lr->z_nb[i] = malloc(sizeof(double) * max_nni);
-        lr->R_nb[i] = malloc(sizeof(double) * max_nni);
+    if (max_nni <= lr->max_nni && lr->arc[0] != NULL) {
+        return FREESASA_SUCCESS;
+    }
 
-        if (!lr->arc[i] || !lr->z_nb[i] || !lr->R_nb[i]) {
+    for (i = 0; i < lr->n_threads; ++i) {
+        arc = realloc(lr->arc[i], sizeof(double) * 4 * max_nni);
+        if (arc) lr->arc[i] = arc;
+        z_nb = realloc(lr->z_nb[i], sizeof(double) * max_nni);
+        if (z_nb) lr->z_nb[i] = z_nb;
+        R_nb = realloc(lr->R_nb[i], sizeof(double) * max_nni);
+        if (R_nb) lr->R_nb[i] = R_nb;
+
+        if (!arc || !z_nb || !R_nb) {
             return mem_fail();
         }
     }
+    lr->max_nni = max_nni;
 
     return FREESASA_SUCCESS;
 }
 
-/** Initialize object to be used for L&R calculation */
-static int
-init_lr(lr_data *lr,
-        double *sasa,
-        const coord_t *xyz,
-        const double *atom_radii,
-        double probe_radius,
-        int n_slices_per_atom,
-        int n_threads)
+lr_workspace *
+freesasa_lr_workspace_new(const double *atom_radii,
+                          int n_atoms,
+                          const freesasa_parameters *param)
 {
-    const int n_atoms = freesasa_coord_n(xyz);
-    int i;
+    int n_threads, resolution, i;
+    double probe_radius;
+    lr_workspace *lr;
+
+    assert(atom_radii);
+    assert(n_atoms > 0);
+
+    if (param == NULL) param = &freesasa_default_parameters;
+
+    n_threads = param->n_threads;
+    resolution = param->lee_richards_n_slices;
+    probe_radius = param->probe_radius;
+
+    if (n_threads > MAX_LR_THREADS) {
+        fail_msg("L&R does not support more than %d threads", MAX_LR_THREADS);
+        return NULL;
+    }
+    if (resolution <= 0) {
+        fail_msg("%d slices per atom invalid resolution in L&R, must be > 0\n", resolution);
+        return NULL;
+    }
+    if (n_threads > n_atoms) n_threads = n_atoms;
+
+    lr = malloc(sizeof(lr_workspace));
+    if (lr == NULL) {
+        mem_fail();
+        return NULL;
+    }
 
     lr->n_atoms = n_atoms;
-    lr->xyz = xyz;
+    lr->xyz = NULL;
     lr->adj = NULL;
-    lr->n_slices_per_atom = n_slices_per_atom;
-    lr->sasa = sasa;
+    lr->own_adj = NULL;
+    lr->n_slices_per_atom = resolution;
+    lr->sasa = NULL;
+    lr->max_nni = 0;
     lr->n_threads = n_threads;
+    lr->pool = NULL;
+    lr->atoms = NULL;
+    lr->n_calc = 0;
 
     for (i = 0; i < n_threads; ++i) {
         lr->arc[i] = NULL;
@@ -128,28 +160,79 @@ init_lr(lr_data *lr,
 
     lr->radii = malloc(sizeof(double) * n_atoms);
     if (lr->radii == NULL) {
-        return mem_fail();
+        mem_fail();
+        goto cleanup;
     }
 
-    /* init some arrays */
     for (i = 0; i < n_atoms; ++i) {
         lr->radii[i] = atom_radii[i] + probe_radius;
-        sasa[i] = 0.;
     }
 
-    /* determine which atoms are neighbours */
-    lr->adj = freesasa_nb_new(xyz, lr->radii);
+    lr->pool = freesasa_thread_pool_new(n_threads);
+    if (lr->pool == NULL) {
+        fail_msg("");
+        goto cleanup;
+    }
+
+    return lr;
+
+cleanup:
+    freesasa_lr_workspace_free(lr);
+    return NULL;
+}
 
-    if (lr->adj == NULL) {
-        release_lr(lr);
+int freesasa_lr_workspace_calc(lr_workspace *lr,
+                               double *sasa,
+                               const coord_t *xyz)
+{
+    assert(lr);
+    assert(sasa);
+    assert(xyz);
+    assert(freesasa_coord_n(xyz) == lr->n_atoms);
+
+    /* determine which atoms are neighbours */
+    if (lr->own_adj == NULL) {
+        lr->own_adj = freesasa_nb_new(xyz, lr->radii);
+        if (lr->own_adj == NULL) return fail_msg("");
+    } else if (freesasa_nb_update(lr->own_adj, xyz, lr->radii)) {
         return fail_msg("");
     }
 
-    if (alloc_lr_calc_arrays(lr, n_threads)) {
-        release_lr(lr);
+    return freesasa_lr_workspace_calc_atoms(lr, sasa, xyz, lr->own_adj, NULL, lr->n_atoms);
+}
+
+int freesasa_lr_workspace_calc_atoms(lr_workspace *lr,
+                                     double *sasa,
+                                     const coord_t *xyz,
+                                     const nb_list *nb,
+                                     const int *atoms,
+                                     int n)
+{
+    assert(lr);
+    assert(sasa);
+    assert(xyz);
+    assert(nb);
+    assert(atoms || n == lr->n_atoms);
+    assert(freesasa_coord_n(xyz) == lr->n_atoms);
+
+    lr->adj = nb;
+    if (alloc_lr_calc_arrays(lr, atoms, n)) {
+        lr->adj = NULL;
         return fail_msg("");
     }
 
+    lr->xyz = xyz;
+    lr->sasa = sasa;
+    lr->atoms = atoms;
+    lr->n_calc = n;
+
+    freesasa_thread_pool_run(lr->pool, lr_thread, lr);
+
+    lr->xyz = NULL;
+    lr->sasa = NULL;
+    lr->adj = NULL;
+    lr->atoms = NULL;
+
     return FREESASA_SUCCESS;
 }
 
@@ -158,9 +241,8 @@ int freesasa_lee_richards(double *sasa,
                           const double *atom_radii,
                           const freesasa_parameters *param)
 {
-    int return_value, n_atoms, n_threads, resolution, i;
-    double probe_radius;
-    lr_data lr;
+    int return_value, n_atoms;
+    lr_workspace *lr;
 
     assert(sasa);
     assert(xyz);
@@ -168,107 +250,50 @@ int freesasa_lee_richards(double *sasa,
 
     if (param == NULL) param = &freesasa_default_parameters;
 
-    return_value = FREESASA_SUCCESS;
     n_atoms = freesasa_coord_n(xyz);
-    n_threads = param->n_threads;
-    resolution = param->lee_richards_n_slices;
-    probe_radius = param->probe_radius;
-
-    if (n_threads > MAX_LR_THREADS) {
-        return fail_msg("L&R does not support more than %d threads", MAX_LR_THREADS);
-    }
-
-    if (resolution <= 0) {
-        return fail_msg("%f slices per atom invalid resolution in L&R, must be > 0\n", resolution);
-    }
 
     if (n_atoms == 0) {
         return freesasa_warn("in %s(): empty coordinates", __func__);
     }
 
-    if (n_threads > n_atoms) {
-        n_threads = n_atoms;
+    if (param->n_threads > n_atoms && param->n_threads <= MAX_LR_THREADS) {
         freesasa_warn("no sense in having more threads than atoms, only using %d threads",
-                      n_threads);
+                      n_atoms);
     }
 
-    if (init_lr(&lr, sasa, xyz, atom_radii, probe_radius, resolution, n_threads))
-        return FREESASA_FAIL;
+    lr = freesasa_lr_workspace_new(atom_radii, n_atoms, param);
+    if (lr == NULL) return FREESASA_FAIL;
 
-    if (n_threads > 1) {
-#if USE_THREADS
-        return_value = lr_do_threads(n_threads, &lr);
-#else
-        return_value = freesasa_warn("in %s(): program compiled for single-threaded use, "
-                                     "but multiple threads were requested, will "
-                                     "proceed in single-threaded mode\n",
-                                     __func__);
-        n_threads = 1;
-#endif /* pthread */
-    }
-    if (n_threads == 1) {
-        for (i = 0; i < lr.n_atoms; ++i) {
-            lr.sasa[i] = atom_area(&lr, i, 0);
-        }
-    }
-    release_lr(&lr);
-    return return_value;
-}
+    return_value = freesasa_lr_workspace_calc(lr, sasa, xyz);
 
-#if USE_THREADS
-static int
-lr_do_threads(int n_threads,
-              lr_data *lr)
-{
-    pthread_t thread[MAX_LR_THREADS];
-    lr_thread_interval t_data[MAX_LR_THREADS];
-    int n_perthread = lr->n_atoms / n_threads, res;
-    int threads_created = 0, return_value = FREESASA_SUCCESS;
-    int t;
-
-    for (t = 0; t < n_threads; ++t) {
-        t_data[t].first_atom = t * n_perthread;
-        if (t == n_threads - 1) {
-            t_data[t].last_atom = lr->n_atoms - 1;
-        } else {
-            t_data[t].last_atom = (t + 1) * n_perthread - 1;
-        }
-        t_data[t].lr = lr;
-        t_data[t].thread_id = t;
-        res = pthread_create(&thread[t], NULL, lr_thread,
-                             (void *)&t_data[t]);
-        if (res) {
-            return_value = fail_msg(freesasa_thread_error(res));
-            break;
-        }
-        ++threads_created;
-    }
-    for (int t = 0; t < threads_created; ++t) {
-        res = pthread_join(thread[t], NULL);
-        if (res) {
-            return_value = fail_msg(freesasa_thread_error(res));
-        }
-    }
+    freesasa_lr_workspace_free(lr);
     return return_value;
 }
 
-static void *
-lr_thread(void *arg)
+static void
+lr_thread(void *arg, int thread_index)
 {
-    int i;
-    lr_thread_interval *ti = ((lr_thread_interval *)arg);
+    int i, k, first, last;
+    lr_workspace *lr = ((lr_workspace *)arg);
+    int n_perthread = lr->n_calc / lr->n_threads;
+
+    first = thread_index * n_perthread;
+    if (thread_index == lr->n_threads - 1) {
+        last = lr->n_calc - 1;
+    } else {
+        last = (thread_index + 1) * n_perthread - 1;
+    }
 
-    for (i = ti->first_atom; i <= ti->last_atom; ++i) {
+    for (k = first; k <= last; ++k) {
+        i = lr->atoms ? lr->atoms[k] : k;
         /* the different threads write to different parts of the
            array, so locking shouldn't be necessary */
-        ti->lr->sasa[i] = atom_area(ti->lr, i, ti->thread_id);
+        lr->sasa[i] = atom_area(lr, i, thread_index);
     }
-    pthread_exit(NULL);
 }
-#endif /* USE_THREADS */
 
 static double
-atom_area(lr_data *lr,
+atom_area(lr_workspace *lr,
           int i,
           int thread_id)
 {
@@ -12,7 +12,6 @@
 #include <math.h>
 
 #if USE_THREADS
-#include <pthread.h>
 #define MAX_SR_THREADS 16
 #else
 #define MAX_SR_THREADS 1
@@ -27,31 +26,31 @@
 #define __attrib_pure__
 #endif
 
-/* calculation parameters (results stored in *sasa) */
-typedef struct {
-    int i1, i2; /* for multithreading, range of atoms */
-    int thread_index;
+/* calculation parameters and buffers, kept between calculations on
+   the same atoms (results stored in *sasa) */
+struct sr_workspace {
     int n_atoms;
     int n_points;
     int n_threads;
-    double probe_radius;
-    const coord_t *xyz;
     coord_t *srp;                      /* test-points */
     coord_t *tp_local[MAX_SR_THREADS]; /* coord object for storing intermediates */
     int *spcount[MAX_SR_THREADS];
     double *r;
     double *r2;
-    nb_list *nb;
+    nb_list *own_nb; /* used by freesasa_sr_workspace_calc() */
+    freesasa_thread_pool *pool;
+    /* set for each calculation */
+    const coord_t *xyz;
+    const nb_list *nb;
     double *sasa;
-} sr_data;
+    const int *atoms; /* atoms to calculate, all if NULL */
+    int n_calc;       /* number of atoms to calculate */
+};
 
-#if USE_THREADS
-static int sr_do_threads(int n_threads, sr_data *sr);
-static void *sr_thread(void *arg);
-#endif
+static void sr_thread(void *arg, int thread_index);
 
 static double
-sr_atom_area(int i, const sr_data *sr, int thread_index) __attrib_pure__;
+sr_atom_area(int i, const sr_workspace *sr, int thread_index) __attrib_pure__;
 
 static coord_t *
 test_points(int N)
@@ -89,13 +88,15 @@ cleanup:
     return NULL;
 }
 
-/* free contents */
-void release_sr(sr_data *sr)
+void freesasa_sr_workspace_free(sr_workspace *sr)
 {
     int i;
 
+    if (sr == NULL) return;
+
+    freesasa_thread_pool_free(sr->pool);
     freesasa_coord_free(sr->srp);
-    freesasa_nb_free(sr->nb);
+    freesasa_nb_free(sr->own_nb);
     free(sr->r);
     free(sr->r2);
 
@@ -103,31 +104,55 @@ void release_sr(sr_data *sr)
         freesasa_coord_free(sr->tp_local[i]);
         free(sr->spcount[i]);
     }
+    free(sr);
 }
 
-int init_sr(sr_data *sr,
-            double *sasa,
-            const coord_t *xyz,
-            const double *r,
-            double probe_radius,
-            int n_points,
-            int n_threads)
+sr_workspace *
+freesasa_sr_workspace_new(const double *r,
+                          int n_atoms,
+                          const freesasa_parameters *param)
 {
-    int n_atoms = freesasa_coord_n(xyz), i;
-    coord_t *srp = test_points(n_points);
-    double ri;
+    int n_threads, n_points, i;
+    double probe_radius, ri;
+    sr_workspace *sr;
+
+    assert(r);
+    assert(n_atoms > 0);
+
+    if (param == NULL) param = &freesasa_default_parameters;
+
+    n_threads = param->n_threads;
+    n_points = param->shrake_rupley_n_points;
+    probe_radius = param->probe_radius;
+
+    if (n_threads > MAX_SR_THREADS) {
+        fail_msg("S&R does not support more than %d threads", MAX_SR_THREADS);
+        return NULL;
+    }
+    if (n_points <= 0) {
+        fail_msg("%d test points invalid resolution in S&R, must be > 0\n", n_points);
+        return NULL;
+    }
+    if (n_threads > n_atoms) n_threads = n_atoms;
 
-    if (srp == NULL) return fail_msg("failed to initialize test points");
+    sr = malloc(sizeof(sr_workspace));
+    if (sr == NULL) {
+        mem_fail();
+        return NULL;
+    }
 
-    /* store parameters and reference arrays */
+    /* store parameters */
     sr->n_atoms = n_atoms;
     sr->n_points = n_points;
     sr->n_threads = n_threads;
-    sr->probe_radius = probe_radius;
-    sr->xyz = xyz;
-    sr->srp = srp;
-    sr->sasa = sasa;
+    sr->own_nb = NULL;
     sr->nb = NULL;
+    sr->pool = NULL;
+    sr->xyz = NULL;
+    sr->sasa = NULL;
+    sr->atoms = NULL;
+    sr->n_calc = 0;
+    sr->r = sr->r2 = NULL;
 
     /* should be done before any mallocs (to avoid problems in potential cleanup) */
     for (i = 0; i < n_threads; ++i) {
@@ -135,10 +160,19 @@ int init_sr(sr_data *sr,
         sr->spcount[i] = NULL;
     }
 
+    sr->srp = test_points(n_points);
+    if (sr->srp == NULL) {
+        fail_msg("failed to initialize test points");
+        goto cleanup;
+    }
+
     sr->r = malloc(sizeof(double) * n_atoms);
     sr->r2 = malloc(sizeof(double) * n_atoms);
 
-    if (sr->r == NULL || sr->r2 == NULL) goto cleanup;
+    if (sr->r == NULL || sr->r2 == NULL) {
+        mem_fail();
+        goto cleanup;
+    }
 
     for (i = 0; i < n_atoms; ++i) {
         ri = r[i] + probe_radius;
@@ -150,19 +184,86 @@ int init_sr(sr_data *sr,
         sr->tp_local[i] = freesasa_coord_clone(sr->srp);
         sr->spcount[i] = malloc(sizeof(int) * n_points);
         if (sr->tp_local[i] == NULL || sr->spcount[i] == NULL) {
+            mem_fail();
             goto cleanup;
         }
     }
 
+    sr->pool = freesasa_thread_pool_new(n_threads);
+    if (sr->pool == NULL) {
+        fail_msg("");
+        goto cleanup;
+    }
+
+    return sr;
+
+cleanup:
+    freesasa_sr_workspace_free(sr);
+    return NULL;
+}
+
+int freesasa_sr_workspace_calc(sr_workspace *sr,
+                               double *sasa,
+                               const coord_t *xyz)
+{
+    assert(sr);
+    assert(sasa);
+    assert(xyz);
+    assert(freesasa_coord_n(xyz) == sr->n_atoms);
+
     /* calculate distances */
-    sr->nb = freesasa_nb_new(xyz, sr->r);
-    if (sr->nb == NULL) goto cleanup;
+    if (sr->own_nb == NULL) {
+        sr->own_nb = freesasa_nb_new(xyz, sr->r);
+        if (sr->own_nb == NULL) return fail_msg("");
+    } else if (freesasa_nb_update(sr->own_nb, xyz, sr->r)) {
+        return fail_msg("");
+    }
+
+    sr->xyz = xyz;
+    sr->sasa = sasa;
+    sr->nb = sr->own_nb;
+    sr->atoms = NULL;
+    sr->n_calc = sr->n_atoms;
+
+    /* calculate SASA, the pool runs the first block in the calling
+       thread, and doesn't generate threads if only one is used */
+    freesasa_thread_pool_run(sr->pool, sr_thread, sr);
+
+    sr->xyz = NULL;
+    sr->sasa = NULL;
+    sr->nb = NULL;
 
     return FREESASA_SUCCESS;
+}
 
-cleanup:
-    release_sr(sr);
-    return mem_fail();
+int freesasa_sr_workspace_calc_atoms(sr_workspace *sr,
+                                     double *sasa,
+                                     const coord_t *xyz,
+                                     const nb_list *nb,
+                                     const int *atoms,
+                                     int n)
+{
+    assert(sr);
+    assert(sasa);
+    assert(xyz);
+    assert(nb);
+    assert(atoms || n == sr->n_atoms);
+    assert(freesasa_coord_n(xyz) == sr->n_atoms);
+
+    sr->xyz = xyz;
+    sr->sasa = sasa;
+    sr->nb = nb;
+    sr->atoms = atoms;
+    sr->n_calc = n;
+
+    freesasa_thread_pool_run(sr->pool, sr_thread, sr);
+
+    sr->xyz = NULL;
+    sr->sasa = NULL;
+    sr->nb = NULL;
+    sr->atoms = NULL;
+
+    return FREESASA_SUCCESS;
 }
 
 int freesasa_shrake_rupley(double *sasa,
@@ -170,9 +271,8 @@ int freesasa_shrake_rupley(double *sasa,
                            const double *r,
                            const freesasa_parameters *param)
 {
-    int i, n_atoms, n_threads = param->n_threads, resolution, return_value;
-    double probe_radius = param->probe_radius;
-    sr_data sr;
+    int n_atoms, return_value;
+    sr_workspace *sr;
 
     assert(sasa);
     assert(xyz);
@@ -181,101 +281,46 @@ int freesasa_shrake_rupley(double *sasa,
     if (param == NULL) param = &freesasa_default_parameters;
 
     n_atoms = freesasa_coord_n(xyz);
-    n_threads = param->n_threads;
-    resolution = param->shrake_rupley_n_points;
-    return_value = FREESASA_SUCCESS;
 
-    if (n_threads > MAX_SR_THREADS) {
-        return fail_msg("S&R does not support more than %d threads", MAX_SR_THREADS);
-    }
-    if (resolution <= 0) {
-        return fail_msg("%f test points invalid resolution in S&R, must be > 0\n", resolution);
-    }
     if (n_atoms == 0) return freesasa_warn("in %s(): empty coordinates", __func__);
-    if (n_threads > n_atoms) {
-        n_threads = n_atoms;
+    if (param->n_threads > n_atoms && param->n_threads <= MAX_SR_THREADS) {
         freesasa_warn("no sense in having more threads than atoms, only using %d threads",
-                      n_threads);
+                      n_atoms);
     }
 
-    if (init_sr(&sr, sasa, xyz, r, probe_radius, resolution, n_threads))
-        return FREESASA_FAIL;
+    sr = freesasa_sr_workspace_new(r, n_atoms, param);
+    if (sr == NULL) return FREESASA_FAIL;
 
-    /* calculate SASA */
-    if (n_threads > 1) {
-#if USE_THREADS
-        return_value = sr_do_threads(n_threads, &sr);
-#else
-        return_value = freesasa_warn("in %s(): program compiled for single-threaded use, "
-                                     "but multiple threads were requested, will "
-                                     "proceed in single-threaded mode\n",
-                                     __func__);
-        n_threads = 1;
-#endif
-    }
-    if (n_threads == 1) {
-        /* don't want the overhead of generating threads if only one is used */
-        for (i = 0; i < n_atoms; ++i) {
-            sasa[i] = sr_atom_area(i, &sr, 0);
-        }
-    }
-    release_sr(&sr);
-    return return_value;
-}
+    return_value = freesasa_sr_workspace_calc(sr, sasa, xyz);
 
-#if USE_THREADS
-static int
-sr_do_threads(int n_threads,
-              sr_data *sr)
-{
-    pthread_t thread[MAX_SR_THREADS];
-    sr_data srt[MAX_SR_THREADS];
-    int thread_block_size = sr->n_atoms / n_threads;
-    int res, return_value = FREESASA_SUCCESS;
-    int threads_created = 0, t;
-
-    /*  divide atoms evenly over threads */
-    for (t = 0; t < n_threads; ++t) {
-        srt[t] = *sr;
-        srt[t].i1 = t * thread_block_size;
-        if (t == n_threads - 1)
-            srt[t].i2 = sr->n_atoms;
-        else
-            srt[t].i2 = (t + 1) * thread_block_size;
-        srt[t].thread_index = t;
-        res = pthread_create(&thread[t], NULL, sr_thread, (void *)&srt[t]);
-        if (res) {
-            return_value = fail_msg(freesasa_thread_error(res));
-            break;
-        }
-        ++threads_created;
-    }
-    for (t = 0; t < threads_created; ++t) {
-        res = pthread_join(thread[t], NULL);
-        if (res) {
-            return_value = fail_msg(freesasa_thread_error(res));
-        }
-    }
+    freesasa_sr_workspace_free(sr);
     return return_value;
 }
 
-static void *
-sr_thread(void *arg)
+/* divide atoms evenly over threads */
+static void
+sr_thread(void *arg, int thread_index)
 {
-    int i;
-    sr_data *sr = ((sr_data *)arg);
-
-    for (i = sr->i1; i < sr->i2; ++i) {
+    int i, k, k1, k2;
+    sr_workspace *sr = ((sr_workspace *)arg);
+    int thread_block_size = sr->n_calc / sr->n_threads;
+
+    k1 = thread_index * thread_block_size;
+    if (thread_index == sr->n_threads - 1)
+        k2 = sr->n_calc;
+    else
+        k2 = (thread_index + 1) * thread_block_size;
+
+    for (k = k1; k < k2; ++k) {
+        i = sr->atoms ? sr->atoms[k] : k;
         /* mutex should not be necessary, writes to non-overlapping regions */
-        sr->sasa[i] = sr_atom_area(i, sr, sr->thread_index);
+        sr->sasa[i] = sr_atom_area(i, sr, thread_index);
     }
-    pthread_exit(NULL);
 }
-#endif
 
 static double
 sr_atom_area(int i,
-             const sr_data *sr,
+             const sr_workspace *sr,
              int thread_index)
 {
     const int n_points = sr->n_points;
@@ -294,6 +339,10 @@ sr_atom_area(int i,
     /* testpoints for this atom */
     coord_t *restrict tp_coord_ri = sr->tp_local[thread_index];
 
+    /* the whole surface of an isolated atom is exposed (and there is
+       no first neighbor to compare with) */
+    if (nni == 0) return 4.0 * M_PI * ri * ri;
+
     freesasa_coord_copy(tp_coord_ri, sr->srp);
     freesasa_coord_scale(tp_coord_ri, ri);
     freesasa_coord_translate(tp_coord_ri, vi);
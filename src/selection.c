@@ -4,9 +4,12 @@
 
 #include <assert.h>
 #include <ctype.h>
+#include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "freesasa_internal.h"
+#include "nb.h"
 #include "pdb.h"
 #include "selection.h"
 
@@ -21,12 +24,56 @@ struct freesasa_selection {
     int n_atoms;
 };
 
+/* Selections are evaluated on bitsets, one bit per atom */
+typedef uint64_t selection_word;
+#define SELECTION_WORD_BITS 64
+#define SELECTION_N_WORDS(n) (((n) + SELECTION_WORD_BITS - 1) / SELECTION_WORD_BITS)
+
 struct selection {
     const char *name;
-    int *atom;
+    selection_word *bits;
     int size;
 };
 
+/* The atom properties that selections refer to, one array per
+   property. Names are packed into integers (see pack_word()). */
+struct selection_keys {
+    int n_atoms;
+    uint64_t *name;
+    uint64_t *symbol;
+    uint64_t *resn;
+    uint64_t *resi;
+    int *resi_number;
+    char *chain;
+};
+
+enum selection_opcode { OP_ID,     /* push atoms matching id */
+                        OP_RANGE,  /* push atoms in range */
+                        OP_AND,
+                        OP_OR,
+                        OP_NOT,
+                        OP_WITHIN, /* replace top with atoms within distance of it */
+                        OP_AROUND  /* as OP_WITHIN, but excluding the atoms in top */
+};
+
+struct selection_op {
+    enum selection_opcode code;
+    expression_type property; /* E_NAME, E_RESI, etc, for OP_ID and OP_RANGE */
+    const expression *expr;   /* the id or range */
+    uint64_t key;             /* packed id */
+    double distance;          /* for OP_WITHIN and OP_AROUND */
+};
+
+/* An expression compiled to a postfix program for a stack machine
+   that operates on bitsets */
+struct selection_program {
+    const char *name;
+    struct selection_op *op;
+    int n_ops, n_alloc;
+    int stack, depth; /* current and maximum stack depth */
+    int spatial;      /* 1 if the result depends on coordinates */
+};
+
 static const char *
 e_str(expression_type e)
 {
@@ -55,6 +102,10 @@ e_str(expression_type e)
         return "or";
     case E_NOT:
         return "not";
+    case E_WITHIN:
+        return "within";
+    case E_AROUND:
+        return "around";
     case E_PLUS:
         return "< + >";
     case E_RANGE:
@@ -243,25 +294,99 @@ get_expression(const char *selector)
     return expression;
 }
 
+/* Packs the first word of str (delimited by whitespace) into an
+   integer, so that names can be compared by a single integer
+   comparison. Returns 0 for empty strings and words longer than 8
+   characters, these can not match any valid selector. */
+static uint64_t
+pack_word(const char *str)
+{
+    uint64_t key = 0;
+    int i, n;
+
+    while (isspace(*str))
+        ++str;
+    for (n = 0; str[n] != '\0' && !isspace(str[n]); ++n)
+        ;
+    if (n > 8) return 0;
+
+    for (i = 0; i < n; ++i)
+        key |= (uint64_t)(unsigned char)str[i] << (8 * i);
+
+    return key;
+}
+
+static void
+selection_keys_free(struct selection_keys *keys)
+{
+    if (keys) {
+        free(keys->name);
+        free(keys->symbol);
+        free(keys->resn);
+        free(keys->resi);
+        free(keys->resi_number);
+        free(keys->chain);
+        free(keys);
+    }
+}
+
+/* Extracts the per atom keys needed to evaluate selections */
+static struct selection_keys *
+selection_keys_new(const freesasa_structure *structure)
+{
+    struct selection_keys *keys = malloc(sizeof(struct selection_keys));
+    int i, n = freesasa_structure_n(structure);
+    const char *resi;
+
+    if (keys == NULL) {
+        mem_fail();
+        return NULL;
+    }
+
+    keys->n_atoms = n;
+    keys->name = malloc(sizeof(uint64_t) * (n + 1));
+    keys->symbol = malloc(sizeof(uint64_t) * (n + 1));
+    keys->resn = malloc(sizeof(uint64_t) * (n + 1));
+    keys->resi = malloc(sizeof(uint64_t) * (n + 1));
+    keys->resi_number = malloc(sizeof(int) * (n + 1));
+    keys->chain = malloc(n + 1);
+
+    if (keys->name == NULL || keys->symbol == NULL || keys->resn == NULL ||
+        keys->resi == NULL || keys->resi_number == NULL || keys->chain == NULL) {
+        mem_fail();
+        selection_keys_free(keys);
+        return NULL;
+    }
+
+    for (i = 0; i < n; ++i) {
+        resi = freesasa_structure_atom_res_number(structure, i);
+        keys->name[i] = pack_word(freesasa_structure_atom_name(structure, i));
+        keys->symbol[i] = pack_word(freesasa_structure_atom_symbol(structure, i));
+        keys->resn[i] = pack_word(freesasa_structure_atom_res_name(structure, i));
+        keys->resi[i] = pack_word(resi);
+        keys->resi_number[i] = atoi(resi);
+        keys->chain[i] = freesasa_structure_atom_chain(structure, i);
+    }
+
+    return keys;
+}
+
 static struct selection *
 selection_new(int n)
 {
     struct selection *selection = malloc(sizeof(struct selection));
-    int i;
 
     if (selection == NULL) {
         mem_fail();
     } else {
+        selection->name = NULL;
         selection->size = n;
-        selection->atom = malloc(sizeof(int) * n);
+        selection->bits = calloc(SELECTION_N_WORDS(n) + 1, sizeof(selection_word));
 
-        if (selection->atom == NULL) {
+        if (selection->bits == NULL) {
             free(selection);
             mem_fail();
             selection = NULL;
-        } else {
-            for (i = 0; i < n; ++i)
-                selection->atom[i] = 0;
         }
     }
 
@@ -272,107 +397,205 @@ static void
 selection_free(struct selection *selection)
 {
     if (selection) {
-        free(selection->atom);
+        free(selection->bits);
         free(selection);
     }
 }
 
-/* Looks for exact match between the atom-name and expr->value */
 static int
-match_name(const freesasa_structure *structure,
-           const char *id,
-           int i)
+selection_has_atom(const struct selection *selection,
+                   int i)
 {
-    char atom[PDB_ATOM_NAME_STRL + 1];
-    sscanf(freesasa_structure_atom_name(structure, i), "%s", atom);
-    if (strcmp(atom, id) == 0)
-        return 1;
-    return 0;
+    return (selection->bits[i / SELECTION_WORD_BITS] >> (i % SELECTION_WORD_BITS)) & 1;
 }
 
-/** Looks for match of strlen(expr->value) first characters of atom-name and expr->value */
+static void
+selection_program_free(struct selection_program *program)
+{
+    if (program) {
+        free(program->op);
+        free(program);
+    }
+}
+
+/* Appends an instruction, keeping track of the stack depth needed to
+   evaluate the program */
 static int
-match_symbol(const freesasa_structure *structure,
-             const char *id,
-             int i)
+program_emit(struct selection_program *program,
+             enum selection_opcode code,
+             expression_type property,
+             const expression *expr)
 {
-    char symbol[PDB_ATOM_SYMBOL_STRL + 1];
-    sscanf(freesasa_structure_atom_symbol(structure, i), "%s", symbol);
-    if (strcmp(id, symbol) == 0) {
-        return 1;
+    struct selection_op *op;
+
+    if (program->n_ops == program->n_alloc) {
+        program->n_alloc = program->n_alloc ? 2 * program->n_alloc : 16;
+        op = realloc(program->op, sizeof(struct selection_op) * program->n_alloc);
+        if (op == NULL) return mem_fail();
+        program->op = op;
     }
-    return 0;
+
+    op = &program->op[program->n_ops++];
+    op->code = code;
+    op->property = property;
+    op->expr = expr;
+    op->key = 0;
+    op->distance = 0;
+
+    switch (code) {
+    case OP_ID:
+        op->key = pack_word(expr->value);
+        /* fall through */
+    case OP_RANGE:
+        ++program->stack;
+        if (program->stack > program->depth) program->depth = program->stack;
+        break;
+    case OP_AND:
+    case OP_OR:
+        --program->stack;
+        break;
+    case OP_NOT:
+        break;
+    case OP_WITHIN:
+    case OP_AROUND:
+        op->distance = strtod(expr->left->value, NULL);
+        program->spatial = 1;
+        break;
+    }
+
+    return FREESASA_SUCCESS;
 }
 
+/* Compiles a list of ids and ranges for a selector such as 'resn' */
 static int
-match_resn(const freesasa_structure *structure,
-           const char *id,
-           int i)
+compile_list(struct selection_program *program,
+             expression_type parent_type,
+             const expression *expr)
 {
-    char resn[PDB_ATOM_RES_NAME_STRL + 1];
-    sscanf(freesasa_structure_atom_res_name(structure, i), "%s", resn);
-    if (strcmp(resn, id) == 0)
-        return 1;
-    return 0;
+    expression *left, *right;
+
+    if (expr == NULL)
+        return fail_msg("NULL expression");
+
+    left = expr->left;
+    right = expr->right;
+
+    switch (expr->type) {
+    case E_PLUS:
+        if (left == NULL || right == NULL)
+            return fail_msg("NULL expression");
+        if (compile_list(program, parent_type, left) ||
+            compile_list(program, parent_type, right))
+            return FREESASA_FAIL;
+        return program_emit(program, OP_OR, parent_type, expr);
+    case E_RANGE:
+        if (left == NULL || right == NULL)
+            return fail_msg("NULL expression");
+        return program_emit(program, OP_RANGE, parent_type, expr);
+    case E_RANGE_OPEN_L:
+        if (left != NULL || right == NULL)
+            return fail_msg("NULL expression");
+        return program_emit(program, OP_RANGE, parent_type, expr);
+    case E_RANGE_OPEN_R:
+        if (left == NULL || right != NULL)
+            return fail_msg("NULL expression");
+        return program_emit(program, OP_RANGE, parent_type, expr);
+    case E_ID:
+    case E_NUMBER:
+        return program_emit(program, OP_ID, parent_type, expr);
+    default:
+        return freesasa_fail("select: parse error (expression: '%s %s')",
+                             e_str(parent_type), e_str(expr->type));
+    }
 }
 
+/* Non-negative decimal numbers */
 static int
-match_resi(const freesasa_structure *structure,
-           const char *id,
-           int i)
+is_valid_distance(const char *value)
 {
-    char resi[PDB_ATOM_RES_NUMBER_STRL + 1];
-    sscanf(freesasa_structure_atom_res_number(structure, i), "%s", resi);
-    if (strcmp(resi, id) == 0)
-        return 1;
-    return 0;
+    char *end;
+    double d = strtod(value, &end);
+
+    return end != value && *end == '\0' && d >= 0;
 }
 
+/* Called recursively, the program is emitted in postfix order as we
+   cover the expression tree */
 static int
-match_chain(const freesasa_structure *structure,
-            const char *id,
-            int i)
+compile_expression(struct selection_program *program,
+                   const expression *expr)
 {
-    return id[0] == freesasa_structure_atom_chain(structure, i);
+    /* this should only happen if memory allocation failed during parsing */
+    if (expr == NULL) return fail_msg("NULL expression");
+
+    switch (expr->type) {
+    case E_SELECTION:
+        assert(expr->value != NULL);
+        program->name = expr->value;
+        return compile_expression(program, expr->left);
+    case E_SYMBOL:
+    case E_NAME:
+    case E_RESN:
+    case E_RESI:
+    case E_CHAIN:
+        return compile_list(program, expr->type, expr->left);
+    case E_AND:
+    case E_OR:
+        if (compile_expression(program, expr->left) ||
+            compile_expression(program, expr->right))
+            return fail_msg("error joining selections");
+        return program_emit(program, expr->type == E_AND ? OP_AND : OP_OR,
+                            expr->type, expr);
+    case E_NOT:
+        if (compile_expression(program, expr->right))
+            return FREESASA_FAIL;
+        return program_emit(program, OP_NOT, E_NOT, expr);
+    case E_WITHIN:
+    case E_AROUND:
+        if (expr->left == NULL || expr->left->type != E_NUMBER)
+            return fail_msg("NULL expression");
+        if (!is_valid_distance(expr->left->value))
+            return freesasa_fail("select: %s: '%s' is not a valid distance",
+                                 e_str(expr->type), expr->left->value);
+        if (compile_expression(program, expr->right))
+            return FREESASA_FAIL;
+        return program_emit(program, expr->type == E_WITHIN ? OP_WITHIN : OP_AROUND,
+                            expr->type, expr);
+    case E_ID:
+    case E_NUMBER:
+    case E_PLUS:
+    case E_RANGE:
+        /* these four are handled by the RESN,SYMBOL,ETC */
+    default:
+        return fail_msg("parser error");
+    }
 }
 
-static void
-select_id(expression_type parent_type,
-          struct selection *selection,
-          const freesasa_structure *structure,
-          const char *id)
+/* Compiles the expression, the program refers to the expression and
+   is only valid as long as the expression is. */
+static struct selection_program *
+selection_program_new(const expression *expr)
 {
-    int count = 0, match, i;
+    struct selection_program *program = malloc(sizeof(struct selection_program));
 
-    assert(id);
+    if (program == NULL) {
+        mem_fail();
+        return NULL;
+    }
 
-    for (i = 0; i < selection->size; ++i) {
-        match = 0;
-        switch (parent_type) {
-        case E_NAME:
-            match = match_name(structure, id, i);
-            break;
-        case E_SYMBOL:
-            match = match_symbol(structure, id, i);
-            break;
-        case E_RESN:
-            match = match_resn(structure, id, i);
-            break;
-        case E_RESI:
-            match = match_resi(structure, id, i);
-            break;
-        case E_CHAIN:
-            match = match_chain(structure, id, i);
-            break;
-        default:
-            assert(0);
-            break;
-        }
-        if (match) selection->atom[i] = 1;
-        count += match;
+    program->name = NULL;
+    program->op = NULL;
+    program->n_ops = program->n_alloc = 0;
+    program->depth = program->stack = 0;
+    program->spatial = 0;
+
+    if (compile_expression(program, expr)) {
+        selection_program_free(program);
+        return NULL;
     }
-    if (count == 0) freesasa_warn("Found no matches to %s '%s', typo?",
-                                  e_str(parent_type), id);
+    assert(program->stack == 1);
+
+    return program;
 }
 
 static int
@@ -454,11 +677,57 @@ is_valid_id(int parent_type,
     return FREESASA_SUCCESS;
 }
 
+
+/* Sets the bits of the atoms that match the id */
+static void
+select_id(expression_type parent_type,
+          selection_word *bits,
+          const struct selection_keys *keys,
+          const expression *expr,
+          uint64_t key)
+{
+    const uint64_t *column = NULL;
+    int count = 0, match, i;
+    char chain = expr->value[0];
+
+    switch (parent_type) {
+    case E_NAME:
+        column = keys->name;
+        break;
+    case E_SYMBOL:
+        column = keys->symbol;
+        break;
+    case E_RESN:
+        column = keys->resn;
+        break;
+    case E_RESI:
+        column = keys->resi;
+        break;
+    case E_CHAIN:
+        break;
+    default:
+        assert(0);
+        break;
+    }
+
+    for (i = 0; i < keys->n_atoms; ++i) {
+        if (column)
+            match = column[i] == key;
+        else
+            match = keys->chain[i] == chain;
+        bits[i / SELECTION_WORD_BITS] |= (selection_word)match << (i % SELECTION_WORD_BITS);
+        count += match;
+    }
+    if (count == 0) freesasa_warn("Found no matches to %s '%s', typo?",
+                                  e_str(parent_type), expr->value);
+}
+
+/* Sets the bits of the atoms in the range */
 static int
 select_range(expression_type range_type,
              expression_type parent_type,
-             struct selection *selection,
-             const freesasa_structure *structure,
+             selection_word *bits,
+             const struct selection_keys *keys,
              const expression *left,
              const expression *right)
 {
@@ -472,21 +741,25 @@ select_range(expression_type range_type,
             (right && right->type != E_NUMBER)) {
             return freesasa_warn("select: %s: range '%s-%s' invalid, needs to be two numbers, "
                                  "will be ignored",
-                                 e_str(parent_type), left->value, right->value);
+                                 e_str(parent_type),
+                                 left ? left->value : "", right ? right->value : "");
         }
     } else { /* chains can be numbered by both letters (common) and numbers (uncommon) */
-        if (left->type != right->type ||
+        if (left == NULL || right == NULL || left->type != right->type ||
             (left->type == E_ID && (strlen(left->value) > 1 || strlen(right->value) > 1)))
             return freesasa_warn("select: %s: range '%s-%s' invalid, should be two letters (A-C) or numbers (1-5), "
                                  "will be ignored",
-                                 e_str(parent_type), left->value, right->value);
+                                 e_str(parent_type),
+                                 left ? left->value : "", right ? right->value : "");
     }
+    if (keys->n_atoms == 0) return FREESASA_SUCCESS;
+
     if (range_type == E_RANGE_OPEN_L) {
-        lower = atoi(freesasa_structure_atom_res_number(structure, 0));
+        lower = keys->resi_number[0];
         upper = atoi(right->value);
     } else if (range_type == E_RANGE_OPEN_R) {
         lower = atoi(left->value);
-        upper = atoi(freesasa_structure_atom_res_number(structure, freesasa_structure_n(structure) - 1));
+        upper = keys->resi_number[keys->n_atoms - 1];
     } else if (left->type == E_NUMBER) {
         lower = atoi(left->value);
         upper = atoi(right->value);
@@ -494,204 +767,267 @@ select_range(expression_type range_type,
         lower = (int)left->value[0];
         upper = (int)right->value[0];
     }
-    for (i = 0; i < selection->size; ++i) {
+    for (i = 0; i < keys->n_atoms; ++i) {
         if (parent_type == E_RESI)
-            j = atoi(freesasa_structure_atom_res_number(structure, i));
+            j = keys->resi_number[i];
         else
-            j = (int)freesasa_structure_atom_chain(structure, i);
+            j = (int)keys->chain[i];
         if (j >= lower && j <= upper)
-            selection->atom[i] = 1;
+            bits[i / SELECTION_WORD_BITS] |= (selection_word)1 << (i % SELECTION_WORD_BITS);
     }
     return FREESASA_SUCCESS;
 }
 
+/* Replaces the bits with the atoms within distance of the atoms
+   in bits. If exclude is set, the original atoms are excluded. */
 static int
-select_list(expression_type parent_type,
-            struct selection *selection,
-            const freesasa_structure *structure,
-            const expression *expr)
+select_within(selection_word *bits,
+              const coord_t *xyz,
+              double distance,
+              int exclude)
 {
-    int resr, resl;
-    expression *left, *right;
+    const int n = freesasa_coord_n(xyz);
+    char *source = malloc(n + 1), *target = malloc(n + 1);
+    int i, ret = FREESASA_FAIL;
 
-    if (expr == NULL)
-        return fail_msg("NULL expression");
+    if (source == NULL || target == NULL) {
+        mem_fail();
+        goto cleanup;
+    }
 
-    left = expr->left;
-    right = expr->right;
+    for (i = 0; i < n; ++i)
+        source[i] = (bits[i / SELECTION_WORD_BITS] >> (i % SELECTION_WORD_BITS)) & 1;
 
-    switch (expr->type) {
-    case E_PLUS:
-        if (left == NULL || right == NULL)
-            return fail_msg("NULL expression");
-        resl = select_list(parent_type, selection, structure, left);
-        resr = select_list(parent_type, selection, structure, right);
-        if (resl == FREESASA_WARN || resr == FREESASA_WARN)
-            return FREESASA_WARN;
-        break;
-    case E_RANGE:
-        if (left == NULL || right == NULL)
-            return fail_msg("NULL expression");
-        return select_range(E_RANGE, parent_type, selection, structure, left, right);
-    case E_RANGE_OPEN_L:
-        if (left != NULL || right == NULL)
-            return fail_msg("NULL expression");
-        return select_range(E_RANGE_OPEN_L, parent_type, selection, structure, left, right);
-    case E_RANGE_OPEN_R:
-        if (left == NULL || right != NULL)
-            return fail_msg("NULL expression");
-        return select_range(E_RANGE_OPEN_R, parent_type, selection, structure, left, right);
-    case E_ID:
-    case E_NUMBER:
-        if (is_valid_id(parent_type, expr) == FREESASA_SUCCESS)
-            select_id(parent_type, selection, structure, expr->value);
-        else
-            return freesasa_warn("select: %s: '%s' invalid %s",
-                                 e_str(parent_type), expr->value, e_str(expr->type));
-        break;
-    default:
-        return freesasa_fail("select: parse error (expression: '%s %s')",
-                             e_str(parent_type), e_str(expr->type));
+    if (freesasa_nb_within(xyz, distance, source, target))
+        goto cleanup;
+
+    memset(bits, 0, sizeof(selection_word) * SELECTION_N_WORDS(n));
+    for (i = 0; i < n; ++i) {
+        if (target[i] && !(exclude && source[i]))
+            bits[i / SELECTION_WORD_BITS] |= (selection_word)1 << (i % SELECTION_WORD_BITS);
     }
-    return FREESASA_SUCCESS;
+    ret = FREESASA_SUCCESS;
+
+cleanup:
+    free(source);
+    free(target);
+    return ret;
 }
 
+/* Runs the program on a stack of bitsets, the result is stored in
+   selection. The coordinates are only used by spatial selections. */
 static int
-selection_join(struct selection *target,
-               const struct selection *s1,
-               const struct selection *s2,
-               int type)
+selection_program_eval(struct selection *selection,
+                       const struct selection_program *program,
+                       const struct selection_keys *keys,
+                       const coord_t *xyz)
 {
-    int n, i;
+    const int n_words = SELECTION_N_WORDS(keys->n_atoms);
+    const int stride = n_words + 1;
+    const int tail = keys->n_atoms % SELECTION_WORD_BITS;
+    const struct selection_op *op;
+    selection_word *stack, *top, *below;
+    int i, k, depth = -1, warn = 0;
+
+    assert(selection->size == keys->n_atoms);
+
+    stack = malloc(sizeof(selection_word) * stride * program->depth);
+    if (stack == NULL) return mem_fail();
+
+    for (i = 0; i < program->n_ops; ++i) {
+        op = &program->op[i];
+        switch (op->code) {
+        case OP_ID:
+        case OP_RANGE:
+            top = stack + stride * ++depth;
+            memset(top, 0, sizeof(selection_word) * stride);
+            if (op->code == OP_RANGE) {
+                if (select_range(op->expr->type, op->property, top, keys,
+                                 op->expr->left, op->expr->right))
+                    ++warn;
+            } else if (is_valid_id(op->property, op->expr) == FREESASA_SUCCESS) {
+                select_id(op->property, top, keys, op->expr, op->key);
+            } else {
+                freesasa_warn("select: %s: '%s' invalid %s",
+                              e_str(op->property), op->expr->value, e_str(op->expr->type));
+                ++warn;
+            }
+            break;
+        case OP_AND:
+            top = stack + stride * depth--;
+            below = top - stride;
+            for (k = 0; k < n_words; ++k)
+                below[k] &= top[k];
+            break;
+        case OP_OR:
+            top = stack + stride * depth--;
+            below = top - stride;
+            for (k = 0; k < n_words; ++k)
+                below[k] |= top[k];
+            break;
+        case OP_NOT:
+            top = stack + stride * depth;
+            for (k = 0; k < n_words; ++k)
+                top[k] = ~top[k];
+            if (tail) top[n_words - 1] &= ((selection_word)1 << tail) - 1;
+            break;
+        case OP_WITHIN:
+        case OP_AROUND:
+            top = stack + stride * depth;
+            assert(freesasa_coord_n(xyz) == keys->n_atoms);
+            if (select_within(top, xyz, op->distance, op->code == OP_AROUND)) {
+                free(stack);
+                return fail_msg("");
+            }
+            break;
+        }
+    }
+    assert(depth == 0);
 
-    if (s1 == NULL || s2 == NULL || target == NULL)
-        return fail_msg("trying to join NULL selections");
+    memcpy(selection->bits, stack, sizeof(selection_word) * n_words);
+    selection->name = program->name;
+    free(stack);
 
-    assert(s1->size == s2->size);
-    assert(s1->size == target->size);
+    if (warn) return FREESASA_WARN;
+    return FREESASA_SUCCESS;
+}
 
-    n = target->size;
+struct freesasa_compiled_selection {
+    char *command;
+    expression *expression;
+    struct selection_program *program;
+    /* the last evaluation, reused for structures with the same atoms */
+    struct selection_keys *keys;
+    struct selection *selection;
+    int status;
+};
 
-    switch (type) {
-    case E_AND:
-        for (i = 0; i < n; ++i)
-            target->atom[i] = s1->atom[i] && s2->atom[i];
-        break;
-    case E_OR:
-        for (i = 0; i < n; ++i)
-            target->atom[i] = s1->atom[i] || s2->atom[i];
-        break;
-    default:
-        assert(0);
+void freesasa_compiled_selection_free(freesasa_compiled_selection *compiled)
+{
+    if (compiled) {
+        free(compiled->command);
+        expression_free(compiled->expression);
+        selection_program_free(compiled->program);
+        selection_keys_free(compiled->keys);
+        selection_free(compiled->selection);
+        free(compiled);
     }
-
-    return FREESASA_SUCCESS;
 }
 
-static int
-selection_not(struct selection *s)
+freesasa_compiled_selection *
+freesasa_selection_compile(const char *command)
 {
-    int i;
+    freesasa_compiled_selection *compiled;
 
-    if (s == NULL) return fail_msg("NULL selection");
+    assert(command);
 
-    for (i = 0; i < s->size; ++i) {
-        s->atom[i] = !s->atom[i];
+    compiled = malloc(sizeof(freesasa_compiled_selection));
+    if (compiled == NULL) {
+        mem_fail();
+        return NULL;
     }
 
-    return FREESASA_SUCCESS;
-}
+    compiled->expression = NULL;
+    compiled->program = NULL;
+    compiled->keys = NULL;
+    compiled->selection = NULL;
+    compiled->status = FREESASA_SUCCESS;
 
-/* Called recursively, the selection is built as we cover the expression tree */
-static int
-select_atoms(struct selection *selection,
-             const expression *expr,
-             const freesasa_structure *structure)
-{
-    int warn = 0, err = 0, n, ret;
-    struct selection *sl, *sr;
+    compiled->command = strdup(command);
+    if (compiled->command == NULL) {
+        mem_fail();
+        goto cleanup;
+    }
 
-    assert(selection);
-    assert(structure);
+    compiled->expression = get_expression(command);
+    if (compiled->expression == NULL) goto parse_error;
 
-    n = selection->size;
+    compiled->program = selection_program_new(compiled->expression);
+    if (compiled->program == NULL) goto parse_error;
 
-    /* this should only happen if memory allocation failed during parsing */
-    if (expr == NULL) return fail_msg("NULL expression");
+    return compiled;
 
-    switch (expr->type) {
-    case E_SELECTION:
-        assert(expr->value != NULL);
-        selection->name = expr->value;
-        return select_atoms(selection, expr->left, structure);
-        break;
-    case E_SYMBOL:
-    case E_NAME:
-    case E_RESN:
-    case E_RESI:
-    case E_CHAIN:
-        return select_list(expr->type, selection, structure, expr->left);
-        break;
-    case E_AND:
-    case E_OR: {
-        sl = selection_new(n);
-        sr = selection_new(n);
-
-        if (sl != NULL && sr != NULL) {
-            if ((ret = select_atoms(sl, expr->left, structure))) {
-                if (ret == FREESASA_WARN) ++warn;
-                if (ret == FREESASA_FAIL) ++err;
-            }
-            if ((ret = select_atoms(sr, expr->right, structure))) {
-                if (ret == FREESASA_WARN) ++warn;
-                if (ret == FREESASA_FAIL) ++err;
-            }
-            selection_join(selection, sl, sr, expr->type);
-        } else {
-            ++err;
-        }
+parse_error:
+    fail_msg("problems parsing expression '%s'", command);
+cleanup:
+    freesasa_compiled_selection_free(compiled);
+    return NULL;
+}
+
+static int
+selection_keys_equal(const struct selection_keys *a,
+                     const struct selection_keys *b)
+{
+    int n = a->n_atoms;
+
+    return a->n_atoms == b->n_atoms &&
+           memcmp(a->name, b->name, sizeof(uint64_t) * n) == 0 &&
+           memcmp(a->symbol, b->symbol, sizeof(uint64_t) * n) == 0 &&
+           memcmp(a->resn, b->resn, sizeof(uint64_t) * n) == 0 &&
+           memcmp(a->resi, b->resi, sizeof(uint64_t) * n) == 0 &&
+           memcmp(a->resi_number, b->resi_number, sizeof(int) * n) == 0 &&
+           memcmp(a->chain, b->chain, n) == 0;
+}
 
-        selection_free(sl);
-        selection_free(sr);
+/* Evaluates the selection for the structure. If the structure has
+   the same atoms as in the previous call (such as different models
+   from an NMR structure), the previous result is reused, and no
+   warnings are repeated. Spatial selections are always evaluated. */
+static int
+compiled_select(freesasa_compiled_selection *compiled,
+                const freesasa_structure *structure)
+{
+    struct selection_keys *keys;
+    struct selection *selection;
+    int ret;
 
-        if (err) return fail_msg("error joining selections");
-        break;
+    keys = selection_keys_new(structure);
+    if (keys == NULL) return fail_msg("");
+
+    if (compiled->keys != NULL && !compiled->program->spatial &&
+        selection_keys_equal(keys, compiled->keys)) {
+        selection_keys_free(keys);
+        return compiled->status;
     }
-    case E_NOT: {
-        ret = select_atoms(selection, expr->right, structure);
-        if (ret == FREESASA_WARN) ++warn;
-        if (ret == FREESASA_FAIL) return FREESASA_FAIL;
-        if (selection_not(selection)) return FREESASA_FAIL;
-        break;
+
+    selection = selection_new(keys->n_atoms);
+    if (selection == NULL) {
+        selection_keys_free(keys);
+        return fail_msg("");
     }
-    case E_ID:
-    case E_NUMBER:
-    case E_PLUS:
-    case E_RANGE:
-        /* these four are handled by the RESN,SYMBOL,ETC */
-    default:
-        return fail_msg("parser error");
+
+    ret = selection_program_eval(selection, compiled->program, keys,
+                                 freesasa_structure_xyz(structure));
+    if (ret == FREESASA_FAIL) {
+        selection_keys_free(keys);
+        selection_free(selection);
+        return fail_msg("");
     }
-    if (warn) return FREESASA_WARN;
-    return FREESASA_SUCCESS;
+
+    selection_keys_free(compiled->keys);
+    selection_free(compiled->selection);
+    compiled->keys = keys;
+    compiled->selection = selection;
+    compiled->status = ret;
+
+    return ret;
 }
 
 static int
-select_area_impl(const char *command,
+select_area_impl(freesasa_compiled_selection *compiled,
                  char *name,
                  double *area,
                  const freesasa_structure *structure,
                  const freesasa_result *result)
 {
-    struct selection *selection = NULL;
-    struct expression *expression = NULL;
+    const struct selection *selection;
     const int maxlen = FREESASA_MAX_SELECTION_NAME;
     double sasa = 0;
-    int err = 0, warn = 0, n_atoms = 0, j, len;
+    int warn = 0, n_atoms = 0, j, len;
 
     assert(name);
     assert(area);
-    assert(command);
+    assert(compiled);
     assert(structure);
     assert(result);
     assert(freesasa_structure_n(structure) == result->n_atoms);
@@ -699,49 +1035,34 @@ select_area_impl(const char *command,
     *area = 0;
     name[0] = '\0';
 
-    expression = get_expression(command);
-    selection = selection_new(result->n_atoms);
-
-    if (selection == NULL) {
-        return fail_msg("");
+    switch (compiled_select(compiled, structure)) {
+    case FREESASA_FAIL:
+        return fail_msg("problems evaluating expression '%s'", compiled->command);
+    case FREESASA_WARN:
+        warn = 1; /* proceed with calculation, print warning later */
+    case FREESASA_SUCCESS:
+        break;
+    default:
+        assert(0);
     }
 
-    if (expression != NULL && selection != NULL) {
-        switch (select_atoms(selection, expression, structure)) {
-        case FREESASA_FAIL:
-            err = 1;
-            break;
-        case FREESASA_WARN:
-            warn = 1; /* proceed with calculation, print warning later */
-        case FREESASA_SUCCESS: {
-            for (j = 0; j < selection->size; ++j) {
-                ++n_atoms;
-                sasa += selection->atom[j] * result->sasa[j];
-            }
-
-            *area = sasa;
-            len = strlen(selection->name);
-            if (len > maxlen) {
-                strncpy(name, selection->name, maxlen);
-                name[maxlen] = '\0';
-            } else {
-                strncpy(name, selection->name, len);
-                name[len] = '\0';
-            }
+    selection = compiled->selection;
+    for (j = 0; j < selection->size; ++j) {
+        ++n_atoms;
+        if (selection_has_atom(selection, j))
+            sasa += result->sasa[j];
+    }
 
-            break;
-        }
-        default:
-            assert(0);
-        }
+    *area = sasa;
+    len = strlen(selection->name);
+    if (len > maxlen) {
+        strncpy(name, selection->name, maxlen);
+        name[maxlen] = '\0';
     } else {
-        err = 1;
+        strncpy(name, selection->name, len);
+        name[len] = '\0';
     }
-    selection_free(selection);
-    expression_free(expression);
 
-    if (err)
-        return fail_msg("problems parsing expression '%s'", command);
     if (warn)
         return freesasa_warn("in %s(): There were warnings", __func__);
     return n_atoms;
@@ -832,23 +1153,23 @@ freesasa_selection_area(const freesasa_selection *selection)
 }
 
 freesasa_selection *
-freesasa_selection_new(const char *command,
-                       const freesasa_structure *structure,
-                       const freesasa_result *result)
+freesasa_compiled_selection_eval(freesasa_compiled_selection *compiled,
+                                 const freesasa_structure *structure,
+                                 const freesasa_result *result)
 {
-    char name[FREESASA_MAX_SELECTION_NAME];
+    char name[FREESASA_MAX_SELECTION_NAME + 1];
     double area;
     freesasa_selection *selection;
     int n_atoms;
 
-    n_atoms = select_area_impl(command, name, &area, structure, result);
+    n_atoms = select_area_impl(compiled, name, &area, structure, result);
 
     if (n_atoms == FREESASA_FAIL) {
         fail_msg("");
         return NULL;
     }
 
-    selection = freesasa_selection_alloc(name, command);
+    selection = freesasa_selection_alloc(name, compiled->command);
     if (selection == NULL) {
         mem_fail();
         return NULL;
@@ -860,13 +1181,42 @@ freesasa_selection_new(const char *command,
     return selection;
 }
 
+freesasa_selection *
+freesasa_selection_new(const char *command,
+                       const freesasa_structure *structure,
+                       const freesasa_result *result)
+{
+    freesasa_compiled_selection *compiled = freesasa_selection_compile(command);
+    freesasa_selection *selection;
+
+    if (compiled == NULL) {
+        fail_msg("");
+        return NULL;
+    }
+
+    selection = freesasa_compiled_selection_eval(compiled, structure, result);
+    freesasa_compiled_selection_free(compiled);
+
+    return selection;
+}
+
 int freesasa_select_area(const char *command,
                          char *name,
                          double *area,
                          const freesasa_structure *structure,
                          const freesasa_result *result)
 {
-    int ret = select_area_impl(command, name, area, structure, result);
+    freesasa_compiled_selection *compiled = freesasa_selection_compile(command);
+    int ret;
+
+    *area = 0;
+    name[0] = '\0';
+
+    if (compiled == NULL) return fail_msg("");
+
+    ret = select_area_impl(compiled, name, area, structure, result);
+    freesasa_compiled_selection_free(compiled);
+
     if (ret >= 0) return FREESASA_SUCCESS;
     return ret;
 }
@@ -883,23 +1233,53 @@ int freesasa_selection_parse_error(expression *e,
 #if USE_CHECK
 #include <check.h>
 
+/* Compiles and evaluates the expression in one go, only used by the
+   tests, the library keeps the program in a compiled selection */
+static int
+select_atoms(struct selection *selection,
+             const expression *expr,
+             const freesasa_structure *structure)
+{
+    struct selection_program *program = NULL;
+    struct selection_keys *keys = NULL;
+    int ret = FREESASA_FAIL;
+
+    assert(selection);
+    assert(structure);
+
+    program = selection_program_new(expr);
+    if (program == NULL) goto cleanup;
+
+    keys = selection_keys_new(structure);
+    if (keys == NULL) goto cleanup;
+
+    ret = selection_program_eval(selection, program, keys,
+                                 freesasa_structure_xyz(structure));
+
+cleanup:
+    selection_program_free(program);
+    selection_keys_free(keys);
+    return ret;
+}
+
 START_TEST(test_selection)
 {
-    struct selection *s1, *s2, *s3, *s4;
+    struct selection *s1, *s2;
     static const expression empty_expression = {
         .right = NULL, .left = NULL, .value = NULL, .type = E_SELECTION};
     freesasa_structure *structure = freesasa_structure_new();
-    expression r, l, e, e_symbol;
+    expression r, l, e, e_symbol, e_not;
+    struct selection_program *program;
+    struct selection_keys *keys;
 
     freesasa_structure_add_atom(structure, " CA ", "ALA", "   1", 'A', 0, 0, 0);
     freesasa_structure_add_atom(structure, " O  ", "ALA", "   1", 'A', 10, 10, 10);
 
     s1 = selection_new(freesasa_structure_n(structure));
     s2 = selection_new(freesasa_structure_n(structure));
-    s3 = selection_new(freesasa_structure_n(structure));
-    s4 = selection_new(freesasa_structure_n(structure));
+    keys = selection_keys_new(structure);
 
-    r = l = e = e_symbol = empty_expression;
+    r = l = e = e_symbol = e_not = empty_expression;
     e.type = E_PLUS;
     e.right = &r;
     e.left = &l;
@@ -909,39 +1289,84 @@ START_TEST(test_selection)
     l.type = E_ID;
     e_symbol.type = E_SYMBOL;
     e_symbol.left = &e;
+    e_not.type = E_NOT;
+    e_not.right = &e_symbol;
+
+    /* keys */
+    ck_assert(pack_word(" CA ") == pack_word("CA"));
+    ck_assert(pack_word(" CA ") != pack_word("C"));
+    ck_assert(pack_word("    ") == 0);
+    ck_assert(pack_word("ABCDEFGHI") == 0);
+    ck_assert(keys->name[0] == pack_word("CA"));
+    ck_assert(keys->symbol[1] == pack_word("O"));
+    ck_assert_int_eq(keys->resi_number[0], 1);
+    ck_assert_int_eq(keys->chain[1], 'A');
+
+    /* program */
+    program = selection_program_new(&e_symbol);
+    ck_assert_ptr_ne(program, NULL);
+    ck_assert_int_eq(program->n_ops, 3);
+    ck_assert_int_eq(program->depth, 2);
+    ck_assert_int_eq(program->op[0].code, OP_ID);
+    ck_assert_int_eq(program->op[0].property, E_SYMBOL);
+    ck_assert(program->op[0].key == pack_word("O"));
+    ck_assert_int_eq(program->op[2].code, OP_OR);
+    ck_assert_int_eq(selection_program_eval(s1, program, keys, freesasa_structure_xyz(structure)),
+                     FREESASA_SUCCESS);
+    ck_assert_int_eq(selection_has_atom(s1, 0), 1);
+    ck_assert_int_eq(selection_has_atom(s1, 1), 1);
+    selection_program_free(program);
+
+    program = selection_program_new(&r);
+    ck_assert_ptr_eq(program, NULL);
+
+    /* select_atoms */
+    e_symbol.left = &r;
+    ck_assert_int_eq(select_atoms(s1, &e_symbol, structure), FREESASA_SUCCESS);
+    ck_assert_int_eq(selection_has_atom(s1, 0), 1);
+    ck_assert_int_eq(selection_has_atom(s1, 1), 0);
+    ck_assert_int_eq(select_atoms(s2, &e_not, structure), FREESASA_SUCCESS);
+    ck_assert_int_eq(selection_has_atom(s2, 0), 0);
+    ck_assert_int_eq(selection_has_atom(s2, 1), 1);
+    ck_assert(s2->bits[0] == 2);
 
-    /* select_symbol */
-    select_list(E_SYMBOL, s1, structure, &r);
-    ck_assert_int_eq(s1->atom[0], 1);
-    ck_assert_int_eq(s1->atom[1], 0);
-    select_list(E_SYMBOL, s2, structure, &l);
-    ck_assert_int_eq(s2->atom[0], 0);
-    ck_assert_int_eq(s2->atom[1], 1);
-    select_list(E_SYMBOL, s3, structure, &e);
-    ck_assert_int_eq(s3->atom[0], 1);
-    ck_assert_int_eq(s3->atom[1], 1);
-    select_atoms(s4, &e_symbol, structure);
-    ck_assert_int_eq(s4->atom[0], 1);
-    ck_assert_int_eq(s4->atom[1], 1);
-
-    /* selection_join */
-    selection_join(s3, s1, s2, E_AND);
-    ck_assert_int_eq(s3->atom[0], 0);
-    ck_assert_int_eq(s3->atom[1], 0);
-    selection_join(s3, s1, s2, E_OR);
-    ck_assert_int_eq(s3->atom[0], 1);
-    ck_assert_int_eq(s3->atom[1], 1);
     freesasa_set_verbosity(FREESASA_V_SILENT);
-    ck_assert_int_eq(selection_join(NULL, s1, s2, E_OR), FREESASA_FAIL);
-    ck_assert_int_eq(selection_join(s3, NULL, s1, E_OR), FREESASA_FAIL);
-    ck_assert_int_eq(selection_join(NULL, NULL, NULL, E_OR), FREESASA_FAIL);
-
-    /* selection_not */
-    ck_assert_int_eq(selection_not(s3), FREESASA_SUCCESS);
-    ck_assert_int_eq(s3->atom[0], 0);
-    ck_assert_int_eq(s3->atom[1], 0);
-    ck_assert_int_eq(selection_not(NULL), FREESASA_FAIL);
+    e_symbol.left = NULL;
+    ck_assert_int_eq(select_atoms(s1, &e_symbol, structure), FREESASA_FAIL);
     freesasa_set_verbosity(FREESASA_V_NORMAL);
+
+    selection_free(s1);
+    selection_free(s2);
+    selection_keys_free(keys);
+    freesasa_structure_free(structure);
+}
+END_TEST
+
+/* check word boundaries */
+START_TEST(test_selection_words)
+{
+    freesasa_structure *structure = freesasa_structure_new();
+    expression *e = get_expression("s, not resi 2-65 or resi 130");
+    struct selection *s;
+    char resi[PDB_ATOM_RES_NUMBER_STRL + 1];
+    int i;
+
+    for (i = 0; i < 130; ++i) {
+        sprintf(resi, "%4d", i + 1);
+        freesasa_structure_add_atom(structure, " CA ", "ALA", resi, 'A', i, 0, 0);
+    }
+    s = selection_new(130);
+
+    ck_assert_int_eq(select_atoms(s, e, structure), FREESASA_SUCCESS);
+    ck_assert_str_eq(s->name, "s");
+    for (i = 0; i < 130; ++i) {
+        ck_assert_int_eq(selection_has_atom(s, i), i == 0 || i >= 65);
+    }
+    ck_assert(s->bits[2] == 3);
+
+    selection_free(s);
+    expression_free(e);
+    freesasa_structure_free(structure);
 }
 END_TEST
 
@@ -978,7 +1403,7 @@ START_TEST(test_debug) /* this test just runs the debug output code to not get a
 }
 END_TEST
 
-struct selection selection_dummy = {.size = 1, .name = NULL, .atom = NULL};
+struct selection selection_dummy = {.size = 1, .name = NULL, .bits = NULL};
 
 void *freesasa_selection_dummy_ptr = &selection_dummy;
 
@@ -994,6 +1419,7 @@ test_selection_static()
 {
     TCase *tc = tcase_create("selection.c static");
     tcase_add_test(tc, test_selection);
+    tcase_add_test(tc, test_selection_words);
     tcase_add_test(tc, test_expression);
     tcase_add_test(tc, test_debug);
 
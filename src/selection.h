@@ -13,6 +13,8 @@ typedef enum { E_SELECTION,
                E_AND,
                E_OR,
                E_NOT,
+               E_WITHIN,
+               E_AROUND,
                E_PLUS,
                E_RANGE,
                E_RANGE_OPEN_L,
@@ -40,7 +42,8 @@ expression *
 freesasa_selection_selector(expression_type type,
                             expression *list);
 
-/** Create an operation (E_AND, E_OR, E_NOT, E_PLUS or E_RANGE) */
+/** Create an operation (E_AND, E_OR, E_NOT, E_PLUS, E_RANGE, E_WITHIN or E_AROUND).
+    For E_WITHIN and E_AROUND left is the distance (E_NUMBER) */
 expression *
 freesasa_selection_operation(expression_type type,
                              expression *left,
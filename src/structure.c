@@ -3,6 +3,9 @@
 #endif
 
 #include <assert.h>
+#include <errno.h>
+#include <limits.h>
+#include <stdint.h>
 #include <stdlib.h>
 
 #include "classifier.h"
@@ -27,6 +30,8 @@
 #define ATOMS_CHUNK 512
 #define RESIDUES_CHUNK 64
 #define CHAINS_CHUNK 64
+#define MEMO_ATOMS 512   /* must be power of 2 */
+#define MEMO_RESIDUES 64 /* must be power of 2 */
 
 struct atom {
     char *res_name;
@@ -71,6 +76,34 @@ struct chains {
     int *first_atom; /* first atom of each chain */
 };
 
+/* Classifier results for a residue/atom name pair */
+struct memo_atom {
+    char res_name[PDB_ATOM_RES_NAME_STRL + 1];
+    char atom_name[PDB_ATOM_NAME_STRL + 1];
+    double radius;
+    freesasa_atom_class the_class;
+};
+
+/* Reference area for a residue name (NULL if classifier has none) */
+struct memo_residue {
+    char res_name[PDB_ATOM_RES_NAME_STRL + 1];
+    const freesasa_nodearea *reference;
+};
+
+/* Structures repeat the same residue types many times, so most atoms
+   can be classified from this memo without going through the
+   classifier. Direct mapped, colliding names just replace each
+   other. Only valid for one classifier, cleared when it changes. The
+   id is compared as well as the address, since a classifier can be
+   freed and another allocated in its place. The memo is released
+   when a reader has added all atoms of a structure. */
+struct classifier_memo {
+    const freesasa_classifier *classifier;
+    unsigned long classifier_id;
+    struct memo_atom atom[MEMO_ATOMS];
+    struct memo_residue residue[MEMO_RESIDUES];
+};
+
 struct freesasa_structure {
     struct atoms atoms;
     struct residues residues;
@@ -78,6 +111,7 @@ struct freesasa_structure {
     char *classifier_name;
     coord_t *xyz;
     int model; /* model number */
+    struct classifier_memo *memo;
 };
 
 static int
@@ -367,6 +401,7 @@ freesasa_structure_new(void)
     s->xyz = freesasa_coord_new();
     s->model = 1;
     s->classifier_name = NULL;
+    s->memo = NULL;
 
     if (s->xyz == NULL) goto memerr;
 
@@ -385,6 +420,7 @@ void freesasa_structure_free(freesasa_structure *s)
         chains_dealloc(&s->chains);
         if (s->xyz != NULL) freesasa_coord_free(s->xyz);
         free(s->classifier_name);
+        free(s->memo);
         free(s);
     }
 }
@@ -446,6 +482,124 @@ structure_add_chain(freesasa_structure *s,
     return FREESASA_SUCCESS;
 }
 
+/* FNV-1a hash of one or two names */
+static unsigned int
+memo_hash(const char *name1,
+          const char *name2)
+{
+    unsigned int h = 2166136261u;
+
+    for (; *name1; ++name1) {
+        h ^= (unsigned char)*name1;
+        h *= 16777619u;
+    }
+    for (; name2 && *name2; ++name2) {
+        h ^= (unsigned char)*name2;
+        h *= 16777619u;
+    }
+    return h;
+}
+
+/* Returns the memo of the structure, valid for the given classifier,
+   NULL if memory allocation fails. */
+static struct classifier_memo *
+structure_memo(freesasa_structure *s,
+               const freesasa_classifier *classifier)
+{
+    if (s->memo == NULL) {
+        s->memo = malloc(sizeof(struct classifier_memo));
+        if (s->memo == NULL) return NULL;
+        s->memo->classifier = NULL;
+    }
+    if (s->memo->classifier != classifier ||
+        s->memo->classifier_id != classifier->id) {
+        memset(s->memo, 0, sizeof(struct classifier_memo));
+        s->memo->classifier = classifier;
+        s->memo->classifier_id = classifier->id;
+    }
+    return s->memo;
+}
+
+void freesasa_structure_release_memo(freesasa_structure *s)
+{
+    free(s->memo);
+    s->memo = NULL;
+}
+
+/* Names that are empty or too long for the memo bypass it */
+static int
+memo_accepts(const char *name,
+             size_t max_len)
+{
+    size_t n = strlen(name);
+    return n > 0 && n <= max_len;
+}
+
+/**
+    Radius and class of an atom, from the memo if the same residue
+    and atom names have been seen before, else from the classifier.
+ */
+static void
+structure_classify_atom(freesasa_structure *s,
+                        const freesasa_classifier *classifier,
+                        const struct atom *a,
+                        double *radius,
+                        freesasa_atom_class *the_class)
+{
+    struct classifier_memo *memo = NULL;
+    struct memo_atom *entry;
+
+    if (memo_accepts(a->res_name, PDB_ATOM_RES_NAME_STRL) &&
+        memo_accepts(a->atom_name, PDB_ATOM_NAME_STRL)) {
+        memo = structure_memo(s, classifier);
+    }
+
+    if (memo == NULL) {
+        freesasa_classifier_lookup(classifier, a->res_name, a->atom_name,
+                                   radius, the_class);
+        return;
+    }
+
+    entry = &memo->atom[memo_hash(a->res_name, a->atom_name) & (MEMO_ATOMS - 1)];
+    if (strcmp(entry->res_name, a->res_name) != 0 ||
+        strcmp(entry->atom_name, a->atom_name) != 0) {
+        freesasa_classifier_lookup(classifier, a->res_name, a->atom_name,
+                                   &entry->radius, &entry->the_class);
+        strcpy(entry->res_name, a->res_name);
+        strcpy(entry->atom_name, a->atom_name);
+    }
+    *radius = entry->radius;
+    *the_class = entry->the_class;
+}
+
+/**
+    Reference area of a residue, from the memo if the residue name has
+    been seen before, else from the classifier.
+ */
+static const freesasa_nodearea *
+structure_residue_reference(freesasa_structure *s,
+                            const freesasa_classifier *classifier,
+                            const char *res_name)
+{
+    struct classifier_memo *memo = NULL;
+    struct memo_residue *entry;
+
+    if (memo_accepts(res_name, PDB_ATOM_RES_NAME_STRL)) {
+        memo = structure_memo(s, classifier);
+    }
+
+    if (memo == NULL) {
+        return freesasa_classifier_residue_reference(classifier, res_name);
+    }
+
+    entry = &memo->residue[memo_hash(res_name, NULL) & (MEMO_RESIDUES - 1)];
+    if (strcmp(entry->res_name, res_name) != 0) {
+        entry->reference = freesasa_classifier_residue_reference(classifier, res_name);
+        strcpy(entry->res_name, res_name);
+    }
+    return entry->reference;
+}
+
 static int
 structure_add_residue(freesasa_structure *s,
                       const freesasa_classifier *classifier,
@@ -471,7 +625,7 @@ structure_add_residue(freesasa_structure *s,
     s->residues.first_atom[n - 1] = i_latest_atom;
 
     s->residues.reference_area[n - 1] = NULL;
-    reference = freesasa_classifier_residue_reference(classifier, a->res_name);
+    reference = structure_residue_reference(s, classifier, a->res_name);
     if (reference != NULL) {
         s->residues.reference_area[n - 1] = malloc(sizeof(freesasa_nodearea));
         if (s->residues.reference_area[n - 1] == NULL)
@@ -483,16 +637,17 @@ structure_add_residue(freesasa_structure *s,
 }
 
 /**
-    Get the radius of an atom, and fail, warn and/or guess depending
-    on the options.
+    Get the radius and class of an atom, and fail, warn and/or guess
+    the radius depending on the options.
  */
 static int
-structure_check_atom_radius(double *radius,
+structure_check_atom_radius(freesasa_structure *s,
+                            double *radius,
                             struct atom *a,
                             const freesasa_classifier *classifier,
                             int options)
 {
-    *radius = freesasa_classifier_radius(classifier, a->res_name, a->atom_name);
+    structure_classify_atom(s, classifier, a, radius, &a->the_class);
     if (*radius < 0) {
         if (options & FREESASA_HALT_AT_UNKNOWN) {
             return fail_msg("atom '%s %s' unknown",
@@ -572,9 +727,10 @@ structure_add_atom(freesasa_structure *structure,
 
     /* calculate radius and check if we should keep the atom (based on options) */
     if (options & FREESASA_RADIUS_FROM_OCCUPANCY) {
+        structure_classify_atom(structure, classifier, atom, &r, &atom->the_class);
         r = 1; /* fix it later */
     } else {
-        ret = structure_check_atom_radius(&r, atom, classifier, options);
+        ret = structure_check_atom_radius(structure, &r, atom, classifier, options);
         if (ret == FREESASA_FAIL) return fail_msg("halting at unknown atom");
         if (ret == FREESASA_WARN) return FREESASA_WARN;
     }
@@ -597,7 +753,6 @@ structure_add_atom(freesasa_structure *structure,
     if (structure_add_residue(structure, classifier, atom, na - 1) == FREESASA_FAIL)
         return mem_fail();
 
-    atom->the_class = freesasa_classifier_class(classifier, atom->res_name, atom->atom_name);
     atom->res_index = structure->residues.n - 1;
     structure->atoms.radius[na - 1] = r;
     structure->atoms.atom[na - 1] = atom;
@@ -681,6 +836,8 @@ from_pdb_impl(FILE *pdb_file,
         goto cleanup;
     }
 
+    freesasa_structure_release_memo(s);
+
     return s;
 
 cleanup:
@@ -782,16 +939,33 @@ freesasa_structure_from_pdb(FILE *pdb_file,
                             const freesasa_classifier *classifier,
                             int options)
 {
+    freesasa_structure *structure;
+    FILE *unzipped = NULL;
+
     assert(pdb_file);
-    return from_pdb_impl(pdb_file, freesasa_whole_file(pdb_file),
-                         classifier, options);
+
+    if (freesasa_is_gzip(pdb_file)) {
+        unzipped = freesasa_gunzip(pdb_file);
+        if (unzipped == NULL) {
+            fail_msg("");
+            return NULL;
+        }
+        pdb_file = unzipped;
+    }
+
+    structure = from_pdb_impl(pdb_file, freesasa_whole_file(pdb_file),
+                              classifier, options);
+
+    if (unzipped) fclose(unzipped);
+
+    return structure;
 }
 
-freesasa_structure **
-freesasa_structure_array(FILE *pdb,
-                         int *n,
-                         const freesasa_classifier *classifier,
-                         int options)
+static freesasa_structure **
+structure_array_impl(FILE *pdb,
+                     int *n,
+                     const freesasa_classifier *classifier,
+                     int options)
 {
     struct file_range *models = NULL, *chains = NULL;
     struct file_range whole_file;
@@ -894,6 +1068,222 @@ cleanup:
     return NULL;
 }
 
+freesasa_structure **
+freesasa_structure_array(FILE *pdb,
+                         int *n,
+                         const freesasa_classifier *classifier,
+                         int options)
+{
+    freesasa_structure **ss;
+    FILE *unzipped = NULL;
+
+    assert(pdb);
+    assert(n);
+
+    if (freesasa_is_gzip(pdb)) {
+        unzipped = freesasa_gunzip(pdb);
+        if (unzipped == NULL) {
+            fail_msg("");
+            *n = 0;
+            return NULL;
+        }
+        pdb = unzipped;
+    }
+
+    ss = structure_array_impl(pdb, n, classifier, options);
+
+    if (unzipped) fclose(unzipped);
+
+    return ss;
+}
+
+struct freesasa_model_iter {
+    FILE *pdb;
+    FILE *unzipped;
+    const freesasa_classifier *classifier;
+    int options;
+    freesasa_structure *structure; /* the first model, with the coordinates of the latest */
+    int n_models;                  /* models read so far */
+    int has_next;
+    int failed;
+};
+
+freesasa_model_iter *
+freesasa_model_iter_new(FILE *pdb,
+                        const freesasa_classifier *classifier,
+                        int options)
+{
+    freesasa_model_iter *iter;
+
+    assert(pdb);
+
+    if (options & (FREESASA_JOIN_MODELS | FREESASA_SEPARATE_CHAINS)) {
+        fail_msg("the options FREESASA_JOIN_MODELS and FREESASA_SEPARATE_CHAINS "
+                 "can not be used when iterating over models");
+        return NULL;
+    }
+
+    iter = malloc(sizeof(struct freesasa_model_iter));
+    if (iter == NULL) {
+        mem_fail();
+        return NULL;
+    }
+
+    iter->pdb = pdb;
+    iter->unzipped = NULL;
+    iter->classifier = classifier;
+    iter->options = options;
+    iter->structure = NULL;
+    iter->n_models = 0;
+    iter->has_next = 1;
+    iter->failed = 0;
+
+    if (freesasa_is_gzip(pdb)) {
+        iter->unzipped = freesasa_gunzip(pdb);
+        if (iter->unzipped == NULL) {
+            fail_msg("");
+            free(iter);
+            return NULL;
+        }
+        iter->pdb = iter->unzipped;
+    }
+
+    return iter;
+}
+
+void freesasa_model_iter_free(freesasa_model_iter *iter)
+{
+    if (iter) {
+        freesasa_structure_free(iter->structure);
+        if (iter->unzipped) fclose(iter->unzipped);
+        free(iter);
+    }
+}
+
+/* Same atom name, residue name, chain and residue number (with
+   insertion code), alternate location and record name are ignored */
+static int
+model_iter_same_atom(const char *line,
+                     const char *first)
+{
+    return strncmp(line + 12, first + 12, 4) == 0 &&
+           strncmp(line + 17, first + 17, 10) == 0;
+}
+
+/* Reads the coordinates of the next model into the structure of the
+   first, with the same selection of atoms as in from_pdb_impl() */
+static int
+model_iter_read_coordinates(freesasa_model_iter *iter)
+{
+    freesasa_structure *s = iter->structure;
+    char line[PDB_MAX_LINE_STRL];
+    char alt, the_alt = ' ';
+    char *first;
+    double v[3], r;
+    size_t len;
+    int i = 0, n = s->atoms.n;
+
+    while (fgets(line, PDB_MAX_LINE_STRL, iter->pdb) != NULL) {
+        if (strncmp("ENDMDL", line, 6) == 0) break;
+
+        if (!(strncmp("ATOM", line, 4) == 0 || ((iter->options & FREESASA_INCLUDE_HETATM) &&
+                                                (strncmp("HETATM", line, 6) == 0))))
+            continue;
+        if (freesasa_pdb_ishydrogen(line) &&
+            !(iter->options & FREESASA_INCLUDE_HYDROGEN))
+            continue;
+
+        alt = freesasa_pdb_get_alt_coord_label(line);
+        if ((alt != ' ' && the_alt == ' ') || (alt == ' '))
+            the_alt = alt;
+        else if (alt != ' ' && alt != the_alt)
+            continue;
+
+        if (i == n) continue;
+        first = s->atoms.atom[i]->line;
+        if (!model_iter_same_atom(line, first)) continue;
+
+        if (freesasa_pdb_get_coord(v, line) == FREESASA_FAIL)
+            return fail_msg("");
+        freesasa_coord_set_i(s->xyz, i, v);
+
+        if (iter->options & FREESASA_RADIUS_FROM_OCCUPANCY) {
+            if (freesasa_pdb_get_occupancy(&r, line) == FREESASA_FAIL)
+                return fail_msg("");
+            s->atoms.radius[i] = r;
+        }
+
+        /* keep the line up to date for PDB output */
+        len = strlen(line);
+        if (len != strlen(first)) {
+            first = realloc(first, len + 1);
+            if (first == NULL) return mem_fail();
+            s->atoms.atom[i]->line = first;
+        }
+        memcpy(first, line, len + 1);
+        ++i;
+    }
+
+    if (i < n) {
+        return fail_msg("model %d lacks atoms that are in the first model",
+                        iter->n_models + 1);
+    }
+
+    return FREESASA_SUCCESS;
+}
+
+/* Looks ahead for another model, or for atoms outside models */
+static int
+model_iter_peek(freesasa_model_iter *iter)
+{
+    char line[PDB_MAX_LINE_STRL];
+    long pos = ftell(iter->pdb);
+    int found = 0;
+
+    while (fgets(line, PDB_MAX_LINE_STRL, iter->pdb) != NULL) {
+        if (strncmp("MODEL", line, 5) == 0 || strncmp("ATOM", line, 4) == 0 ||
+            ((iter->options & FREESASA_INCLUDE_HETATM) && strncmp("HETATM", line, 6) == 0)) {
+            found = 1;
+            break;
+        }
+    }
+    fseek(iter->pdb, pos, SEEK_SET);
+
+    return found;
+}
+
+const freesasa_structure *
+freesasa_model_iter_next(freesasa_model_iter *iter)
+{
+    assert(iter);
+
+    if (!iter->has_next || iter->failed) return NULL;
+
+    if (iter->structure == NULL) {
+        iter->structure = from_pdb_impl(iter->pdb, freesasa_whole_file(iter->pdb),
+                                        iter->classifier, iter->options);
+        if (iter->structure == NULL) {
+            iter->failed = 1;
+            return NULL;
+        }
+    } else if (model_iter_read_coordinates(iter) == FREESASA_FAIL) {
+        iter->failed = 1;
+        return NULL;
+    }
+
+    iter->structure->model = ++iter->n_models;
+    iter->has_next = model_iter_peek(iter);
+
+    return iter->structure;
+}
+
+int freesasa_model_iter_has_next(const freesasa_model_iter *iter)
+{
+    assert(iter);
+
+    return iter->has_next;
+}
+
 freesasa_structure *
 freesasa_structure_get_chains(const freesasa_structure *structure,
                               const char *chains,
@@ -1213,3 +1603,405 @@ void freesasa_structure_set_model(freesasa_structure *structure,
 {
     structure->model = model;
 }
+
+/**
+    Saved structures (see freesasa_structure_save()) consist of a
+    header, followed by the coordinates, radii, a table of atoms, a
+    table of residues, the first atom and label of each chain, and
+    the strings the atom and residue tables refer to. The format is
+    in native byte order and sizes, the header has fields to detect
+    files saved on other platforms.
+ */
+#define SAVED_MAGIC "FSSTRUC"
+#define SAVED_VERSION 1
+#define SAVED_BYTE_ORDER 0x01020304
+#define SAVED_NONE 0xffffffff
+
+struct saved_header {
+    char magic[8];
+    uint32_t version;
+    uint32_t byte_order;
+    uint32_t atom_size;
+    uint32_t residue_size;
+    uint32_t n_atoms;
+    uint32_t n_residues;
+    uint32_t n_chains;
+    int32_t model;
+    uint32_t classifier_name; /* offset in strings, or SAVED_NONE */
+    uint32_t string_size;
+};
+
+/* Strings are offsets in the string section, line is SAVED_NONE if
+   the atom has no PDB line */
+struct saved_atom {
+    uint32_t res_name;
+    uint32_t res_number;
+    uint32_t atom_name;
+    uint32_t symbol;
+    uint32_t line;
+    int32_t res_index;
+    int32_t the_class;
+    char chain_label;
+};
+
+/* reference_name is SAVED_NONE if the residue has no reference */
+struct saved_residue {
+    int32_t first_atom;
+    uint32_t reference_name;
+    double total, main_chain, side_chain, polar, apolar, unknown;
+};
+
+/* Adds the length of str to the string section, returns its offset */
+static uint32_t
+saved_string(uint32_t *string_size,
+             const char *str)
+{
+    uint32_t offset = *string_size;
+
+    if (str == NULL) return SAVED_NONE;
+    *string_size += strlen(str) + 1;
+
+    return offset;
+}
+
+static int
+saved_write_string(FILE *output,
+                   const char *str)
+{
+    if (str == NULL) return FREESASA_SUCCESS;
+    return fwrite(str, 1, strlen(str) + 1, output) == strlen(str) + 1 ? FREESASA_SUCCESS : FREESASA_FAIL;
+}
+
+int freesasa_structure_save(FILE *output,
+                            const freesasa_structure *structure)
+{
+    struct saved_header header;
+    struct saved_atom *atom = NULL;
+    struct saved_residue *residue = NULL;
+    const struct atom *a;
+    const freesasa_nodearea *ref;
+    int n_atoms = structure->atoms.n, n_residues = structure->residues.n,
+        n_chains = structure->chains.n, i, ret = FREESASA_FAIL;
+
+    assert(output);
+    assert(structure);
+
+    if (n_atoms == 0) return fail_msg("can't save empty structure");
+
+    atom = calloc(n_atoms, sizeof(struct saved_atom));
+    residue = calloc(n_residues, sizeof(struct saved_residue));
+    if (atom == NULL || residue == NULL) {
+        mem_fail();
+        goto cleanup;
+    }
+
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, SAVED_MAGIC, sizeof(header.magic));
+    header.version = SAVED_VERSION;
+    header.byte_order = SAVED_BYTE_ORDER;
+    header.atom_size = sizeof(struct saved_atom);
+    header.residue_size = sizeof(struct saved_residue);
+    header.n_atoms = n_atoms;
+    header.n_residues = n_residues;
+    header.n_chains = n_chains;
+    header.model = structure->model;
+
+    for (i = 0; i < n_atoms; ++i) {
+        a = structure->atoms.atom[i];
+        atom[i].res_name = saved_string(&header.string_size, a->res_name);
+        atom[i].res_number = saved_string(&header.string_size, a->res_number);
+        atom[i].atom_name = saved_string(&header.string_size, a->atom_name);
+        atom[i].symbol = saved_string(&header.string_size, a->symbol);
+        atom[i].line = saved_string(&header.string_size, a->line);
+        atom[i].res_index = a->res_index;
+        atom[i].the_class = a->the_class;
+        atom[i].chain_label = a->chain_label;
+    }
+    for (i = 0; i < n_residues; ++i) {
+        ref = structure->residues.reference_area[i];
+        residue[i].first_atom = structure->residues.first_atom[i];
+        residue[i].reference_name = SAVED_NONE;
+        if (ref != NULL) {
+            residue[i].reference_name = saved_string(&header.string_size, ref->name ? ref->name : "");
+            residue[i].total = ref->total;
+            residue[i].main_chain = ref->main_chain;
+            residue[i].side_chain = ref->side_chain;
+            residue[i].polar = ref->polar;
+            residue[i].apolar = ref->apolar;
+            residue[i].unknown = ref->unknown;
+        }
+    }
+    header.classifier_name = saved_string(&header.string_size, structure->classifier_name);
+
+    if (fwrite(&header, sizeof(header), 1, output) != 1 ||
+        fwrite(freesasa_coord_all(structure->xyz), sizeof(double), 3 * n_atoms, output) != 3 * (size_t)n_atoms ||
+        fwrite(structure->atoms.radius, sizeof(double), n_atoms, output) != (size_t)n_atoms ||
+        fwrite(atom, sizeof(struct saved_atom), n_atoms, output) != (size_t)n_atoms ||
+        fwrite(residue, sizeof(struct saved_residue), n_residues, output) != (size_t)n_residues ||
+        fwrite(structure->chains.first_atom, sizeof(int), n_chains, output) != (size_t)n_chains ||
+        fwrite(structure->chains.labels, 1, n_chains, output) != (size_t)n_chains) {
+        fail_msg(strerror(errno));
+        goto cleanup;
+    }
+
+    for (i = 0; i < n_atoms; ++i) {
+        a = structure->atoms.atom[i];
+        if (saved_write_string(output, a->res_name) ||
+            saved_write_string(output, a->res_number) ||
+            saved_write_string(output, a->atom_name) ||
+            saved_write_string(output, a->symbol) ||
+            saved_write_string(output, a->line)) {
+            fail_msg(strerror(errno));
+            goto cleanup;
+        }
+    }
+    for (i = 0; i < n_residues; ++i) {
+        ref = structure->residues.reference_area[i];
+        if (ref != NULL && saved_write_string(output, ref->name ? ref->name : "")) {
+            fail_msg(strerror(errno));
+            goto cleanup;
+        }
+    }
+    if (saved_write_string(output, structure->classifier_name)) {
+        fail_msg(strerror(errno));
+        goto cleanup;
+    }
+
+    ret = FREESASA_SUCCESS;
+
+cleanup:
+    free(atom);
+    free(residue);
+    return ret;
+}
+
+/* Checks that offset points to a string in the string section */
+static int
+saved_check_string(uint32_t string_size,
+                   uint32_t offset)
+{
+    return offset < string_size ? FREESASA_SUCCESS : FREESASA_FAIL;
+}
+
+static char *
+saved_strdup(const char *strings,
+             uint32_t offset)
+{
+    char *str;
+
+    if (offset == SAVED_NONE) return NULL;
+    str = strdup(strings + offset);
+    if (str == NULL) mem_fail();
+
+    return str;
+}
+
+/* Fills the atom and residue tables of s from the saved tables */
+static int
+saved_tables(freesasa_structure *s,
+             const struct saved_header *header,
+             const struct saved_atom *atom,
+             const struct saved_residue *residue,
+             const char *strings)
+{
+    struct atom *a;
+    freesasa_nodearea *ref;
+    const char *name;
+    uint32_t i, r, n = header->string_size;
+
+    if (n > 0 && strings[n - 1] != '\0') return fail_msg("saved structure is corrupt");
+
+    for (i = 0; i < header->n_atoms; ++i) {
+        if (saved_check_string(n, atom[i].res_name) ||
+            saved_check_string(n, atom[i].res_number) ||
+            saved_check_string(n, atom[i].atom_name) ||
+            saved_check_string(n, atom[i].symbol) ||
+            (atom[i].line != SAVED_NONE && saved_check_string(n, atom[i].line)) ||
+            atom[i].res_index < 0 || (uint32_t)atom[i].res_index >= header->n_residues) {
+            return fail_msg("saved structure is corrupt");
+        }
+
+        a = malloc(sizeof(struct atom));
+        if (a == NULL) return mem_fail();
+        *a = empty_atom;
+        s->atoms.atom[i] = a;
+
+        a->res_name = saved_strdup(strings, atom[i].res_name);
+        a->res_number = saved_strdup(strings, atom[i].res_number);
+        a->atom_name = saved_strdup(strings, atom[i].atom_name);
+        a->symbol = saved_strdup(strings, atom[i].symbol);
+        a->line = saved_strdup(strings, atom[i].line);
+        if (a->res_name == NULL || a->res_number == NULL ||
+            a->atom_name == NULL || a->symbol == NULL ||
+            (atom[i].line != SAVED_NONE && a->line == NULL)) {
+            return fail_msg("");
+        }
+        a->res_index = atom[i].res_index;
+        a->the_class = atom[i].the_class;
+        a->chain_label = atom[i].chain_label;
+    }
+
+    for (i = 0; i < header->n_residues; ++i) {
+        s->residues.first_atom[i] = residue[i].first_atom;
+        s->residues.reference_area[i] = NULL;
+        if (residue[i].first_atom < 0 || (uint32_t)residue[i].first_atom >= header->n_atoms ||
+            (i == 0 && residue[i].first_atom != 0) ||
+            (i > 0 && residue[i].first_atom <= residue[i - 1].first_atom)) {
+            return fail_msg("saved structure is corrupt");
+        }
+        if (residue[i].reference_name == SAVED_NONE) continue;
+        if (saved_check_string(n, residue[i].reference_name)) {
+            return fail_msg("saved structure is corrupt");
+        }
+
+        /* the name is stored after the area, to be freed together */
+        name = strings + residue[i].reference_name;
+        ref = malloc(sizeof(freesasa_nodearea) + strlen(name) + 1);
+        if (ref == NULL) return mem_fail();
+        strcpy((char *)(ref + 1), name);
+        ref->name = (const char *)(ref + 1);
+        ref->total = residue[i].total;
+        ref->main_chain = residue[i].main_chain;
+        ref->side_chain = residue[i].side_chain;
+        ref->polar = residue[i].polar;
+        ref->apolar = residue[i].apolar;
+        ref->unknown = residue[i].unknown;
+        s->residues.reference_area[i] = ref;
+    }
+
+    /* the residue ranges are valid, each atom has to be in the range
+       of its own residue */
+    for (i = 0; i < header->n_atoms; ++i) {
+        r = atom[i].res_index;
+        if ((uint32_t)residue[r].first_atom > i ||
+            (r + 1 < header->n_residues && (uint32_t)residue[r + 1].first_atom <= i)) {
+            return fail_msg("saved structure is corrupt");
+        }
+    }
+
+    if (header->classifier_name != SAVED_NONE) {
+        if (saved_check_string(n, header->classifier_name)) {
+            return fail_msg("saved structure is corrupt");
+        }
+        s->classifier_name = saved_strdup(strings, header->classifier_name);
+        if (s->classifier_name == NULL) return fail_msg("");
+    }
+
+    return FREESASA_SUCCESS;
+}
+
+freesasa_structure *
+freesasa_structure_load(FILE *input)
+{
+    struct saved_header header;
+    struct saved_atom *atom = NULL;
+    struct saved_residue *residue = NULL;
+    double *xyz = NULL;
+    char *strings = NULL;
+    freesasa_structure *s = NULL;
+    uint32_t i;
+    size_t n_atoms, n_residues, n_chains;
+
+    assert(input);
+
+    if (fread(&header, sizeof(header), 1, input) != 1) {
+        fail_msg("saved structure is truncated");
+        return NULL;
+    }
+    if (memcmp(header.magic, SAVED_MAGIC, sizeof(header.magic)) != 0) {
+        fail_msg("not a saved structure");
+        return NULL;
+    }
+    if (header.version != SAVED_VERSION) {
+        fail_msg("saved structure has version %d, expected %d",
+                 header.version, SAVED_VERSION);
+        return NULL;
+    }
+    if (header.byte_order != SAVED_BYTE_ORDER ||
+        header.atom_size != sizeof(struct saved_atom) ||
+        header.residue_size != sizeof(struct saved_residue)) {
+        fail_msg("structure was saved on an incompatible platform");
+        return NULL;
+    }
+    if (header.n_atoms == 0 || header.n_residues == 0 || header.n_chains == 0 ||
+        header.n_atoms > INT_MAX / 3 || header.n_residues > header.n_atoms ||
+        header.n_chains > header.n_residues) {
+        fail_msg("saved structure is corrupt");
+        return NULL;
+    }
+    n_atoms = header.n_atoms;
+    n_residues = header.n_residues;
+    n_chains = header.n_chains;
+
+    s = freesasa_structure_new();
+    if (s == NULL) {
+        fail_msg("");
+        return NULL;
+    }
+    s->model = header.model;
+
+    xyz = malloc(sizeof(double) * 3 * n_atoms);
+    atom = malloc(sizeof(struct saved_atom) * n_atoms);
+    residue = malloc(sizeof(struct saved_residue) * n_residues);
+    strings = malloc(header.string_size + 1);
+    s->atoms.atom = calloc(n_atoms, sizeof(struct atom *));
+    s->atoms.radius = malloc(sizeof(double) * n_atoms);
+    s->residues.first_atom = malloc(sizeof(int) * n_residues);
+    s->residues.reference_area = calloc(n_residues, sizeof(freesasa_nodearea *));
+    s->chains.first_atom = malloc(sizeof(int) * n_chains);
+    s->chains.labels = malloc(n_chains + 1);
+    if (xyz == NULL || atom == NULL || residue == NULL || strings == NULL ||
+        s->atoms.atom == NULL || s->atoms.radius == NULL ||
+        s->residues.first_atom == NULL || s->residues.reference_area == NULL ||
+        s->chains.first_atom == NULL || s->chains.labels == NULL) {
+        mem_fail();
+        goto cleanup;
+    }
+    s->atoms.n = s->atoms.n_alloc = n_atoms;
+    s->residues.n = s->residues.n_alloc = n_residues;
+    s->chains.n = s->chains.n_alloc = n_chains;
+
+    if (fread(xyz, sizeof(double), 3 * n_atoms, input) != 3 * n_atoms ||
+        fread(s->atoms.radius, sizeof(double), n_atoms, input) != n_atoms ||
+        fread(atom, sizeof(struct saved_atom), n_atoms, input) != n_atoms ||
+        fread(residue, sizeof(struct saved_residue), n_residues, input) != n_residues ||
+        fread(s->chains.first_atom, sizeof(int), n_chains, input) != n_chains ||
+        fread(s->chains.labels, 1, n_chains, input) != n_chains ||
+        fread(strings, 1, header.string_size, input) != header.string_size) {
+        fail_msg("saved structure is truncated");
+        goto cleanup;
+    }
+    s->chains.labels[n_chains] = '\0';
+    strings[header.string_size] = '\0';
+
+    for (i = 0; i < n_chains; ++i) {
+        if (s->chains.labels[i] == '\0' ||
+            s->chains.first_atom[i] < 0 || (uint32_t)s->chains.first_atom[i] >= header.n_atoms ||
+            (i == 0 && s->chains.first_atom[i] != 0) ||
+            (i > 0 && s->chains.first_atom[i] <= s->chains.first_atom[i - 1])) {
+            fail_msg("saved structure is corrupt");
+            goto cleanup;
+        }
+    }
+
+    if (saved_tables(s, &header, atom, residue, strings) ||
+        freesasa_coord_append(s->xyz, xyz, n_atoms)) {
+        fail_msg("");
+        goto cleanup;
+    }
+
+    free(xyz);
+    free(atom);
+    free(residue);
+    free(strings);
+
+    return s;
+
+cleanup:
+    free(xyz);
+    free(atom);
+    free(residue);
+    free(strings);
+    freesasa_structure_free(s);
+    return NULL;
+}
@@ -3,9 +3,22 @@
 #endif
 #include <assert.h>
 #include <errno.h>
+#include <math.h>
 #include <stdarg.h>
+#include <stdint.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
+#if HAVE_SYS_MMAN_H && HAVE_MMAP
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+#if USE_ZLIB
+#include <zlib.h>
+#endif
+#if USE_THREADS
+#include <pthread.h>
+#endif
 
 #include "freesasa_internal.h"
 
@@ -17,6 +30,90 @@ const char *freesasa_name = "freesasa";
 
 static FILE *errlog = NULL;
 
+static const double fixed_scale[] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9};
+static const uint64_t fixed_iscale[] = {1, 10, 100, 1000, 10000, 100000, 1000000,
+                                        10000000, 100000000, 1000000000};
+
+int freesasa_format_fixed(char *buf,
+                          size_t size,
+                          double value,
+                          int width,
+                          int precision)
+{
+    char digits[32];
+    double scaled, fraction;
+    uint64_t n, integer;
+    int negative, n_digits = 0, len, i;
+
+    assert(buf);
+
+    if (precision < 0 || precision > 9 || !isfinite(value)) {
+        return snprintf(buf, size, "%*.*f", width, precision, value);
+    }
+
+    negative = signbit(value) ? 1 : 0;
+    scaled = fabs(value) * fixed_scale[precision];
+
+    /* The scaled value has a relative error of at most 2^-53
+       compared to the exact decimal expansion of value. Unless that
+       could move it across a rounding boundary the result is the same
+       as printf() would give, otherwise let printf() decide. */
+    if (scaled >= 4503599627370496.0) { // 2^52
+        return snprintf(buf, size, "%*.*f", width, precision, value);
+    }
+    fraction = scaled - floor(scaled);
+    if (fabs(fraction - 0.5) <= scaled * 0x1p-52) {
+        return snprintf(buf, size, "%*.*f", width, precision, value);
+    }
+
+    n = (uint64_t)scaled + (fraction > 0.5);
+    integer = n / fixed_iscale[precision];
+    n -= integer * fixed_iscale[precision];
+
+    // fraction, then integer part, in reverse
+    for (i = 0; i < precision; ++i) {
+        digits[n_digits++] = '0' + n % 10;
+        n /= 10;
+    }
+    if (precision > 0) digits[n_digits++] = '.';
+    do {
+        digits[n_digits++] = '0' + integer % 10;
+        integer /= 10;
+    } while (integer);
+    if (negative) digits[n_digits++] = '-';
+
+    len = n_digits > width ? n_digits : width;
+    if ((size_t)len >= size) {
+        return snprintf(buf, size, "%*.*f", width, precision, value);
+    }
+
+    for (i = 0; i < len - n_digits; ++i) {
+        buf[i] = ' ';
+    }
+    for (; i < len; ++i) {
+        buf[i] = digits[len - 1 - i];
+    }
+    buf[len] = '\0';
+
+    return len;
+}
+
+int freesasa_fput_fixed(FILE *output,
+                        double value,
+                        int width,
+                        int precision)
+{
+    char buf[FREESASA_FIXED_BUFSIZE];
+    int len = freesasa_format_fixed(buf, sizeof buf, value, width, precision);
+
+    // values that don't fit in the buffer are rare, let printf do it
+    if (len >= (int)sizeof buf) {
+        return fprintf(output, "%*.*f", width, precision, value);
+    }
+
+    return fwrite(buf, 1, len, output) == (size_t)len ? len : -1;
+}
+
 struct file_range
 freesasa_whole_file(FILE *file)
 {
@@ -33,6 +130,213 @@ freesasa_whole_file(FILE *file)
     return range;
 }
 
+int freesasa_file_map(FILE *input,
+                      void **data,
+                      size_t *size)
+{
+    char *buf = NULL, *tmp;
+    size_t n_alloc = 0, n;
+
+#if HAVE_SYS_MMAN_H && HAVE_MMAP
+    struct stat st;
+    void *map;
+
+    if (ftell(input) == 0 && fstat(fileno(input), &st) == 0 &&
+        S_ISREG(st.st_mode) && st.st_size > 0) {
+        map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fileno(input), 0);
+        if (map != MAP_FAILED) {
+            *data = map;
+            *size = st.st_size;
+            return 1;
+        }
+    }
+#endif
+
+    /* fall back on reading the file */
+    *size = 0;
+    do {
+        if (*size == n_alloc) {
+            n_alloc += 1 << 16;
+            tmp = realloc(buf, n_alloc);
+            if (tmp == NULL) {
+                free(buf);
+                return mem_fail();
+            }
+            buf = tmp;
+        }
+        n = fread(buf + *size, 1, n_alloc - *size, input);
+        *size += n;
+    } while (n > 0);
+
+    if (ferror(input)) {
+        free(buf);
+        return fail_msg(strerror(errno));
+    }
+
+    *data = buf;
+    return 0;
+}
+
+void freesasa_file_unmap(void *data,
+                         size_t size,
+                         int mapped)
+{
+#if HAVE_SYS_MMAN_H && HAVE_MMAP
+    if (mapped) {
+        munmap(data, size);
+        return;
+    }
+#endif
+    free(data);
+}
+
+int freesasa_is_gzip(FILE *input)
+{
+    int c = getc(input);
+
+    if (c == EOF) return 0;
+    ungetc(c, input);
+
+    /* the first byte of the gzip magic number, it never starts a PDB
+       or CIF file */
+    return c == 0x1f;
+}
+
+#if USE_ZLIB
+#define GZIP_CHUNK (1 << 16)
+
+FILE *
+freesasa_gunzip(FILE *input)
+{
+    unsigned char *in = malloc(GZIP_CHUNK), *out = malloc(GZIP_CHUNK);
+    FILE *output = NULL;
+    z_stream z;
+    size_t n_out;
+    int ret = Z_OK, more_output = 0;
+
+    memset(&z, 0, sizeof(z));
+
+    if (in == NULL || out == NULL) {
+        mem_fail();
+        goto cleanup;
+    }
+    output = tmpfile();
+    if (output == NULL) {
+        fail_msg("can't create temporary file: %s", strerror(errno));
+        goto cleanup;
+    }
+    if (inflateInit2(&z, 15 + 16) != Z_OK) { /* expect gzip header */
+        fail_msg("can't initialize zlib");
+        goto cleanup;
+    }
+
+    for (;;) {
+        if (z.avail_in == 0 && !more_output) {
+            z.avail_in = fread(in, 1, GZIP_CHUNK, input);
+            z.next_in = in;
+            if (z.avail_in == 0) break;
+        }
+        if (ret == Z_STREAM_END) {
+            /* concatenated gzip members (as from bgzip) form one
+               file, anything else after the end is ignored */
+            if (z.next_in[0] != 0x1f) break;
+            inflateReset(&z);
+        }
+
+        z.avail_out = GZIP_CHUNK;
+        z.next_out = out;
+        ret = inflate(&z, Z_NO_FLUSH);
+        if (ret == Z_BUF_ERROR) ret = Z_OK; /* no progress, needs input */
+        if (ret != Z_OK && ret != Z_STREAM_END) break;
+
+        n_out = GZIP_CHUNK - z.avail_out;
+        if (fwrite(out, 1, n_out, output) != n_out) break;
+        more_output = ret == Z_OK && z.avail_out == 0;
+    }
+
+    inflateEnd(&z);
+
+    if (ferror(input) || ferror(output)) {
+        fail_msg(strerror(errno));
+    } else if (ret != Z_STREAM_END) {
+        fail_msg("invalid or truncated gzip input");
+    } else {
+        free(in);
+        free(out);
+        rewind(output);
+        return output;
+    }
+
+cleanup:
+    free(in);
+    free(out);
+    if (output) fclose(output);
+    return NULL;
+}
+
+int freesasa_gzip(FILE *input,
+                  FILE *output)
+{
+    unsigned char *in = malloc(GZIP_CHUNK), *out = malloc(GZIP_CHUNK);
+    z_stream z;
+    size_t n_out;
+    int flush, ret = FREESASA_FAIL;
+
+    memset(&z, 0, sizeof(z));
+
+    if (in == NULL || out == NULL) {
+        mem_fail();
+        goto cleanup;
+    }
+    if (deflateInit2(&z, Z_DEFAULT_COMPRESSION, Z_DEFLATED, 15 + 16, 8,
+                     Z_DEFAULT_STRATEGY) != Z_OK) { /* write gzip header */
+        fail_msg("can't initialize zlib");
+        goto cleanup;
+    }
+
+    do {
+        z.avail_in = fread(in, 1, GZIP_CHUNK, input);
+        z.next_in = in;
+        if (ferror(input)) break;
+        flush = feof(input) ? Z_FINISH : Z_NO_FLUSH;
+
+        do {
+            z.avail_out = GZIP_CHUNK;
+            z.next_out = out;
+            deflate(&z, flush);
+            n_out = GZIP_CHUNK - z.avail_out;
+            if (fwrite(out, 1, n_out, output) != n_out) break;
+        } while (z.avail_out == 0);
+    } while (flush != Z_FINISH && !ferror(output));
+
+    deflateEnd(&z);
+
+    if (ferror(input) || ferror(output)) {
+        fail_msg(strerror(errno));
+    } else {
+        ret = FREESASA_SUCCESS;
+    }
+
+cleanup:
+    free(in);
+    free(out);
+    return ret;
+}
+#else  /* USE_ZLIB */
+FILE *
+freesasa_gunzip(FILE *input)
+{
+    fail_msg("can't read gzip compressed input, FreeSASA was built without zlib");
+    return NULL;
+}
+
+int freesasa_gzip(FILE *input,
+                  FILE *output)
+{
+    return fail_msg("can't write gzip compressed output, FreeSASA was built without zlib");
+}
+#endif /* USE_ZLIB */
+
 static void
 freesasa_err_impl(int err,
                   const char *format,
@@ -128,6 +432,171 @@ freesasa_thread_error(int error_code)
     return "Unknown thread error";
 }
 
+struct freesasa_thread_pool {
+    int n_threads;
+    void (*work)(void *, int);
+    void *arg;
+#if USE_THREADS
+    pthread_t *thread;
+    struct pool_worker *worker;
+    pthread_mutex_t mutex;
+    pthread_cond_t start, done;
+    unsigned long task; /* incremented for each call to freesasa_thread_pool_run() */
+    int n_busy;
+    int quit;
+#endif
+};
+
+#if USE_THREADS
+struct pool_worker {
+    freesasa_thread_pool *pool;
+    int index;
+};
+
+static void *
+pool_thread(void *arg)
+{
+    struct pool_worker *worker = arg;
+    freesasa_thread_pool *pool = worker->pool;
+    unsigned long task = 0;
+
+    pthread_mutex_lock(&pool->mutex);
+    for (;;) {
+        while (pool->task == task && !pool->quit)
+            pthread_cond_wait(&pool->start, &pool->mutex);
+        if (pool->quit) break;
+        task = pool->task;
+        pthread_mutex_unlock(&pool->mutex);
+
+        pool->work(pool->arg, worker->index);
+
+        pthread_mutex_lock(&pool->mutex);
+        if (--pool->n_busy == 0) pthread_cond_signal(&pool->done);
+    }
+    pthread_mutex_unlock(&pool->mutex);
+
+    return NULL;
+}
+#endif
+
+freesasa_thread_pool *
+freesasa_thread_pool_new(int n_threads)
+{
+    freesasa_thread_pool *pool;
+#if USE_THREADS
+    int t, res;
+#endif
+
+    assert(n_threads > 0);
+
+    pool = malloc(sizeof(freesasa_thread_pool));
+    if (pool == NULL) {
+        mem_fail();
+        return NULL;
+    }
+
+    pool->n_threads = 1;
+    pool->work = NULL;
+    pool->arg = NULL;
+
+#if USE_THREADS
+    pool->thread = NULL;
+    pool->worker = NULL;
+    pool->task = 0;
+    pool->n_busy = 0;
+    pool->quit = 0;
+    pthread_mutex_init(&pool->mutex, NULL);
+    pthread_cond_init(&pool->start, NULL);
+    pthread_cond_init(&pool->done, NULL);
+
+    if (n_threads > 1) {
+        /* the calling thread does the work of thread 0 */
+        pool->thread = malloc(sizeof(pthread_t) * n_threads);
+        pool->worker = malloc(sizeof(struct pool_worker) * n_threads);
+        if (pool->thread == NULL || pool->worker == NULL) {
+            freesasa_thread_pool_free(pool);
+            mem_fail();
+            return NULL;
+        }
+        for (t = 1; t < n_threads; ++t) {
+            pool->worker[t].pool = pool;
+            pool->worker[t].index = t;
+            res = pthread_create(&pool->thread[t], NULL, pool_thread, &pool->worker[t]);
+            if (res) {
+                fail_msg(freesasa_thread_error(res));
+                freesasa_thread_pool_free(pool);
+                return NULL;
+            }
+            ++pool->n_threads;
+        }
+    }
+#endif
+
+    return pool;
+}
+
+int freesasa_thread_pool_n(const freesasa_thread_pool *pool)
+{
+    assert(pool);
+    return pool->n_threads;
+}
+
+void freesasa_thread_pool_run(freesasa_thread_pool *pool,
+                              void (*work)(void *arg, int thread_index),
+                              void *arg)
+{
+    assert(pool);
+    assert(work);
+
+    if (pool->n_threads == 1) {
+        work(arg, 0);
+        return;
+    }
+
+#if USE_THREADS
+    pthread_mutex_lock(&pool->mutex);
+    pool->work = work;
+    pool->arg = arg;
+    pool->n_busy = pool->n_threads - 1;
+    ++pool->task;
+    pthread_cond_broadcast(&pool->start);
+    pthread_mutex_unlock(&pool->mutex);
+
+    work(arg, 0);
+
+    pthread_mutex_lock(&pool->mutex);
+    while (pool->n_busy > 0)
+        pthread_cond_wait(&pool->done, &pool->mutex);
+    pthread_mutex_unlock(&pool->mutex);
+#endif
+}
+
+void freesasa_thread_pool_free(freesasa_thread_pool *pool)
+{
+#if USE_THREADS
+    int t, res;
+#endif
+
+    if (pool == NULL) return;
+
+#if USE_THREADS
+    pthread_mutex_lock(&pool->mutex);
+    pool->quit = 1;
+    pthread_cond_broadcast(&pool->start);
+    pthread_mutex_unlock(&pool->mutex);
+    for (t = 1; t < pool->n_threads; ++t) {
+        res = pthread_join(pool->thread[t], NULL);
+        if (res) fail_msg(freesasa_thread_error(res));
+    }
+    pthread_mutex_destroy(&pool->mutex);
+    pthread_cond_destroy(&pool->start);
+    pthread_cond_destroy(&pool->done);
+    free(pool->thread);
+    free(pool->worker);
+#endif
+    free(pool);
+}
+
 void freesasa_set_err_out(FILE *fp)
 {
     assert(fp);
@@ -2,8 +2,8 @@
 #include <config.h>
 #endif
 #include <assert.h>
+#include <ctype.h>
 #include <errno.h>
-#include <libxml/tree.h>
 #include <libxml/xmlwriter.h>
 #include <stdlib.h>
 #include <string.h>
@@ -15,603 +15,470 @@
 #define FREESASA_XMLNS "freesasa"
 #endif
 
-static xmlNodePtr
-nodearea2xml(const freesasa_nodearea *area,
-             const char *name)
-{
-    xmlNodePtr xml_node = xmlNewNode(NULL, BAD_CAST name);
-    char buf[20];
+/* The XML is written element by element while the result tree is
+   traversed, using an xmlTextWriter, memory use does not depend on
+   the size of the tree. */
 
-    sprintf(buf, "%.3f", area->total);
-    if (xmlNewProp(xml_node, BAD_CAST "total", BAD_CAST buf) == NULL) {
-        fail_msg("");
-        goto cleanup;
+static int
+xml_start(xmlTextWriterPtr writer,
+          const char *name)
+{
+    if (xmlTextWriterStartElement(writer, BAD_CAST name) < 0) {
+        return fail_msg("");
     }
+    return FREESASA_SUCCESS;
+}
 
-    sprintf(buf, "%.3f", area->polar);
-    if (xmlNewProp(xml_node, BAD_CAST "polar", BAD_CAST buf) == NULL) {
-        fail_msg("");
-        goto cleanup;
+static int
+xml_end(xmlTextWriterPtr writer)
+{
+    if (xmlTextWriterEndElement(writer) < 0) {
+        return fail_msg("");
     }
+    return FREESASA_SUCCESS;
+}
 
-    sprintf(buf, "%.3f", area->apolar);
-    if (xmlNewProp(xml_node, BAD_CAST "apolar", BAD_CAST buf) == NULL) {
-        fail_msg("");
-        goto cleanup;
+static int
+xml_attribute(xmlTextWriterPtr writer,
+              const char *name,
+              const char *value)
+{
+    if (xmlTextWriterWriteAttribute(writer, BAD_CAST name, BAD_CAST value) < 0) {
+        return fail_msg("");
     }
+    return FREESASA_SUCCESS;
+}
 
-    sprintf(buf, "%.3f", area->main_chain);
-    if (xmlNewProp(xml_node, BAD_CAST "mainChain", BAD_CAST buf) == NULL) {
-        fail_msg("");
-        goto cleanup;
-    }
+static int
+xml_attribute_double(xmlTextWriterPtr writer,
+                     const char *name,
+                     int precision,
+                     double value)
+{
+    char buf[FREESASA_FIXED_BUFSIZE];
 
-    sprintf(buf, "%.3f", area->side_chain);
-    if (xmlNewProp(xml_node, BAD_CAST "sideChain", BAD_CAST buf) == NULL) {
-        fail_msg("");
-        goto cleanup;
+    if (freesasa_format_fixed(buf, sizeof buf, value, 0, precision) >= (int)sizeof buf) {
+        if (xmlTextWriterWriteFormatAttribute(writer, BAD_CAST name, "%.*f", precision, value) < 0) {
+            return fail_msg("");
+        }
+        return FREESASA_SUCCESS;
     }
 
-    return xml_node;
-
-cleanup:
-    xmlFreeNode(xml_node);
-    return NULL;
+    return xml_attribute(writer, name, buf);
 }
 
-static xmlNodePtr
-atom2xml(const freesasa_node *node,
-         int options)
+static int
+xml_attribute_int(xmlTextWriterPtr writer,
+                  const char *name,
+                  int value)
 {
-    xmlNodePtr xml_node = NULL;
-    const freesasa_nodearea *area = freesasa_node_area(node);
-    const char *name = freesasa_node_name(node);
-    char *trim_name, buf[20];
-
-    assert(node);
-
-    area = freesasa_node_area(node);
-    name = freesasa_node_name(node);
-    trim_name = malloc(strlen(name) + 1);
-
-    if (!trim_name) {
-        mem_fail();
-        goto cleanup;
+    if (xmlTextWriterWriteFormatAttribute(writer, BAD_CAST name, "%d", value) < 0) {
+        return fail_msg("");
     }
+    return FREESASA_SUCCESS;
+}
 
-    sscanf(name, "%s", trim_name);
+/* Writes the first word of value, without surrounding whitespace */
+static int
+xml_attribute_trimmed(xmlTextWriterPtr writer,
+                      const char *name,
+                      const char *value)
+{
+    int len;
 
-    xml_node = xmlNewNode(NULL, BAD_CAST "atom");
-    if (xml_node == NULL) {
-        fail_msg("");
-        return NULL;
-    }
+    while (isspace((unsigned char)*value))
+        ++value;
+    for (len = 0; value[len] != '\0' && !isspace((unsigned char)value[len]); ++len)
+        ;
 
-    if (xmlNewProp(xml_node, BAD_CAST "name", BAD_CAST trim_name) == NULL) {
-        fail_msg("");
-        goto cleanup;
+    if (xmlTextWriterWriteFormatAttribute(writer, BAD_CAST name, "%.*s", len, value) < 0) {
+        return fail_msg("");
     }
+    return FREESASA_SUCCESS;
+}
 
-    sprintf(buf, "%.3f", area->total);
-    if (xmlNewProp(xml_node, BAD_CAST "area", BAD_CAST buf) == NULL) {
-        fail_msg("");
-        goto cleanup;
+static int
+nodearea2xml(xmlTextWriterPtr writer,
+             const freesasa_nodearea *area,
+             const char *name)
+{
+    if (xml_start(writer, name) ||
+        xml_attribute_double(writer, "total", 3, area->total) ||
+        xml_attribute_double(writer, "polar", 3, area->polar) ||
+        xml_attribute_double(writer, "apolar", 3, area->apolar) ||
+        xml_attribute_double(writer, "mainChain", 3, area->main_chain) ||
+        xml_attribute_double(writer, "sideChain", 3, area->side_chain) ||
+        xml_end(writer)) {
+        return fail_msg("");
     }
 
-    sprintf(buf, "%s", freesasa_node_atom_is_polar(node) == FREESASA_ATOM_POLAR ? "yes" : "no");
-    if (xmlNewProp(xml_node, BAD_CAST "isPolar", BAD_CAST buf) == NULL) {
-        fail_msg("");
-        goto cleanup;
-    }
+    return FREESASA_SUCCESS;
+}
 
-    sprintf(buf, "%s", freesasa_atom_is_backbone(name) ? "yes" : "no");
-    if (xmlNewProp(xml_node, BAD_CAST "isMainChain", BAD_CAST buf) == NULL) {
-        fail_msg("");
-        goto cleanup;
+static int
+atom2xml(xmlTextWriterPtr writer,
+         const char *name,
+         double area,
+         freesasa_atom_class the_class,
+         int is_bb,
+         double radius)
+{
+    if (xml_start(writer, "atom") ||
+        xml_attribute_trimmed(writer, "name", name) ||
+        xml_attribute_double(writer, "area", 3, area) ||
+        xml_attribute(writer, "isPolar",
+                      the_class == FREESASA_ATOM_POLAR ? "yes" : "no") ||
+        xml_attribute(writer, "isMainChain", is_bb ? "yes" : "no") ||
+        xml_attribute_double(writer, "radius", 3, radius) ||
+        xml_end(writer)) {
+        return fail_msg("");
     }
 
-    sprintf(buf, "%.3f", freesasa_node_atom_radius(node));
-    if (xmlNewProp(xml_node, BAD_CAST "radius", BAD_CAST buf) == NULL) {
-        fail_msg("");
-        goto cleanup;
-    }
+    return FREESASA_SUCCESS;
+}
 
-    free(trim_name);
-    return xml_node;
+/* The atoms are read from the atom records of the structure node,
+   the atom nodes are never created. */
+static int
+atoms2xml(xmlTextWriterPtr writer,
+          freesasa_node *residue)
+{
+    freesasa_node *structure = freesasa_node_parent(freesasa_node_parent(residue));
+    const freesasa_result *result = freesasa_node_structure_result(structure);
+    const char *name;
+    double radius;
+    freesasa_atom_class the_class;
+    int i, is_bb, first = freesasa_node_residue_first_atom(residue),
+                  n = freesasa_node_residue_n_atoms(residue);
+
+    for (i = first; i < first + n; ++i) {
+        // tree was created without atoms
+        if (freesasa_node_structure_atom(structure, i, &name, &radius, &the_class, &is_bb)) {
+            break;
+        }
+        if (atom2xml(writer, name, result->sasa[i], the_class, is_bb, radius)) {
+            return fail_msg("");
+        }
+    }
 
-cleanup:
-    free(trim_name);
-    xmlFreeNode(xml_node);
-    return NULL;
+    return FREESASA_SUCCESS;
 }
 
-static xmlNodePtr
-residue2xml(const freesasa_node *node,
+static int
+residue2xml(xmlTextWriterPtr writer,
+            const freesasa_node *node,
             int options)
 {
-    xmlNodePtr xml_node = NULL, xml_area = NULL, xml_relarea = NULL;
-    const char *name, *number;
     const freesasa_nodearea *abs, *reference;
-    char *trim_number, *trim_name;
     freesasa_nodearea rel;
 
     assert(node);
 
-    name = freesasa_node_name(node);
-    number = freesasa_node_residue_number(node);
     abs = freesasa_node_area(node);
     reference = freesasa_node_residue_reference(node);
-    trim_number = malloc(strlen(number) + 1);
-    trim_name = malloc(strlen(name) + 1);
-
-    if (!trim_number || !trim_name) {
-        mem_fail();
-        goto cleanup;
-    }
-
-    sscanf(number, "%s", trim_number);
-    sscanf(name, "%s", trim_name);
-
-    xml_node = xmlNewNode(NULL, BAD_CAST "residue");
-    if (xml_node == NULL) {
-        fail_msg("");
-        return NULL;
-    }
 
-    if (xmlNewProp(xml_node, BAD_CAST "name", BAD_CAST trim_name) == NULL ||
-        xmlNewProp(xml_node, BAD_CAST "number", BAD_CAST trim_number) == NULL) {
-        fail_msg("");
-        goto cleanup;
-    }
-
-    xml_area = nodearea2xml(abs, "area");
-    if (xml_area == NULL) {
-        fail_msg("");
-        goto cleanup;
-    }
-
-    if (xmlAddChild(xml_node, xml_area) == NULL) {
-        xmlFreeNode(xml_area);
-        fail_msg("");
-        goto cleanup;
+    if (xml_start(writer, "residue") ||
+        xml_attribute_trimmed(writer, "name", freesasa_node_name(node)) ||
+        xml_attribute_trimmed(writer, "number", freesasa_node_residue_number(node)) ||
+        nodearea2xml(writer, abs, "area")) {
+        return fail_msg("");
     }
 
     if ((reference != NULL) && !(options & FREESASA_OUTPUT_SKIP_REL)) {
         freesasa_residue_rel_nodearea(&rel, abs, reference);
-        xml_relarea = nodearea2xml(&rel, "relativeArea");
-        if (xml_relarea == NULL) {
-            fail_msg("");
-            goto cleanup;
-        }
-        if (xmlAddChild(xml_node, xml_relarea) == NULL) {
-            xmlFreeNode(xml_relarea);
-            fail_msg("");
-            goto cleanup;
+        if (nodearea2xml(writer, &rel, "relativeArea")) {
+            return fail_msg("");
         }
     }
 
-    free(trim_name);
-    free(trim_number);
-    return xml_node;
-
-cleanup:
-    free(trim_name);
-    free(trim_number);
-    xmlFreeNode(xml_node);
-    return NULL;
+    return FREESASA_SUCCESS;
 }
 
-static xmlNodePtr
-chain2xml(const freesasa_node *node,
+static int
+chain2xml(xmlTextWriterPtr writer,
+          const freesasa_node *node,
           int options)
 {
-    xmlNodePtr xml_node = NULL, xml_area = NULL;
-    char buf[20];
-
-    xml_node = xmlNewNode(NULL, BAD_CAST "chain");
-    if (xml_node == NULL) {
-        fail_msg("");
-        return NULL;
-    }
-
-    if (xmlNewProp(xml_node, BAD_CAST "label",
-                   BAD_CAST freesasa_node_name(node)) == NULL) {
-        fail_msg("");
-        goto cleanup;
-    }
-
-    sprintf(buf, "%d", freesasa_node_chain_n_residues(node));
-    if (xmlNewProp(xml_node, BAD_CAST "nResidues", BAD_CAST buf) == NULL) {
-        fail_msg("");
-        goto cleanup;
-    }
-
-    xml_area = nodearea2xml(freesasa_node_area(node), "area");
-    if (xml_area == NULL) {
-        fail_msg("");
-        goto cleanup;
-    }
-
-    if (xmlAddChild(xml_node, xml_area) == NULL) {
-        fail_msg("");
-        xmlFreeNode(xml_area);
-        goto cleanup;
+    if (xml_start(writer, "chain") ||
+        xml_attribute(writer, "label", freesasa_node_name(node)) ||
+        xml_attribute_int(writer, "nResidues", freesasa_node_chain_n_residues(node)) ||
+        nodearea2xml(writer, freesasa_node_area(node), "area")) {
+        return fail_msg("");
     }
 
-    return xml_node;
-
-cleanup:
-    xmlFreeNode(xml_node);
-    return NULL;
+    return FREESASA_SUCCESS;
 }
 
-static xmlNodePtr
-selection2xml(const freesasa_selection *selection)
+static int
+selection2xml(xmlTextWriterPtr writer,
+              const freesasa_selection *selection)
 {
-    xmlNodePtr xml_selection = xmlNewNode(NULL, BAD_CAST "selection");
-    char buf[20];
-
-    sprintf(buf, "%.3f", freesasa_selection_area(selection));
-
-    if (xml_selection == NULL) {
-        fail_msg("");
-    } else {
-        if (xmlNewProp(xml_selection, BAD_CAST "name", BAD_CAST freesasa_selection_name(selection)) == NULL ||
-            xmlNewProp(xml_selection, BAD_CAST "area", BAD_CAST buf) == NULL) {
-            fail_msg("");
-            xmlFreeNode(xml_selection);
-            xml_selection = NULL;
-        }
+    if (xml_start(writer, "selection") ||
+        xml_attribute(writer, "name", freesasa_selection_name(selection)) ||
+        xml_attribute_double(writer, "area", 3, freesasa_selection_area(selection)) ||
+        xml_end(writer)) {
+        return fail_msg("");
     }
 
-    return xml_selection;
-}
-
-static xmlNodePtr
-add_selections_to_xmlNode(const freesasa_selection **selections,
-                          xmlNodePtr parent)
-{
-    xmlNodePtr xml_selection;
-
-    while (*selections) {
-        xml_selection = selection2xml(*selections);
-        if (xml_selection == NULL) {
-            fail_msg("");
-            return NULL;
-        }
-
-        if (xmlAddChild(parent, xml_selection) == NULL) {
-            fail_msg("");
-            xmlFreeNode(xml_selection);
-            return NULL;
-        }
-        ++selections;
-    }
-    return parent;
+    return FREESASA_SUCCESS;
 }
 
-static xmlNodePtr
-structure2xml(const freesasa_node *node,
+static int
+structure2xml(xmlTextWriterPtr writer,
+              const freesasa_node *node,
               int options)
 {
-    xmlNodePtr xml_node = NULL, xml_area = NULL;
-    char buf[20];
     const freesasa_selection **selections;
 
     assert(node);
 
     selections = freesasa_node_structure_selections(node);
 
-    xml_node = xmlNewNode(NULL, BAD_CAST "structure");
-    if (xml_node == NULL) {
-        fail_msg("");
-        return NULL;
-    }
-
-    if (xmlNewProp(xml_node, BAD_CAST "chains", BAD_CAST freesasa_node_structure_chain_labels(node)) == NULL) {
-        fail_msg("");
-        goto cleanup;
-    }
-
-    sprintf(buf, "%d", freesasa_node_structure_model(node));
-    if (xmlNewProp(xml_node, BAD_CAST "model", BAD_CAST buf) == NULL) {
-        fail_msg("");
-        goto cleanup;
-    }
-
-    xml_area = nodearea2xml(freesasa_node_area(node), "area");
-    if (xml_area == NULL) {
-        fail_msg("");
-        goto cleanup;
-    }
-
-    if (xmlAddChild(xml_node, xml_area) == NULL) {
-        fail_msg("");
-        xmlFreeNode(xml_area);
-        goto cleanup;
+    if (xml_start(writer, "structure") ||
+        xml_attribute(writer, "chains", freesasa_node_structure_chain_labels(node)) ||
+        xml_attribute_int(writer, "model", freesasa_node_structure_model(node)) ||
+        nodearea2xml(writer, freesasa_node_area(node), "area")) {
+        return fail_msg("");
     }
 
     if (selections) {
-        if (add_selections_to_xmlNode(selections, xml_node) == NULL) {
-            fail_msg("");
-            goto cleanup;
+        while (*selections) {
+            if (selection2xml(writer, *selections)) {
+                return fail_msg("");
+            }
+            ++selections;
         }
     }
 
-    return xml_node;
-
-cleanup:
-    xmlFreeNode(xml_node);
-    return NULL;
+    return FREESASA_SUCCESS;
 }
 
-/* Root is not converted to xmlNodePtr, we skip immediately to children */
+/* Writes the start of the element and its attributes, then the
+   children, and closes the element. */
 static int
-node2xml(xmlNodePtr *xml_node,
+node2xml(xmlTextWriterPtr writer,
          freesasa_node *node,
          int exclude_type,
          int options)
 {
-    freesasa_node *child;
-    xmlNodePtr xml_child = NULL;
+    freesasa_node *child = NULL;
+    int ret;
 
-    assert(xml_node);
     assert(node);
 
-    child = freesasa_node_children(node);
-    *xml_node = NULL;
-
     if (freesasa_node_type(node) == exclude_type) return FREESASA_SUCCESS;
 
     switch (freesasa_node_type(node)) {
     case FREESASA_NODE_STRUCTURE:
-        *xml_node = structure2xml(node, options);
+        ret = structure2xml(writer, node, options);
         break;
     case FREESASA_NODE_CHAIN:
-        *xml_node = chain2xml(node, options);
+        ret = chain2xml(writer, node, options);
         break;
     case FREESASA_NODE_RESIDUE:
-        *xml_node = residue2xml(node, options);
-        break;
-    case FREESASA_NODE_ATOM:
-        *xml_node = atom2xml(node, options);
+        ret = residue2xml(writer, node, options);
         break;
     case FREESASA_NODE_ROOT:
     default:
         assert(0 && "tree illegal");
+        ret = FREESASA_FAIL;
     }
-    if (*xml_node == NULL)
+    if (ret == FREESASA_FAIL)
         return fail_msg("error creating XML-node");
 
-    /* simplify? */
-    while (child != NULL) {
-        if (node2xml(&xml_child, child, exclude_type, options) == FREESASA_FAIL) {
-            return fail_msg("");
+    // children are one level further down in the hierarchy
+    if (freesasa_node_type(node) - 1 != exclude_type) {
+        if (freesasa_node_type(node) == FREESASA_NODE_RESIDUE) {
+            if (atoms2xml(writer, node)) return fail_msg("");
+        } else {
+            child = freesasa_node_children(node);
         }
+    }
 
-        if (xml_child != NULL &&
-            xmlAddChild(*xml_node, xml_child) == NULL) {
-            xmlFreeNode(*xml_node);
-            xmlFreeNode(xml_child);
+    while (child != NULL) {
+        if (node2xml(writer, child, exclude_type, options) == FREESASA_FAIL) {
             return fail_msg("");
         }
         child = freesasa_node_next(child);
     }
 
-    return FREESASA_SUCCESS;
+    return xml_end(writer);
 }
 
-static xmlNodePtr
-parameters2xml(const freesasa_parameters *p)
+static int
+parameters2xml(xmlTextWriterPtr writer,
+               const freesasa_parameters *p)
 {
-    xmlNodePtr xml_node = xmlNewNode(NULL, BAD_CAST "parameters");
-    char buf[20];
-
-    if (xml_node == NULL) {
-        fail_msg("");
-        return NULL;
-    }
-
-    if (xmlNewProp(xml_node, BAD_CAST "algorithm", BAD_CAST freesasa_alg_name(p->alg)) == NULL) {
-        fail_msg("");
-        goto cleanup;
-    }
-
-    sprintf(buf, "%f", p->probe_radius);
-    if (xmlNewProp(xml_node, BAD_CAST "probeRadius", BAD_CAST buf) == NULL) {
-        fail_msg("");
-        goto cleanup;
-    }
+    int resolution = 0;
 
     switch (p->alg) {
     case FREESASA_SHRAKE_RUPLEY:
-        sprintf(buf, "%d", p->shrake_rupley_n_points);
+        resolution = p->shrake_rupley_n_points;
         break;
     case FREESASA_LEE_RICHARDS:
-        sprintf(buf, "%d", p->lee_richards_n_slices);
+        resolution = p->lee_richards_n_slices;
         break;
     default:
         assert(0);
         break;
     }
-    if (xmlNewProp(xml_node, BAD_CAST "resolution", BAD_CAST buf) == NULL) {
-        fail_msg("");
-        goto cleanup;
-    }
 
-    return xml_node;
+    if (xml_start(writer, "parameters") ||
+        xml_attribute(writer, "algorithm", freesasa_alg_name(p->alg)) ||
+        xml_attribute_double(writer, "probeRadius", 6, p->probe_radius) ||
+        xml_attribute_int(writer, "resolution", resolution) ||
+        xml_end(writer)) {
+        return fail_msg("");
+    }
 
-cleanup:
-    xmlFreeNode(xml_node);
-    return NULL;
+    return FREESASA_SUCCESS;
 }
 
-static xmlNodePtr
-xml_result(freesasa_node *result,
+static int
+xml_result(xmlTextWriterPtr writer,
+           freesasa_node *result,
            int options)
 {
-    xmlNodePtr xml_result_node = NULL, xml_structure = NULL, xml_param = NULL;
     freesasa_node *child = NULL;
-    const freesasa_parameters *parameters;
     int exclude_type = FREESASA_NODE_NONE;
 
     assert(freesasa_node_type(result) == FREESASA_NODE_RESULT);
 
-    parameters = freesasa_node_result_parameters(result);
-
     if (options & FREESASA_OUTPUT_STRUCTURE) exclude_type = FREESASA_NODE_CHAIN;
     if (options & FREESASA_OUTPUT_CHAIN) exclude_type = FREESASA_NODE_RESIDUE;
     if (options & FREESASA_OUTPUT_RESIDUE) exclude_type = FREESASA_NODE_ATOM;
 
-    xml_result_node = xmlNewNode(NULL, BAD_CAST "result");
-    if (xml_result_node == NULL) {
-        fail_msg("");
-        return NULL;
-    }
-
-    xml_param = parameters2xml(parameters);
-    if (xml_param == NULL) {
-        fail_msg("");
-        goto cleanup;
-    }
-
-    if (xmlAddChild(xml_result_node, xml_param) == NULL) {
-        fail_msg("");
-        xmlFreeNode(xml_param);
-        goto cleanup;
-    }
-
-    if (xmlNewProp(xml_result_node, BAD_CAST "classifier",
-                   BAD_CAST freesasa_node_classified_by(result)) == NULL) {
-        fail_msg("");
-        goto cleanup;
-    }
-
-    if (xmlNewProp(xml_result_node, BAD_CAST "input",
-                   BAD_CAST freesasa_node_name(result)) == NULL) {
-        fail_msg("");
-        goto cleanup;
+    if (xml_start(writer, "result") ||
+        xml_attribute(writer, "classifier", freesasa_node_classified_by(result)) ||
+        xml_attribute(writer, "input", freesasa_node_name(result)) ||
+        parameters2xml(writer, freesasa_node_result_parameters(result))) {
+        return fail_msg("");
     }
 
     child = freesasa_node_children(result);
     assert(child);
 
     while (child) {
-        if (node2xml(&xml_structure, child, exclude_type, options) == FREESASA_FAIL) {
-            fail_msg("");
-            goto cleanup;
-        }
-        if (xmlAddChild(xml_result_node, xml_structure) == NULL) {
-            fail_msg("");
-            goto cleanup;
+        if (node2xml(writer, child, exclude_type, options) == FREESASA_FAIL) {
+            return fail_msg("");
         }
         child = freesasa_node_next(child);
     };
 
-    return xml_result_node;
-cleanup:
-    xmlFreeNode(xml_structure);
-    xmlFreeNode(xml_result_node);
-    return NULL;
+    return xml_end(writer);
 }
 
-int freesasa_write_xml(FILE *output,
-                       freesasa_node *root,
-                       int options)
+struct freesasa_xml_stream {
+    xmlTextWriterPtr writer;
+    FILE *output;
+    int options;
+};
+
+freesasa_xml_stream *
+freesasa_xml_stream_open(FILE *output,
+                         int options)
 {
-    freesasa_node *child = NULL;
-    xmlDocPtr doc = NULL;
-    xmlNodePtr xml_root = NULL, xml_result_node = NULL;
-    xmlNsPtr ns = NULL;
-    xmlBufferPtr buf = NULL;
+    freesasa_xml_stream *stream = NULL;
+    xmlOutputBufferPtr buf = NULL;
     xmlTextWriterPtr writer = NULL;
-    int ret = FREESASA_FAIL;
-
-    assert(freesasa_node_type(root) == FREESASA_NODE_ROOT);
 
-    doc = xmlNewDoc(BAD_CAST "1.0");
-    if (doc == NULL) {
+    buf = xmlOutputBufferCreateFile(output, NULL);
+    if (buf == NULL) {
         fail_msg("");
         goto cleanup;
     }
 
-    xml_root = xmlNewNode(NULL, BAD_CAST "results");
-    if (xml_root == NULL) {
+    writer = xmlNewTextWriter(buf);
+    if (writer == NULL) {
+        xmlOutputBufferClose(buf);
         fail_msg("");
         goto cleanup;
     }
 
-    ns = xmlNewNs(xml_root, BAD_CAST FREESASA_XMLNS, NULL);
-    if (ns == NULL) {
+    if (xmlTextWriterSetIndent(writer, 1) == -1 ||
+        xmlTextWriterSetIndentString(writer, BAD_CAST "  ") == -1) {
         fail_msg("");
-        xmlFreeNode(xml_root);
         goto cleanup;
     }
 
-    xmlDocSetRootElement(doc, xml_root);
-
-    /* global attributes */
-    if (xmlNewProp(xml_root, BAD_CAST "source", BAD_CAST freesasa_string) == NULL) {
+    if (xmlTextWriterStartDocument(writer, XML_DEFAULT_VERSION,
+                                   xmlGetCharEncodingName(XML_CHAR_ENCODING_UTF8), NULL) == -1) {
         fail_msg("");
         goto cleanup;
     }
-    if (xmlNewProp(xml_root, BAD_CAST "lengthUnit", BAD_CAST "Ångström") == NULL) {
+
+    /* global attributes, the unit is written with character
+       references, as when the output was generated from a DOM */
+    if (xml_start(writer, "results") ||
+        xml_attribute(writer, "xmlns", FREESASA_XMLNS) ||
+        xml_attribute(writer, "source", freesasa_string) ||
+        xmlTextWriterStartAttribute(writer, BAD_CAST "lengthUnit") < 0 ||
+        xmlTextWriterWriteRaw(writer, BAD_CAST "&#xC5;ngstr&#xF6;m") < 0 ||
+        xmlTextWriterEndAttribute(writer) < 0) {
         fail_msg("");
         goto cleanup;
     }
 
+    stream = malloc(sizeof(freesasa_xml_stream));
+    if (stream == NULL) {
+        mem_fail();
+        goto cleanup;
+    }
+    stream->writer = writer;
+    stream->output = output;
+    stream->options = options;
+
+    return stream;
+
+cleanup:
+    xmlFreeTextWriter(writer);
+    return NULL;
+}
+
+int freesasa_xml_stream_add(freesasa_xml_stream *stream,
+                            freesasa_node *root)
+{
+    freesasa_node *child = NULL;
+
+    assert(freesasa_node_type(root) == FREESASA_NODE_ROOT);
+
     child = freesasa_node_children(root);
     while (child) {
-        xml_result_node = xml_result(child, options);
-        if (xml_result_node == NULL) {
-            fail_msg("");
-            goto cleanup;
-        }
-        if (xmlAddChild(xml_root, xml_result_node) == NULL) {
-            fail_msg("");
-            xmlFreeNode(xml_result_node);
-            goto cleanup;
+        if (xml_result(stream->writer, child, stream->options)) {
+            return fail_msg("");
         }
         child = freesasa_node_next(child);
     }
 
-    buf = xmlBufferCreate();
-    if (buf == NULL) {
-        fail_msg("");
-        goto cleanup;
+    if (xmlTextWriterFlush(stream->writer) == -1) {
+        return fail_msg("");
     }
 
-    writer = xmlNewTextWriterMemory(buf, 0);
-    if (writer == NULL) {
-        xmlBufferFree(buf);
-        fail_msg("");
-        goto cleanup;
+    fflush(stream->output);
+    if (ferror(stream->output)) {
+        return fail_msg(strerror(errno));
     }
 
-    if (xmlTextWriterStartDocument(writer, XML_DEFAULT_VERSION,
-                                   xmlGetCharEncodingName(XML_CHAR_ENCODING_UTF8), NULL) == -1) {
-        fail_msg("");
-        goto cleanup;
-    }
+    return FREESASA_SUCCESS;
+}
 
-    if (xmlTextWriterFlush(writer) == -1) {
-        fail_msg("");
-        goto cleanup;
-    }
+int freesasa_xml_stream_close(freesasa_xml_stream *stream)
+{
+    int ret = FREESASA_FAIL;
 
-    if (xmlNodeDump(buf, doc, xml_root, 0, 1) == 0) {
+    if (xml_end(stream->writer) ||
+        xmlTextWriterEndDocument(stream->writer) == -1) {
         fail_msg("");
         goto cleanup;
     }
 
-    if (xmlTextWriterEndDocument(writer) == -1) {
+    if (xmlTextWriterFlush(stream->writer) == -1) {
         fail_msg("");
         goto cleanup;
     }
 
-    fprintf(output, "%s", (const char *)buf->content);
-    fflush(output);
-    if (ferror(output)) {
+    fflush(stream->output);
+    if (ferror(stream->output)) {
         fail_msg(strerror(errno));
         goto cleanup;
     }
@@ -619,7 +486,22 @@ int freesasa_write_xml(FILE *output,
     ret = FREESASA_SUCCESS;
 
 cleanup:
-    xmlFreeDoc(doc);
-    xmlFreeTextWriter(writer);
+    xmlFreeTextWriter(stream->writer);
+    free(stream);
+    return ret;
+}
+
+int freesasa_write_xml(FILE *output,
+                       freesasa_node *root,
+                       int options)
+{
+    freesasa_xml_stream *stream = freesasa_xml_stream_open(output, options);
+    int ret;
+
+    if (stream == NULL) return fail_msg("");
+
+    ret = freesasa_xml_stream_add(stream, root);
+    if (freesasa_xml_stream_close(stream) == FREESASA_FAIL) ret = FREESASA_FAIL;
+
     return ret;
 }
@@ -0,0 +1,163 @@
+#include <check.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#if HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include <freesasa.h>
+#include <freesasa_internal.h>
+
+#include "tools.h"
+
+static freesasa_structure *ubq;
+static freesasa_result *result;
+static freesasa_node *tree;
+
+static void setup(void)
+{
+    FILE *pdb = fopen(DATADIR "1ubq.pdb", "r");
+    ubq = freesasa_structure_from_pdb(pdb, &freesasa_default_classifier, 0);
+    fclose(pdb);
+    result = freesasa_calc_structure(ubq, NULL);
+    tree = freesasa_tree_init(result, ubq, "1ubq", FREESASA_OUTPUT_ATOM);
+}
+
+static void teardown(void)
+{
+    freesasa_structure_free(ubq);
+    freesasa_result_free(result);
+    freesasa_node_free(tree);
+}
+
+static void
+write_bin(const char *filename, int options)
+{
+    FILE *output = fopen(filename, "wb");
+    ck_assert_ptr_ne(output, NULL);
+    ck_assert_int_eq(freesasa_tree_export(output, tree, FREESASA_BIN | options), FREESASA_SUCCESS);
+    fclose(output);
+}
+
+static void
+check_map(const freesasa_mapped_result *map, double tolerance)
+{
+    freesasa_node *structure = freesasa_node_children(freesasa_node_children(tree));
+    freesasa_node *chain = freesasa_node_children(structure);
+    freesasa_node *residue = freesasa_node_children(chain), *atom;
+    const freesasa_mapped_structure *s = &map->structure[0];
+    int i, j = 0;
+
+    ck_assert_int_eq(map->n_structures, 1);
+    ck_assert_int_eq(map->n_chains, 1);
+    ck_assert_int_eq(map->n_residues, 76);
+    ck_assert_int_eq(map->n_atoms, 602);
+
+    ck_assert_int_eq(s->first_chain, 0);
+    ck_assert_int_eq(s->n_chains, 1);
+    ck_assert_int_eq(s->first_atom, 0);
+    ck_assert_int_eq(s->n_atoms, 602);
+    ck_assert_int_eq(s->algorithm, FREESASA_LEE_RICHARDS);
+    ck_assert_int_eq(s->resolution, freesasa_default_parameters.lee_richards_n_slices);
+    ck_assert(s->probe_radius == freesasa_default_parameters.probe_radius);
+    ck_assert(s->total == result->total);
+    ck_assert(s->polar == freesasa_node_area(structure)->polar);
+    ck_assert_str_eq(map->strings + s->name, "1ubq");
+    ck_assert_str_eq(map->strings + s->classified_by, freesasa_node_classified_by(freesasa_node_children(tree)));
+
+    ck_assert_int_eq(map->chain_label[0], 'A');
+    ck_assert_int_eq(map->chain_residues[0], 0);
+    ck_assert_int_eq(map->chain_residues[1], 76);
+    ck_assert(float_eq(freesasa_mapped_result_value(map, map->chain_area, 0),
+                       freesasa_node_area(chain)->total, tolerance));
+
+    for (i = 0; residue != NULL; ++i, residue = freesasa_node_next(residue)) {
+        ck_assert_str_eq(map->residue_name[i], freesasa_node_name(residue));
+        ck_assert_str_eq(map->residue_number[i], freesasa_node_residue_number(residue));
+        ck_assert_int_eq(map->residue_atoms[i], j);
+        ck_assert(float_eq(freesasa_mapped_result_value(map, map->residue_area, 6 * i + 3),
+                           freesasa_node_area(residue)->polar, tolerance));
+        for (atom = freesasa_node_children(residue); atom != NULL; atom = freesasa_node_next(atom), ++j) {
+            ck_assert_str_eq(map->atom_name[j], freesasa_node_name(atom));
+            ck_assert_int_eq(map->atom_class[j], freesasa_structure_atom_class(ubq, j));
+            ck_assert_int_eq(map->atom_mainchain[j], freesasa_node_atom_is_mainchain(atom));
+            ck_assert(float_eq(freesasa_mapped_result_value(map, map->atom_radius, j),
+                               freesasa_node_atom_radius(atom), tolerance));
+            ck_assert(float_eq(freesasa_mapped_result_value(map, map->atom_area, j),
+                               result->sasa[j], tolerance));
+        }
+    }
+    ck_assert_int_eq(i, 76);
+    ck_assert_int_eq(map->residue_atoms[76], 602);
+}
+
+START_TEST(test_write_map)
+{
+    freesasa_mapped_result *map;
+
+    write_bin("tmp/1ubq.bin", 0);
+    map = freesasa_result_map("tmp/1ubq.bin");
+    ck_assert_ptr_ne(map, NULL);
+    ck_assert_int_eq(map->area_size, sizeof(double));
+    check_map(map, 1e-10);
+    freesasa_mapped_result_free(map);
+
+    write_bin("tmp/1ubq-float.bin", FREESASA_BIN_FLOAT);
+    map = freesasa_result_map("tmp/1ubq-float.bin");
+    ck_assert_ptr_ne(map, NULL);
+    ck_assert_int_eq(map->area_size, sizeof(float));
+    check_map(map, 1e-3);
+    freesasa_mapped_result_free(map);
+}
+END_TEST
+
+START_TEST(test_errors)
+{
+    freesasa_node *residue_tree = freesasa_tree_init(result, ubq, "1ubq", FREESASA_OUTPUT_RESIDUE);
+    FILE *input, *output;
+    char buf[256];
+    size_t n;
+
+    freesasa_set_verbosity(FREESASA_V_SILENT);
+
+    // no atoms in tree
+    output = fopen("tmp/residue.bin", "wb");
+    ck_assert_int_eq(freesasa_write_bin(output, residue_tree, 0), FREESASA_FAIL);
+    fclose(output);
+    freesasa_node_free(residue_tree);
+
+    ck_assert_ptr_eq(freesasa_result_map("tmp/nonexistent.bin"), NULL);
+    ck_assert_ptr_eq(freesasa_result_map(DATADIR "1ubq.pdb"), NULL);
+
+    // truncated file
+    write_bin("tmp/1ubq.bin", 0);
+    input = fopen("tmp/1ubq.bin", "rb");
+    n = fread(buf, 1, sizeof buf, input);
+    fclose(input);
+    output = fopen("tmp/truncated.bin", "wb");
+    fwrite(buf, 1, n, output);
+    fclose(output);
+    ck_assert_ptr_eq(freesasa_result_map("tmp/truncated.bin"), NULL);
+
+    set_fail_after(1);
+    ck_assert_ptr_eq(freesasa_result_map("tmp/1ubq.bin"), NULL);
+    set_fail_after(0);
+
+    freesasa_set_verbosity(FREESASA_V_NORMAL);
+}
+END_TEST
+
+Suite *bin_suite()
+{
+    Suite *s = suite_create("Binary output");
+    TCase *tc_core = tcase_create("Core");
+    tcase_add_checked_fixture(tc_core, setup, teardown);
+    tcase_add_test(tc_core, test_write_map);
+    tcase_add_test(tc_core, test_errors);
+
+    suite_add_tcase(s, tc_core);
+
+    return s;
+}
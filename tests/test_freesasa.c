@@ -250,7 +250,7 @@ START_TEST(test_write_pdb)
     freesasa_structure *s = freesasa_structure_from_pdb(pdb, NULL, 0);
     const int n = freesasa_structure_n(s);
     freesasa_result res;
-    freesasa_node *root;
+    freesasa_node *root, *residues;
     fclose(pdb);
 
     res.sasa = malloc(sizeof(double) * n);
@@ -260,9 +260,16 @@ START_TEST(test_write_pdb)
     res.n_atoms = n;
 
     freesasa_structure_set_radius(s, res.sasa);
-    root = freesasa_tree_init(&res, s, "bla");
+    root = freesasa_tree_init(&res, s, "bla", FREESASA_OUTPUT_ATOM);
     ck_assert(freesasa_write_pdb(tf, root) == FREESASA_SUCCESS);
 
+    // the atoms are needed, a tree that stops at the residues is not enough
+    residues = freesasa_tree_init(&res, s, "bla", FREESASA_OUTPUT_RESIDUE);
+    freesasa_set_verbosity(FREESASA_V_SILENT);
+    ck_assert_int_eq(freesasa_write_pdb(devnull, residues), FREESASA_FAIL);
+    freesasa_set_verbosity(FREESASA_V_NORMAL);
+    freesasa_node_free(residues);
+
     rewind(tf);
     free(res.sasa);
 
@@ -287,7 +294,7 @@ START_TEST(test_write_pdb)
     s = freesasa_structure_new();
     freesasa_structure_add_atom(s, "C", "ALA", "   1", 'C', 0, 0, 0);
     freesasa_set_verbosity(FREESASA_V_SILENT);
-    root = freesasa_tree_init(&res, s, "bla");
+    root = freesasa_tree_init(&res, s, "bla", FREESASA_OUTPUT_ATOM);
     ck_assert_int_eq(freesasa_write_pdb(devnull, root), FREESASA_FAIL);
     freesasa_set_verbosity(FREESASA_V_NORMAL);
 
@@ -472,6 +479,257 @@ START_TEST(test_1d3z)
 }
 END_TEST
 
+// the models of 1D3Z as frames of a trajectory
+START_TEST(test_trajectory)
+{
+    FILE *pdb = fopen(DATADIR "1d3z.pdb", "r");
+    int n = 0, n_atoms, i, j, k, a;
+    freesasa_structure **ss = freesasa_structure_array(pdb, &n, NULL, FREESASA_SEPARATE_MODELS);
+    freesasa_parameters param = freesasa_default_parameters;
+    freesasa_algorithm alg[] = {FREESASA_SHRAKE_RUPLEY, FREESASA_LEE_RICHARDS};
+    freesasa_trajectory *traj;
+    freesasa_result *ref;
+    const double *xyz;
+    double *xyz_d, *sasa;
+    float *xyz_f;
+
+    fclose(pdb);
+    ck_assert(n == 10);
+    n_atoms = freesasa_structure_n(ss[0]);
+    xyz_f = malloc(sizeof(float) * 3 * n_atoms);
+    xyz_d = malloc(sizeof(double) * 3 * n_atoms);
+    sasa = malloc(sizeof(double) * n_atoms);
+
+    for (a = 0; a < 2; ++a) {
+        param.alg = alg[a];
+        param.n_threads = USE_THREADS ? 2 : 1;
+        traj = freesasa_trajectory_new(ss[0], &param);
+        ck_assert(traj != NULL);
+        for (i = 0; i < n; ++i) {
+            xyz = freesasa_coord_all(freesasa_structure_xyz(ss[i]));
+            for (j = 0; j < 3 * n_atoms; ++j) {
+                xyz_f[j] = (float)xyz[j];
+                xyz_d[j] = xyz_f[j];
+            }
+            ck_assert_int_eq(freesasa_trajectory_calc_frame(traj, xyz_f, sasa), FREESASA_SUCCESS);
+            ref = freesasa_calc_coord(xyz_d, freesasa_structure_radius(ss[0]), n_atoms, &param);
+            ck_assert(ref != NULL);
+            for (k = 0; k < n_atoms; ++k) {
+                ck_assert(sasa[k] == ref->sasa[k]);
+            }
+            freesasa_result_free(ref);
+        }
+        freesasa_trajectory_free(traj);
+    }
+
+    freesasa_set_verbosity(FREESASA_V_SILENT);
+    param.shrake_rupley_n_points = 0;
+    param.alg = FREESASA_SHRAKE_RUPLEY;
+    ck_assert(freesasa_trajectory_new(ss[0], &param) == NULL);
+    freesasa_set_verbosity(FREESASA_V_NORMAL);
+
+    for (i = 0; i < n; ++i) {
+        freesasa_structure_free(ss[i]);
+    }
+    free(ss);
+    free(xyz_f);
+    free(xyz_d);
+    free(sasa);
+}
+END_TEST
+
+static void
+move_and_compare(freesasa_result *result,
+                 freesasa_workspace *ws,
+                 double *xyz,
+                 const double *radii,
+                 int n_atoms,
+                 const int *moved,
+                 int n_moved,
+                 const double *shift)
+{
+    double *new_xyz = malloc(sizeof(double) * 3 * (n_moved + 1));
+    freesasa_result *ref;
+    int i, j;
+
+    for (i = 0; i < n_moved; ++i) {
+        for (j = 0; j < 3; ++j) {
+            new_xyz[3 * i + j] = xyz[3 * moved[i] + j] + shift[j];
+            xyz[3 * moved[i] + j] = new_xyz[3 * i + j];
+        }
+    }
+    ck_assert_int_eq(freesasa_result_update(result, ws, moved, n_moved, new_xyz), FREESASA_SUCCESS);
+    ref = freesasa_calc_coord(xyz, radii, n_atoms, &result->parameters);
+    ck_assert(ref != NULL);
+    for (i = 0; i < n_atoms; ++i) {
+        ck_assert(result->sasa[i] == ref->sasa[i]);
+    }
+    ck_assert(result->total == ref->total);
+    freesasa_result_free(ref);
+    free(new_xyz);
+}
+
+START_TEST(test_result_update)
+{
+    FILE *pdb = fopen(DATADIR "1ubq.pdb", "r");
+    freesasa_structure *st = freesasa_structure_from_pdb(pdb, NULL, 0);
+    freesasa_parameters param = freesasa_default_parameters;
+    freesasa_algorithm alg[] = {FREESASA_SHRAKE_RUPLEY, FREESASA_LEE_RICHARDS};
+    int n_atoms = freesasa_structure_n(st), i, a;
+    const double *radii = freesasa_structure_radius(st);
+    double *xyz = malloc(sizeof(double) * 3 * n_atoms);
+    int residue[10], one[] = {100}, twice[] = {5, 6, 5}, outside[] = {-1};
+    double shift[] = {0.7, -0.3, 0.5}, far[] = {30, 0, 0}, back[] = {-30, 0, 0};
+    freesasa_workspace *ws;
+    freesasa_result *result;
+
+    fclose(pdb);
+    for (i = 0; i < 10; ++i)
+        residue[i] = 10 + i;
+
+    for (a = 0; a < 2; ++a) {
+        param.alg = alg[a];
+        param.n_threads = USE_THREADS ? 2 : 1;
+        memcpy(xyz, freesasa_coord_all(freesasa_structure_xyz(st)), sizeof(double) * 3 * n_atoms);
+        ws = freesasa_workspace_new(st, &param);
+        ck_assert(ws != NULL);
+        result = freesasa_calc_structure(st, &param);
+        ck_assert(result != NULL);
+
+        move_and_compare(result, ws, xyz, radii, n_atoms, residue, 10, shift);
+        move_and_compare(result, ws, xyz, radii, n_atoms, one, 1, shift);
+        /* outside the original bounds, and back again */
+        move_and_compare(result, ws, xyz, radii, n_atoms, one, 1, far);
+        move_and_compare(result, ws, xyz, radii, n_atoms, one, 1, back);
+        move_and_compare(result, ws, xyz, radii, n_atoms, residue, 0, shift);
+
+        freesasa_set_verbosity(FREESASA_V_SILENT);
+        ck_assert_int_eq(freesasa_result_update(result, ws, twice, 3, xyz), FREESASA_FAIL);
+        ck_assert_int_eq(freesasa_result_update(result, ws, outside, 1, xyz), FREESASA_FAIL);
+        result->parameters.probe_radius = 1.5;
+        ck_assert_int_eq(freesasa_result_update(result, ws, one, 1, xyz), FREESASA_FAIL);
+        freesasa_set_verbosity(FREESASA_V_NORMAL);
+
+        freesasa_result_free(result);
+        freesasa_workspace_free(ws);
+    }
+
+    free(xyz);
+    freesasa_structure_free(st);
+}
+END_TEST
+
+/* total SASA of the structure without the atoms that are flagged in removed */
+static double
+mutant_total(const freesasa_structure *st,
+             const char *removed,
+             const freesasa_parameters *param)
+{
+    int n_atoms = freesasa_structure_n(st), n = 0, i;
+    const double *xyz = freesasa_coord_all(freesasa_structure_xyz(st));
+    const double *radii = freesasa_structure_radius(st);
+    double *mut_xyz = malloc(sizeof(double) * 3 * n_atoms);
+    double *mut_radii = malloc(sizeof(double) * n_atoms);
+    double total;
+    freesasa_result *ref;
+
+    for (i = 0; i < n_atoms; ++i) {
+        if (removed[i]) continue;
+        memcpy(mut_xyz + 3 * n, xyz + 3 * i, sizeof(double) * 3);
+        mut_radii[n++] = radii[i];
+    }
+    ref = freesasa_calc_coord(mut_xyz, mut_radii, n, param);
+    ck_assert(ref != NULL);
+    total = ref->total;
+
+    freesasa_result_free(ref);
+    free(mut_xyz);
+    free(mut_radii);
+    return total;
+}
+
+START_TEST(test_residue_scan)
+{
+    FILE *pdb = fopen(DATADIR "1ubq.pdb", "r");
+    freesasa_structure *st = freesasa_structure_from_pdb(pdb, NULL, 0);
+    freesasa_parameters param = freesasa_default_parameters;
+    freesasa_algorithm alg[] = {FREESASA_SHRAKE_RUPLEY, FREESASA_LEE_RICHARDS};
+    freesasa_scan_type type[] = {FREESASA_SCAN_DELETE, FREESASA_SCAN_ALANINE};
+    int n_atoms = freesasa_structure_n(st), a, t, r, i, first, last, n_removed;
+    char *removed = calloc(n_atoms, 1);
+    const char *name;
+    freesasa_scan_result *scan;
+    freesasa_result *wt;
+
+    fclose(pdb);
+
+    for (a = 0; a < 2; ++a) {
+        param.alg = alg[a];
+        param.n_threads = USE_THREADS ? 2 : 1;
+        wt = freesasa_calc_structure(st, &param);
+        ck_assert(wt != NULL);
+        for (t = 0; t < 2; ++t) {
+            scan = freesasa_residue_scan(st, &param, type[t]);
+            ck_assert(scan != NULL);
+            ck_assert_int_eq(scan->n_residues, freesasa_structure_n_residues(st));
+            ck_assert(scan->total == wt->total);
+            /* every 5th residue, compared to calculations on the mutants */
+            for (r = 0; r < scan->n_residues; r += 5) {
+                freesasa_structure_residue_atoms(st, r, &first, &last);
+                n_removed = 0;
+                for (i = first; i <= last; ++i) {
+                    name = freesasa_structure_atom_name(st, i);
+                    if (type[t] == FREESASA_SCAN_ALANINE &&
+                        (freesasa_atom_is_backbone(name) || strcmp(name, " CB ") == 0)) continue;
+                    removed[i] = 1;
+                    ++n_removed;
+                }
+                ck_assert_int_eq(scan->residue[r].n_removed, n_removed);
+                ck_assert(fabs(scan->residue[r].delta - (mutant_total(st, removed, &param) - wt->total)) < 1e-6);
+                ck_assert(fabs(scan->residue[r].exposed - scan->residue[r].removed - scan->residue[r].delta) < 1e-10);
+                memset(removed, 0, n_atoms);
+            }
+            /* MET 1 and GLY 10 */
+            ck_assert_int_eq(scan->residue[0].n_removed, type[t] == FREESASA_SCAN_DELETE ? 8 : 3);
+            ck_assert_int_eq(scan->residue[9].n_removed, type[t] == FREESASA_SCAN_DELETE ? 4 : 0);
+            if (type[t] == FREESASA_SCAN_ALANINE) ck_assert(scan->residue[9].delta == 0);
+            freesasa_scan_result_free(scan);
+        }
+        freesasa_result_free(wt);
+    }
+
+    free(removed);
+    freesasa_structure_free(st);
+}
+END_TEST
+
+START_TEST(test_format_fixed)
+{
+    const double values[] = {0, -0.0, 1, -1, 0.5, 1.5, 2.5, 0.125, 2.675, 9.996,
+                             -9.996, 0.0049, 99.995, 1e-10, 123456.789, 1e15, 1e300,
+                             INFINITY, -INFINITY, NAN};
+    const int n_values = sizeof(values) / sizeof(double);
+    char buf[FREESASA_FIXED_BUFSIZE], ref[512];
+    double v;
+    int i, w, p, len;
+
+    srand(1);
+    for (i = 0; i < n_values + 10000; ++i) {
+        if (i < n_values)
+            v = values[i];
+        else
+            v = (rand() / (double)RAND_MAX - 0.5) * pow(10, rand() % 12 - 4);
+        for (p = 0; p < 11; ++p) {
+            for (w = 0; w < 10; w += 3) {
+                len = freesasa_format_fixed(buf, sizeof buf, v, w, p);
+                ck_assert_int_eq(len, snprintf(ref, sizeof ref, "%*.*f", w, p, v));
+                if (len < (int)sizeof buf) ck_assert_str_eq(buf, ref);
+            }
+        }
+    }
+}
+END_TEST
+
 START_TEST(test_memerr)
 {
     freesasa_parameters p = freesasa_default_parameters;
@@ -524,6 +782,9 @@ Suite *sasa_suite()
     tcase_add_test(tc_basic, test_calc_errors);
     tcase_add_test(tc_basic, test_user_classes);
     tcase_add_test(tc_basic, test_write_pdb);
+    tcase_add_test(tc_basic, test_format_fixed);
+    tcase_add_test(tc_basic, test_result_update);
+    tcase_add_test(tc_basic, test_residue_scan);
     tcase_add_test(tc_basic, test_memerr);
 
     TCase *tc_lr_basic = tcase_create("Basic L&R");
@@ -549,6 +810,7 @@ Suite *sasa_suite()
 
     TCase *tc_1d3z = tcase_create("NMR PDB-file 1D3Z (several models, hydrogens)");
     tcase_add_test(tc_1d3z, test_1d3z);
+    tcase_add_test(tc_1d3z, test_trajectory);
 
     suite_add_tcase(s, tc_basic);
     suite_add_tcase(s, tc_lr_basic);
@@ -5,6 +5,7 @@
 #include <freesasa.h>
 #include <json-c/json_object.h>
 #include <json-c/json_object_iterator.h>
+#include <json-c/json_tokener.h>
 
 #include "tools.h"
 
@@ -232,11 +233,65 @@ START_TEST(test_json)
 }
 END_TEST
 
+static json_object *
+json_get(json_object *obj, const char *key)
+{
+    json_object *val = NULL;
+    ck_assert(json_object_object_get_ex(obj, key, &val));
+    return val;
+}
+
+START_TEST(test_write_json)
+{
+    FILE *pdb = fopen(DATADIR "1ubq.pdb", "r"), *tf = tmpfile();
+    freesasa_structure *ubq =
+        freesasa_structure_from_pdb(pdb, &freesasa_default_classifier, 0);
+    freesasa_result *result = freesasa_calc_structure(ubq, NULL);
+    freesasa_node *tree = freesasa_tree_init(result, ubq, "test", FREESASA_OUTPUT_ATOM);
+    freesasa_node *structure = freesasa_node_children(freesasa_node_children(tree));
+    freesasa_selection *sel = freesasa_selection_new("ala, resn ala", ubq, result);
+    json_object *root, *results, *ref;
+    char *buf;
+    long size;
+
+    fclose(pdb);
+    freesasa_node_structure_add_selection(structure, sel);
+
+    // the streamed output should be equivalent to the json-c object tree
+    ck_assert_int_eq(freesasa_tree_export(tf, tree, FREESASA_JSON | FREESASA_OUTPUT_ATOM), FREESASA_SUCCESS);
+    size = ftell(tf);
+    rewind(tf);
+    buf = malloc(size + 1);
+    ck_assert_int_eq(fread(buf, 1, size, tf), size);
+    buf[size] = '\0';
+
+    root = json_tokener_parse(buf);
+    ck_assert_ptr_ne(root, NULL);
+    ck_assert_str_eq(json_object_get_string(json_get(root, "length-unit")), "Ångström");
+    results = json_get(root, "results");
+    ck_assert_int_eq(json_object_array_length(results), 1);
+    ck_assert_str_eq(json_object_get_string(json_get(json_object_array_get_idx(results, 0), "input")), "test");
+
+    ref = freesasa_node2json(freesasa_node_children(tree), FREESASA_NODE_NONE, 0);
+    ck_assert(json_object_equal(json_get(json_object_array_get_idx(results, 0), "structure"), ref));
+
+    json_object_put(ref);
+    json_object_put(root);
+    free(buf);
+    fclose(tf);
+    freesasa_selection_free(sel);
+    freesasa_structure_free(ubq);
+    freesasa_result_free(result);
+    freesasa_node_free(tree);
+}
+END_TEST
+
 Suite *json_suite()
 {
     Suite *s = suite_create("JSON");
     TCase *tc_core = tcase_create("Core");
     tcase_add_test(tc_core, test_json);
+    tcase_add_test(tc_core, test_write_json);
 
     suite_add_tcase(s, tc_core);
 
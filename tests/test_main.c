@@ -14,6 +14,7 @@ extern Suite *sasa_suite();
 extern Suite *nb_suite();
 extern Suite *selector_suite();
 extern Suite *result_node_suite();
+extern Suite *bin_suite();
 
 #ifdef USE_JSON
 extern Suite *json_suite();
@@ -35,6 +36,7 @@ int main(int argc, char **argv)
     srunner_add_suite(sr, nb_suite());
     srunner_add_suite(sr, selector_suite());
     srunner_add_suite(sr, result_node_suite());
+    srunner_add_suite(sr, bin_suite());
 #if USE_JSON
     srunner_add_suite(sr, json_suite());
 #endif
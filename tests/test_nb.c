@@ -26,6 +26,59 @@ START_TEST(test_nb)
 }
 END_TEST
 
+// compare with brute force for random coordinates
+START_TEST(test_within)
+{
+    const int n = 500;
+    coord_t *coord = freesasa_coord_new();
+    char source[n], target[n];
+    double xyz[3], d2;
+    const double *vi, *vj;
+    int expected;
+
+    srand(1);
+    for (int i = 0; i < n; ++i) {
+        for (int k = 0; k < 3; ++k)
+            xyz[k] = 30.0 * rand() / RAND_MAX;
+        freesasa_coord_append(coord, xyz, 1);
+        source[i] = (i % 17 == 0);
+    }
+
+    for (double cutoff = 0; cutoff < 12; cutoff += 2.5) {
+        ck_assert_int_eq(freesasa_nb_within(coord, cutoff, source, target), FREESASA_SUCCESS);
+        for (int i = 0; i < n; ++i) {
+            expected = 0;
+            vi = freesasa_coord_i(coord, i);
+            for (int j = 0; j < n && !expected; ++j) {
+                if (!source[j]) continue;
+                vj = freesasa_coord_i(coord, j);
+                d2 = (vi[0] - vj[0]) * (vi[0] - vj[0]) +
+                     (vi[1] - vj[1]) * (vi[1] - vj[1]) +
+                     (vi[2] - vj[2]) * (vi[2] - vj[2]);
+                expected = d2 <= cutoff * cutoff;
+            }
+            ck_assert_int_eq(target[i], expected);
+        }
+    }
+    freesasa_coord_free(coord);
+
+    // small cutoff in a large box, the cells are made larger than the cutoff
+    const double sparse[] = {0, 0, 0, 0.3, 0, 0, 300, 300, 300, 300, 300, 300.4};
+    const char sparse_source[] = {1, 0, 0, 1};
+    coord = freesasa_coord_new();
+    freesasa_coord_append(coord, sparse, 4);
+    ck_assert_int_eq(freesasa_nb_within(coord, 0.5, sparse_source, target), FREESASA_SUCCESS);
+    ck_assert_int_eq(target[0], 1);
+    ck_assert_int_eq(target[1], 1);
+    ck_assert_int_eq(target[2], 1);
+    ck_assert_int_eq(target[3], 1);
+    ck_assert_int_eq(freesasa_nb_within(coord, 0.35, sparse_source, target), FREESASA_SUCCESS);
+    ck_assert_int_eq(target[1], 1);
+    ck_assert_int_eq(target[2], 0);
+    freesasa_coord_free(coord);
+}
+END_TEST
+
 START_TEST(test_memerr)
 {
     freesasa_set_verbosity(FREESASA_V_SILENT);
@@ -51,6 +104,7 @@ Suite *nb_suite()
 
     TCase *tc_nb = tcase_create("Basic");
     tcase_add_test(tc_nb, test_nb);
+    tcase_add_test(tc_nb, test_within);
     tcase_add_test(tc_nb, test_memerr);
 
     TCase *tc_static = test_nb_static();
@@ -25,6 +25,13 @@ test_tree(freesasa_node *structure,
     ck_assert_str_eq(freesasa_node_name(residue), "MET");
     ck_assert_str_eq(freesasa_node_name(atom), " N  ");
 
+    // atoms are created on demand, but only once
+    ck_assert_ptr_eq(freesasa_node_children(residue), atom);
+    ck_assert_ptr_eq(freesasa_node_parent(atom), residue);
+    ck_assert_str_eq(freesasa_node_atom_residue_name(atom), "MET");
+    ck_assert_str_eq(freesasa_node_atom_residue_number(atom), "   1 ");
+    ck_assert_int_eq(freesasa_node_atom_chain(atom), 'A');
+
     ck_assert_int_eq(freesasa_node_structure_n_chains(structure), 1);
     ck_assert_int_eq(freesasa_node_structure_n_atoms(structure), 602);
     ck_assert_str_eq(freesasa_node_structure_chain_labels(structure), "A");
@@ -80,8 +87,10 @@ START_TEST(test_result_node)
     ck_assert_ptr_ne((rn = freesasa_node_children(rn)), NULL);
     test_tree(rn, result);
 
+    ck_assert_int_eq(freesasa_node_root_n_results(tree), 1);
     freesasa_tree_join(tree, &tree2);
     ck_assert(tree2 == NULL);
+    ck_assert_int_eq(freesasa_node_root_n_results(tree), 2);
     rn = freesasa_node_children(tree); // result in tree
     ck_assert_ptr_ne(rn, NULL);
     rn = freesasa_node_children(rn); // structure in tree
@@ -107,7 +116,7 @@ START_TEST(test_memerr)
     freesasa_node *rn;
     freesasa_set_verbosity(FREESASA_V_SILENT);
     rn = freesasa_tree_new();
-    for (int i = 1; i < 200; ++i) {
+    for (int i = 1; i < 16; ++i) {
         int ret;
         set_fail_after(i);
         ret = freesasa_tree_add_result(rn, result, structure, "test");
@@ -121,6 +130,102 @@ START_TEST(test_memerr)
 }
 END_TEST
 
+START_TEST(test_depth)
+{
+    FILE *file = fopen(DATADIR "1ubq.pdb", "r");
+    freesasa_structure *structure = freesasa_structure_from_pdb(file, NULL, 0);
+    freesasa_result *result = freesasa_calc_structure(structure, NULL);
+    freesasa_node *full = freesasa_tree_init(result, structure, "test", FREESASA_OUTPUT_ATOM);
+    freesasa_node *tree, *node, *ref;
+    const freesasa_nodearea *area, *ref_area;
+
+    ref = freesasa_node_children(freesasa_node_children(full));
+
+    // structure level only
+    tree = freesasa_tree_init(result, structure, "test", FREESASA_OUTPUT_STRUCTURE | FREESASA_JSON);
+    ck_assert_ptr_ne(tree, NULL);
+    node = freesasa_node_children(freesasa_node_children(tree));
+    ck_assert_int_eq(freesasa_node_type(node), FREESASA_NODE_STRUCTURE);
+    ck_assert_ptr_eq(freesasa_node_children(node), NULL);
+    ck_assert_int_eq(freesasa_node_structure_n_chains(node), 1);
+    area = freesasa_node_area(node);
+    ref_area = freesasa_node_area(ref);
+    ck_assert(area->total == ref_area->total);
+    ck_assert(area->polar == ref_area->polar);
+    ck_assert(area->main_chain == ref_area->main_chain);
+    freesasa_node_free(tree);
+
+    // down to chains
+    tree = freesasa_tree_init(result, structure, "test", FREESASA_OUTPUT_CHAIN);
+    node = freesasa_node_children(freesasa_node_children(freesasa_node_children(tree)));
+    ck_assert_int_eq(freesasa_node_type(node), FREESASA_NODE_CHAIN);
+    ck_assert_ptr_eq(freesasa_node_children(node), NULL);
+    ck_assert_int_eq(freesasa_node_chain_n_residues(node), 76);
+    ck_assert(freesasa_node_area(node)->total == freesasa_node_area(freesasa_node_children(ref))->total);
+    ck_assert(freesasa_node_area(freesasa_node_parent(node))->total == ref_area->total);
+    freesasa_node_free(tree);
+
+    // down to residues
+    tree = freesasa_tree_init(result, structure, "test", FREESASA_OUTPUT_RESIDUE);
+    node = freesasa_node_children(freesasa_node_children(freesasa_node_children(tree)));
+    node = freesasa_node_children(node);
+    ck_assert_int_eq(freesasa_node_type(node), FREESASA_NODE_RESIDUE);
+    ck_assert_str_eq(freesasa_node_name(node), "MET");
+    ck_assert_int_eq(freesasa_node_residue_n_atoms(node), 8);
+    ck_assert_ptr_eq(freesasa_node_children(node), NULL);
+    ck_assert(freesasa_node_area(node)->side_chain ==
+              freesasa_node_area(freesasa_node_children(freesasa_node_children(ref)))->side_chain);
+    freesasa_node_free(tree);
+
+    freesasa_node_free(full);
+    freesasa_structure_free(structure);
+    freesasa_result_free(result);
+    fclose(file);
+}
+END_TEST
+
+START_TEST(test_join_many)
+{
+    FILE *file = fopen(DATADIR "1ubq.pdb", "r");
+    freesasa_structure *structure = freesasa_structure_from_pdb(file, NULL, 0);
+    freesasa_result *result = freesasa_calc_structure(structure, NULL);
+    freesasa_node *tree = freesasa_tree_new(), *trees[4], *rn;
+    const char *names[] = {"a", "b", "c", "d"};
+    int i;
+
+    trees[0] = freesasa_tree_init(result, structure, "a", FREESASA_OUTPUT_STRUCTURE);
+    trees[1] = freesasa_tree_new();
+    trees[2] = freesasa_tree_init(result, structure, "b", FREESASA_OUTPUT_STRUCTURE);
+    trees[3] = freesasa_tree_init(result, structure, "d", FREESASA_OUTPUT_STRUCTURE);
+    ck_assert_int_eq(freesasa_tree_add_result(trees[3], result, structure, "c"), FREESASA_SUCCESS);
+
+    ck_assert_int_eq(freesasa_tree_join_many(tree, trees, 4), FREESASA_SUCCESS);
+    for (i = 0; i < 4; ++i) {
+        ck_assert_ptr_eq(trees[i], NULL);
+    }
+    ck_assert_int_eq(freesasa_node_root_n_results(tree), 4);
+
+    // appending after a bulk join uses the right tail
+    trees[0] = freesasa_tree_init(result, structure, "e", FREESASA_OUTPUT_STRUCTURE);
+    ck_assert_int_eq(freesasa_tree_join(tree, &trees[0]), FREESASA_SUCCESS);
+    ck_assert_int_eq(freesasa_node_root_n_results(tree), 5);
+
+    rn = freesasa_node_children(tree);
+    for (i = 0; i < 4; ++i) {
+        ck_assert_ptr_ne(rn, NULL);
+        ck_assert_str_eq(freesasa_node_name(rn), names[i]);
+        rn = freesasa_node_next(rn);
+    }
+    ck_assert_str_eq(freesasa_node_name(rn), "e");
+    ck_assert_ptr_eq(freesasa_node_next(rn), NULL);
+
+    freesasa_node_free(tree);
+    freesasa_structure_free(structure);
+    freesasa_result_free(result);
+    fclose(file);
+}
+END_TEST
+
 Suite *result_node_suite()
 {
     Suite *s = suite_create("Result-node");
@@ -128,6 +233,8 @@ Suite *result_node_suite()
     TCase *tc_core = tcase_create("Core");
     tcase_add_test(tc_core, test_result_node);
     tcase_add_test(tc_core, test_memerr);
+    tcase_add_test(tc_core, test_depth);
+    tcase_add_test(tc_core, test_join_many);
 
     suite_add_tcase(s, tc_core);
 
@@ -50,6 +50,7 @@ static void
 test_select(const char **command, int n_commands)
 {
     freesasa_selection *sel;
+    freesasa_compiled_selection *compiled;
     for (int i = 0; i < n_commands; ++i) {
         ck_assert_int_eq(freesasa_select_area(command[i], selection_name[i], value + i, structure, result),
                          FREESASA_SUCCESS);
@@ -59,6 +60,19 @@ test_select(const char **command, int n_commands)
         ck_assert_str_eq(freesasa_selection_name(sel), selection_name[i]);
         ck_assert(float_eq(freesasa_selection_area(sel), value[i], 1e-10));
         freesasa_selection_free(sel);
+
+        // the second evaluation reuses the selected atoms
+        compiled = freesasa_selection_compile(command[i]);
+        ck_assert_ptr_ne(compiled, NULL);
+        for (int j = 0; j < 2; ++j) {
+            sel = freesasa_compiled_selection_eval(compiled, structure, result);
+            ck_assert_ptr_ne(sel, NULL);
+            ck_assert_str_eq(freesasa_selection_command(sel), command[i]);
+            ck_assert_str_eq(freesasa_selection_name(sel), selection_name[i]);
+            ck_assert(float_eq(freesasa_selection_area(sel), value[i], 1e-10));
+            freesasa_selection_free(sel);
+        }
+        freesasa_compiled_selection_free(compiled);
     }
 }
 
@@ -373,6 +387,86 @@ START_TEST(test_complex_syntax)
 }
 END_TEST
 
+START_TEST(test_compiled)
+{
+    freesasa_compiled_selection *compiled = freesasa_selection_compile("a, chain A and resi 1-2");
+    freesasa_structure *moved = freesasa_structure_new(), *other = freesasa_structure_new();
+    freesasa_result *result_moved, *result_other;
+    freesasa_selection *sel;
+    double area;
+    char s[FREESASA_MAX_SELECTION_NAME + 1];
+
+    // same atoms, different coordinates
+    for (int i = 0; i < N; ++i) {
+        freesasa_structure_add_atom(moved, name[i], resn[i], resi[i], chain[i], i * 2, 0, 0);
+    }
+    // different chain labels
+    for (int i = 0; i < N; ++i) {
+        freesasa_structure_add_atom(other, name[i], resn[i], resi[i], 'A', i * 10, 0, 0);
+    }
+    result_moved = freesasa_calc_structure(moved, NULL);
+    result_other = freesasa_calc_structure(other, NULL);
+
+    ck_assert_ptr_ne(compiled, NULL);
+
+    sel = freesasa_compiled_selection_eval(compiled, structure, result);
+    freesasa_select_area("a, chain A and resi 1-2", s, &area, structure, result);
+    ck_assert(float_eq(freesasa_selection_area(sel), area, 1e-10));
+    freesasa_selection_free(sel);
+
+    sel = freesasa_compiled_selection_eval(compiled, moved, result_moved);
+    freesasa_select_area("a, chain A and resi 1-2", s, &area, moved, result_moved);
+    ck_assert(float_eq(freesasa_selection_area(sel), area, 1e-10));
+    freesasa_selection_free(sel);
+
+    sel = freesasa_compiled_selection_eval(compiled, other, result_other);
+    freesasa_select_area("a, chain A and resi 1-2", s, &area, other, result_other);
+    ck_assert(float_eq(freesasa_selection_area(sel), area, 1e-10));
+    ck_assert(area > 0);
+    freesasa_selection_free(sel);
+
+    freesasa_set_verbosity(FREESASA_V_SILENT);
+    ck_assert_ptr_eq(freesasa_selection_compile("a, resn"), NULL);
+    freesasa_set_verbosity(FREESASA_V_NORMAL);
+
+    freesasa_compiled_selection_free(compiled);
+    freesasa_structure_free(moved);
+    freesasa_structure_free(other);
+    freesasa_result_free(result_moved);
+    freesasa_result_free(result_other);
+}
+END_TEST
+
+// atoms are placed along the x-axis with 10 Å separation
+START_TEST(test_within)
+{
+    const int chain_A_and_next[N] = {1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0};
+    const int around_resn_V[N] = {0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0};
+    const char *commands[] = {"c1, within 10 of chain A",
+                              "c2, around 10 of resn val",
+                              "c3, within 9.5 of chain A",
+                              "c4, within 0 of name ca",
+                              "c5, around 10.0 of resn val or name ca",
+                              "c6, not within 10 OF resn val"};
+    test_select(commands, 6);
+    ck_assert(float_eq(value[0], addup(chain_A_and_next, result), 1e-10));
+    ck_assert(float_eq(value[1], addup(around_resn_V, result), 1e-10));
+    ck_assert(float_eq(value[2], addup(chain_A, result), 1e-10));
+    ck_assert(float_eq(value[3], addup(name_CA, result), 1e-10));
+    ck_assert(float_eq(value[4], addup(around_resn_V, result) + addup(name_CA, result), 1e-10));
+    ck_assert(float_eq(value[5], addup(all, result) - addup(around_resn_V, result) - addup(resn_V, result), 1e-10));
+
+    freesasa_set_verbosity(FREESASA_V_SILENT);
+    ck_assert_int_eq(freesasa_select_area("a, within 1.2.3 of chain A", selection_name[0], value, structure, result),
+                     FREESASA_FAIL);
+    ck_assert_int_eq(freesasa_select_area("a, within of chain A", selection_name[0], value, structure, result),
+                     FREESASA_FAIL);
+    ck_assert_int_eq(freesasa_select_area("a, within 5 chain A", selection_name[0], value, structure, result),
+                     FREESASA_FAIL);
+    freesasa_set_verbosity(FREESASA_V_NORMAL);
+}
+END_TEST
+
 extern void *freesasa_selection_dummy_ptr;
 
 extern int
@@ -459,6 +553,8 @@ Suite *selector_suite()
     tcase_add_test(tc_core, test_resn);
     tcase_add_test(tc_core, test_resi);
     tcase_add_test(tc_core, test_chain);
+    tcase_add_test(tc_core, test_within);
+    tcase_add_test(tc_core, test_compiled);
     tcase_add_test(tc_core, test_memerr);
 
     TCase *tc_static = test_selection_static();
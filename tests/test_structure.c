@@ -1,11 +1,16 @@
+#if HAVE_CONFIG_H
+#include <config.h>
+#endif
 #include "tools.h"
 #include <check.h>
 #include <freesasa.h>
 #include <freesasa_internal.h>
 #include <math.h>
 #include <pdb.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 #define N 6
 const char an[N][PDB_ATOM_NAME_STRL + 1] = {" C  ", " CA ", " O  ", " CB ", " SD ", "SE  "};
@@ -119,6 +124,47 @@ START_TEST(test_add_atom)
 }
 END_TEST
 
+START_TEST(test_classifier_switch)
+{
+    // atoms are classified through a memo, which must not be reused
+    // when the classifier changes
+    freesasa_structure *s = freesasa_structure_new();
+    const freesasa_classifier *clf[] = {&freesasa_protor_classifier,
+                                        &freesasa_oons_classifier,
+                                        &freesasa_protor_classifier};
+    for (int i = 0; i < 3; ++i) {
+        ck_assert_int_eq(freesasa_structure_add_atom_wopt(s, " CA ", "ALA", "   1", 'A', 0, 0, 0, clf[i], 0),
+                         FREESASA_SUCCESS);
+        ck_assert_int_eq(freesasa_structure_add_atom_wopt(s, " CB ", "ALA", "   1", 'A', 0, 0, 0, clf[i], 0),
+                         FREESASA_SUCCESS);
+    }
+    for (int i = 0; i < freesasa_structure_n(s); ++i) {
+        ck_assert(float_eq(freesasa_structure_atom_radius(s, i),
+                           freesasa_classifier_radius(clf[i / 2], "ALA", freesasa_structure_atom_name(s, i)),
+                           1e-10));
+    }
+    freesasa_structure_free(s);
+
+    // a classifier that is freed and replaced, possibly at the same address
+    const char *config[] = {SHAREDIR "protor.config", SHAREDIR "oons.config"};
+    s = freesasa_structure_new();
+    for (int i = 0; i < 2; ++i) {
+        FILE *f = fopen(config[i], "r");
+        freesasa_classifier *c = freesasa_classifier_from_file(f);
+        fclose(f);
+        ck_assert(c != NULL);
+        ck_assert_int_eq(freesasa_structure_add_atom_wopt(s, " CA ", "ALA", "   1", 'A', 0, 0, 0, c, 0),
+                         FREESASA_SUCCESS);
+        ck_assert(float_eq(freesasa_structure_atom_radius(s, i),
+                           freesasa_classifier_radius(c, "ALA", " CA "), 1e-10));
+        freesasa_classifier_free(c);
+    }
+    ck_assert(!float_eq(freesasa_structure_atom_radius(s, 0),
+                        freesasa_structure_atom_radius(s, 1), 1e-10));
+    freesasa_structure_free(s);
+}
+END_TEST
+
 double a2r(const char *rn, const char *am)
 {
     return 1.0;
@@ -465,6 +511,310 @@ START_TEST(test_memerr)
 }
 END_TEST
 
+static void
+check_same_structure(const freesasa_structure *a,
+                     const freesasa_structure *b)
+{
+    const freesasa_nodearea *ra, *rb;
+    int i, first_a, last_a, first_b, last_b;
+
+    ck_assert_int_eq(freesasa_structure_n(a), freesasa_structure_n(b));
+    ck_assert_int_eq(freesasa_structure_n_residues(a), freesasa_structure_n_residues(b));
+    ck_assert_int_eq(freesasa_structure_n_chains(a), freesasa_structure_n_chains(b));
+    ck_assert_int_eq(freesasa_structure_model(a), freesasa_structure_model(b));
+    ck_assert_str_eq(freesasa_structure_chain_labels(a), freesasa_structure_chain_labels(b));
+    ck_assert_str_eq(freesasa_structure_classifier_name(a), freesasa_structure_classifier_name(b));
+
+    for (i = 0; i < 3 * freesasa_structure_n(a); ++i) {
+        ck_assert(freesasa_structure_coord_array(a)[i] == freesasa_structure_coord_array(b)[i]);
+    }
+    for (i = 0; i < freesasa_structure_n(a); ++i) {
+        ck_assert(freesasa_structure_radius(a)[i] == freesasa_structure_radius(b)[i]);
+        ck_assert_int_eq(freesasa_structure_atom_class(a, i), freesasa_structure_atom_class(b, i));
+        ck_assert_int_eq(freesasa_structure_atom_chain(a, i), freesasa_structure_atom_chain(b, i));
+        ck_assert_str_eq(freesasa_structure_atom_name(a, i), freesasa_structure_atom_name(b, i));
+        ck_assert_str_eq(freesasa_structure_atom_res_name(a, i), freesasa_structure_atom_res_name(b, i));
+        ck_assert_str_eq(freesasa_structure_atom_res_number(a, i), freesasa_structure_atom_res_number(b, i));
+        ck_assert_str_eq(freesasa_structure_atom_symbol(a, i), freesasa_structure_atom_symbol(b, i));
+        ck_assert_str_eq(freesasa_structure_atom_pdb_line(a, i), freesasa_structure_atom_pdb_line(b, i));
+    }
+    for (i = 0; i < freesasa_structure_n_residues(a); ++i) {
+        freesasa_structure_residue_atoms(a, i, &first_a, &last_a);
+        freesasa_structure_residue_atoms(b, i, &first_b, &last_b);
+        ck_assert_int_eq(first_a, first_b);
+        ck_assert_int_eq(last_a, last_b);
+        ra = freesasa_structure_residue_reference(a, i);
+        rb = freesasa_structure_residue_reference(b, i);
+        ck_assert((ra == NULL) == (rb == NULL));
+        if (ra != NULL) {
+            ck_assert_str_eq(ra->name, rb->name);
+            ck_assert(ra->total == rb->total);
+            ck_assert(ra->polar == rb->polar);
+        }
+    }
+}
+
+START_TEST(test_save_load)
+{
+    FILE *pdb = fopen(DATADIR "1ubq.pdb", "r"), *file;
+    freesasa_structure *ubq, *loaded, *empty = freesasa_structure_new();
+    freesasa_result *r1, *r2;
+    char buf[4096];
+    size_t n;
+    int i;
+
+    ubq = freesasa_structure_from_pdb(pdb, NULL, 0);
+    fclose(pdb);
+    ck_assert_ptr_ne(ubq, NULL);
+
+    // two structures in one file
+    file = fopen("tmp/1ubq.fss", "wb");
+    ck_assert_int_eq(freesasa_structure_save(file, ubq), FREESASA_SUCCESS);
+    ck_assert_int_eq(freesasa_structure_save(file, ubq), FREESASA_SUCCESS);
+    fclose(file);
+
+    file = fopen("tmp/1ubq.fss", "rb");
+    for (i = 0; i < 2; ++i) {
+        loaded = freesasa_structure_load(file);
+        ck_assert_ptr_ne(loaded, NULL);
+        check_same_structure(ubq, loaded);
+        r1 = freesasa_calc_structure(ubq, NULL);
+        r2 = freesasa_calc_structure(loaded, NULL);
+        ck_assert(r1->total == r2->total);
+        freesasa_result_free(r1);
+        freesasa_result_free(r2);
+        freesasa_structure_free(loaded);
+    }
+    ck_assert_int_eq(getc(file), EOF);
+    fclose(file);
+
+    freesasa_set_verbosity(FREESASA_V_SILENT);
+
+    file = fopen("tmp/empty.fss", "wb");
+    ck_assert_int_eq(freesasa_structure_save(file, empty), FREESASA_FAIL);
+    fclose(file);
+    freesasa_structure_free(empty);
+
+    // not a saved structure
+    file = fopen(DATADIR "1ubq.pdb", "rb");
+    ck_assert_ptr_eq(freesasa_structure_load(file), NULL);
+    fclose(file);
+
+    // truncated file
+    file = fopen("tmp/1ubq.fss", "rb");
+    n = fread(buf, 1, sizeof buf, file);
+    fclose(file);
+    file = fopen("tmp/truncated.fss", "wb");
+    fwrite(buf, 1, n, file);
+    fclose(file);
+    file = fopen("tmp/truncated.fss", "rb");
+    ck_assert_ptr_eq(freesasa_structure_load(file), NULL);
+    fclose(file);
+
+    file = fopen("tmp/1ubq.fss", "rb");
+    for (i = 1; i < 20; ++i) {
+        rewind(file);
+        set_fail_after(i);
+        loaded = freesasa_structure_load(file);
+        set_fail_after(0);
+        ck_assert_ptr_eq(loaded, NULL);
+    }
+    fclose(file);
+
+    freesasa_set_verbosity(FREESASA_V_NORMAL);
+    freesasa_structure_free(ubq);
+}
+END_TEST
+
+/* Loads a copy of a saved structure where the 32 bit integer at
+   offset has been replaced by value */
+static freesasa_structure *
+load_modified(const char *buf, size_t n, size_t offset, int32_t value)
+{
+    FILE *file = fopen("tmp/corrupt.fss", "wb");
+    freesasa_structure *s;
+
+    fwrite(buf, 1, offset, file);
+    fwrite(&value, sizeof value, 1, file);
+    fwrite(buf + offset + sizeof value, 1, n - offset - sizeof value, file);
+    fclose(file);
+
+    file = fopen("tmp/corrupt.fss", "rb");
+    s = freesasa_structure_load(file);
+    fclose(file);
+
+    return s;
+}
+
+START_TEST(test_load_corrupt)
+{
+    freesasa_structure *s = freesasa_structure_new(), *loaded;
+    FILE *file;
+    char buf[4096];
+    size_t n, atoms, residues, chains;
+    uint32_t header[10];
+
+    // two residues in one chain, two atoms each
+    freesasa_structure_add_atom(s, " N  ", "ALA", "   1", 'A', 0, 0, 0);
+    freesasa_structure_add_atom(s, " CA ", "ALA", "   1", 'A', 1, 0, 0);
+    freesasa_structure_add_atom(s, " N  ", "GLY", "   2", 'A', 2, 0, 0);
+    freesasa_structure_add_atom(s, " CA ", "GLY", "   2", 'A', 3, 0, 0);
+
+    file = fopen("tmp/small.fss", "wb");
+    ck_assert_int_eq(freesasa_structure_save(file, s), FREESASA_SUCCESS);
+    fclose(file);
+    file = fopen("tmp/small.fss", "rb");
+    n = fread(buf, 1, sizeof buf, file);
+    fclose(file);
+    ck_assert(n < sizeof buf);
+
+    // the header has an 8 byte magic string followed by 10 integers:
+    // version, byte order, size of atom and residue records, number
+    // of atoms, residues and chains, model, classifier and string size
+    memcpy(header, buf + 8, sizeof header);
+    ck_assert_int_eq(header[4], 4);
+    ck_assert_int_eq(header[5], 2);
+    ck_assert_int_eq(header[6], 1);
+
+    // coordinates and radii are followed by the atoms, the residues
+    // and the first atom of each chain
+    atoms = 8 + sizeof header + 4 * sizeof(double) * 4;
+    residues = atoms + 4 * header[2];
+    chains = residues + 2 * header[3];
+
+    // the first chain starts at atom 0 already, so this copy is intact
+    loaded = load_modified(buf, n, chains, 0);
+    ck_assert_ptr_ne(loaded, NULL);
+    ck_assert_int_eq(freesasa_structure_n_residues(loaded), 2);
+    freesasa_structure_free(loaded);
+
+    freesasa_set_verbosity(FREESASA_V_SILENT);
+    // the first chain doesn't start at the first atom
+    ck_assert_ptr_eq(load_modified(buf, n, chains, 1), NULL);
+    // the first residue doesn't start at the first atom
+    ck_assert_ptr_eq(load_modified(buf, n, residues, 1), NULL);
+    // the second residue has an atom of the first (res_index follows
+    // five string offsets in the atom record)
+    ck_assert_ptr_eq(load_modified(buf, n, atoms + 2 * header[2] + 5 * sizeof(uint32_t), 0), NULL);
+    // the first residue has an atom of the second
+    ck_assert_ptr_eq(load_modified(buf, n, atoms + 5 * sizeof(uint32_t), 1), NULL);
+    freesasa_set_verbosity(FREESASA_V_NORMAL);
+
+    freesasa_structure_free(s);
+}
+END_TEST
+
+START_TEST(test_model_iter)
+{
+    FILE *pdb = fopen(DATADIR "1d3z.pdb", "r"), *broken;
+    int options = FREESASA_SEPARATE_MODELS | FREESASA_INCLUDE_HYDROGEN, n = 0, i = 0;
+    freesasa_structure **ss;
+    freesasa_model_iter *iter;
+    const freesasa_structure *model;
+    char line[100];
+
+    freesasa_set_verbosity(FREESASA_V_SILENT);
+    ss = freesasa_structure_array(pdb, &n, NULL, options);
+    ck_assert_int_eq(n, 10);
+
+    iter = freesasa_model_iter_new(pdb, NULL, options);
+    ck_assert_ptr_ne(iter, NULL);
+    ck_assert(freesasa_model_iter_has_next(iter));
+    while ((model = freesasa_model_iter_next(iter)) != NULL) {
+        ck_assert_int_lt(i, n);
+        check_same_structure(model, ss[i]);
+        freesasa_structure_free(ss[i]);
+        ++i;
+    }
+    ck_assert_int_eq(i, n);
+    ck_assert(!freesasa_model_iter_has_next(iter));
+    freesasa_model_iter_free(iter);
+    free(ss);
+
+    ck_assert_ptr_eq(freesasa_model_iter_new(pdb, NULL, FREESASA_JOIN_MODELS), NULL);
+    ck_assert_ptr_eq(freesasa_model_iter_new(pdb, NULL, FREESASA_SEPARATE_CHAINS), NULL);
+
+    // second model lacks its first atom
+    rewind(pdb);
+    broken = fopen("tmp/broken.pdb", "w");
+    n = i = 0;
+    while (fgets(line, sizeof line, pdb) != NULL) {
+        if (strncmp(line, "MODEL", 5) == 0) ++n;
+        if (n == 2 && strncmp(line, "ATOM", 4) == 0 && i++ == 0) continue;
+        fputs(line, broken);
+    }
+    fclose(broken);
+
+    broken = fopen("tmp/broken.pdb", "r");
+    iter = freesasa_model_iter_new(broken, NULL, 0);
+    ck_assert_ptr_ne(freesasa_model_iter_next(iter), NULL);
+    ck_assert_ptr_eq(freesasa_model_iter_next(iter), NULL);
+    ck_assert(freesasa_model_iter_has_next(iter));
+    ck_assert_ptr_eq(freesasa_model_iter_next(iter), NULL);
+    freesasa_model_iter_free(iter);
+    fclose(broken);
+
+    fclose(pdb);
+    freesasa_set_verbosity(FREESASA_V_NORMAL);
+}
+END_TEST
+
+#if USE_ZLIB
+START_TEST(test_gzip)
+{
+    FILE *pdb = fopen(DATADIR "2jo4.pdb", "r"), *gz = fopen("tmp/2jo4.pdb.gz", "wb");
+    freesasa_structure *s1, *s2, **ss1, **ss2;
+    char buf[1000];
+    size_t n;
+    int n1, n2, i;
+
+    ck_assert_int_eq(freesasa_gzip(pdb, gz), FREESASA_SUCCESS);
+    fclose(gz);
+
+    gz = fopen("tmp/2jo4.pdb.gz", "rb");
+    ck_assert(freesasa_is_gzip(gz));
+    rewind(pdb);
+    ck_assert(!freesasa_is_gzip(pdb));
+
+    s1 = freesasa_structure_from_pdb(pdb, NULL, 0);
+    s2 = freesasa_structure_from_pdb(gz, NULL, 0);
+    ck_assert_ptr_ne(s2, NULL);
+    check_same_structure(s1, s2);
+    freesasa_structure_free(s1);
+    freesasa_structure_free(s2);
+
+    rewind(pdb);
+    rewind(gz);
+    ss1 = freesasa_structure_array(pdb, &n1, NULL, FREESASA_SEPARATE_MODELS | FREESASA_SEPARATE_CHAINS);
+    ss2 = freesasa_structure_array(gz, &n2, NULL, FREESASA_SEPARATE_MODELS | FREESASA_SEPARATE_CHAINS);
+    ck_assert_ptr_ne(ss2, NULL);
+    ck_assert_int_eq(n1, n2);
+    for (i = 0; i < n1; ++i) {
+        check_same_structure(ss1[i], ss2[i]);
+        freesasa_structure_free(ss1[i]);
+        freesasa_structure_free(ss2[i]);
+    }
+    free(ss1);
+    free(ss2);
+    fclose(pdb);
+
+    // truncated file
+    rewind(gz);
+    n = fread(buf, 1, sizeof buf, gz);
+    fclose(gz);
+    gz = fopen("tmp/truncated.gz", "wb");
+    fwrite(buf, 1, n, gz);
+    fclose(gz);
+
+    freesasa_set_verbosity(FREESASA_V_SILENT);
+    gz = fopen("tmp/truncated.gz", "rb");
+    ck_assert_ptr_eq(freesasa_structure_from_pdb(gz, NULL, 0), NULL);
+    fclose(gz);
+    freesasa_set_verbosity(FREESASA_V_NORMAL);
+}
+END_TEST
+#endif /* USE_ZLIB */
+
 Suite *structure_suite()
 {
     // what goes in what Case is kind of arbitrary
@@ -472,6 +822,7 @@ Suite *structure_suite()
     TCase *tc_core = tcase_create("Core");
     tcase_add_test(tc_core, test_structure_api);
     tcase_add_test(tc_core, test_add_atom);
+    tcase_add_test(tc_core, test_classifier_switch);
     tcase_add_test(tc_core, test_memerr);
 
     TCase *tc_pdb = tcase_create("PDB");
@@ -480,12 +831,18 @@ Suite *structure_suite()
     tcase_add_test(tc_pdb, test_hetatm);
     tcase_add_test(tc_pdb, test_get_chains);
     tcase_add_test(tc_pdb, test_occupancy);
+    tcase_add_test(tc_pdb, test_save_load);
+    tcase_add_test(tc_pdb, test_load_corrupt);
+#if USE_ZLIB
+    tcase_add_test(tc_pdb, test_gzip);
+#endif
 
     TCase *tc_array = tcase_create("Array");
     tcase_add_test(tc_pdb, test_structure_array_err);
     tcase_add_test(tc_pdb, test_structure_array_one_chain);
     tcase_add_test(tc_pdb, test_structure_array_nmr);
     tcase_add_test(tc_pdb, test_structure_array_chains_models);
+    tcase_add_test(tc_pdb, test_model_iter);
 
     TCase *tc_1ubq = tcase_create("1UBQ");
     tcase_add_checked_fixture(tc_1ubq, setup_1ubq, teardown_1ubq);